@@ -1122,47 +1122,650 @@ namespace etl
     return ETLSTD::pair<TDestinationTrue, TDestinationFalse>(destination_true, destination_false);
   }
 
+  namespace private_algorithm
+  {
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// Allows a value to be moved, if the language supports it.
+    //*************************************************************************
+    template <typename T>
+    T&& move_value(T& value)
+    {
+      return static_cast<T&&>(value);
+    }
+#else
+    //*************************************************************************
+    /// Allows a value to be moved, if the language supports it.
+    //*************************************************************************
+    template <typename T>
+    T& move_value(T& value)
+    {
+      return value;
+    }
+#endif
+
+    /// Ranges up to this size are left for the final insertion sort.
+    static const int SORT_THRESHOLD = 16;
+
+    //*************************************************************************
+    /// floor(log2(n)), for the introsort depth limit.
+    //*************************************************************************
+    template <typename TDistance>
+    TDistance sort_log2(TDistance n)
+    {
+      TDistance result = 0;
+
+      while (n > 1)
+      {
+        n /= 2;
+        ++result;
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Insertion sort. Stable.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type value_t;
+
+      if (first == last)
+      {
+        return;
+      }
+
+      TIterator itr = first;
+
+      while (++itr != last)
+      {
+        if (compare(*itr, *first))
+        {
+          // New smallest value. Shift everything up by one.
+          value_t value = move_value(*itr);
+
+          TIterator hole = itr;
+          TIterator previous = itr;
+
+          while (hole != first)
+          {
+            --previous;
+            *hole = move_value(*previous);
+            hole = previous;
+          }
+
+          *first = move_value(value);
+        }
+        else
+        {
+          // There is a smaller value at 'first', so the loop does not need a bounds check.
+          value_t value = move_value(*itr);
+
+          TIterator hole = itr;
+          TIterator previous = itr;
+          --previous;
+
+          while (compare(value, *previous))
+          {
+            *hole = move_value(*previous);
+            hole = previous;
+            --previous;
+          }
+
+          *hole = move_value(value);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Insertion sort, where a value no greater than any in the range is just before 'first'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void unguarded_insertion_sort(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type value_t;
+
+      for (TIterator itr = first; itr != last; ++itr)
+      {
+        value_t value = move_value(*itr);
+
+        TIterator hole = itr;
+        TIterator previous = itr;
+        --previous;
+
+        while (compare(value, *previous))
+        {
+          *hole = move_value(*previous);
+          hole = previous;
+          --previous;
+        }
+
+        *hole = move_value(value);
+      }
+    }
+
+    //*************************************************************************
+    /// Moves the hole at 'hole' down the heap, then puts 'value' in its place.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TValue, typename TCompare>
+    void adjust_heap(TIterator first, TDistance hole, TDistance length, TValue& value, TCompare compare)
+    {
+      const TDistance top = hole;
+      TDistance child = hole;
+
+      // Move the larger child up until the bottom of the heap.
+      while (child < ((length - 1) / 2))
+      {
+        child = 2 * (child + 1);
+
+        if (compare(*(first + child), *(first + (child - 1))))
+        {
+          --child;
+        }
+
+        *(first + hole) = move_value(*(first + child));
+        hole = child;
+      }
+
+      // A last node with only a left child.
+      if (((length & 1) == 0) && (child == ((length - 2) / 2)))
+      {
+        child = 2 * (child + 1);
+        *(first + hole) = move_value(*(first + (child - 1)));
+        hole = child - 1;
+      }
+
+      // Push the value back up to its place.
+      TDistance parent = (hole - 1) / 2;
+
+      while ((hole > top) && compare(*(first + parent), value))
+      {
+        *(first + hole) = move_value(*(first + parent));
+        hole = parent;
+        parent = (hole - 1) / 2;
+      }
+
+      *(first + hole) = move_value(value);
+    }
+
+    //*************************************************************************
+    /// Makes a max heap from the range.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void make_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename ETLSTD::iterator_traits<TIterator>::difference_type difference_t;
+
+      const difference_t length = last - first;
+
+      if (length < 2)
+      {
+        return;
+      }
+
+      difference_t parent = (length - 2) / 2;
+
+      while (true)
+      {
+        value_t value = move_value(*(first + parent));
+        adjust_heap(first, parent, length, value, compare);
+
+        if (parent == 0)
+        {
+          return;
+        }
+
+        --parent;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts a max heap.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort_heap(TIterator first, TIterator last, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename ETLSTD::iterator_traits<TIterator>::difference_type difference_t;
+
+      while ((last - first) > 1)
+      {
+        --last;
+
+        value_t value = move_value(*last);
+        *last = move_value(*first);
+        adjust_heap(first, difference_t(0), difference_t(last - first), value, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Puts the smallest (middle - first) values of the range in a max heap in [first, middle).
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void heap_select(TIterator first, TIterator middle, TIterator last, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type      value_t;
+      typedef typename ETLSTD::iterator_traits<TIterator>::difference_type difference_t;
+
+      if (first == middle)
+      {
+        return;
+      }
+
+      etl::private_algorithm::make_heap(first, middle, compare);
+
+      for (TIterator itr = middle; itr < last; ++itr)
+      {
+        if (compare(*itr, *first))
+        {
+          value_t value = move_value(*itr);
+          *itr = move_value(*first);
+          adjust_heap(first, difference_t(0), difference_t(middle - first), value, compare);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Swaps the median of a, b and c into 'result'.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void move_median_to_first(TIterator result, TIterator a, TIterator b, TIterator c, TCompare compare)
+    {
+      if (compare(*a, *b))
+      {
+        if (compare(*b, *c))
+        {
+          ETLSTD::iter_swap(result, b);
+        }
+        else if (compare(*a, *c))
+        {
+          ETLSTD::iter_swap(result, c);
+        }
+        else
+        {
+          ETLSTD::iter_swap(result, a);
+        }
+      }
+      else if (compare(*a, *c))
+      {
+        ETLSTD::iter_swap(result, a);
+      }
+      else if (compare(*b, *c))
+      {
+        ETLSTD::iter_swap(result, c);
+      }
+      else
+      {
+        ETLSTD::iter_swap(result, b);
+      }
+    }
+
+    //*************************************************************************
+    /// Partitions [first, last) around the median of three values.
+    /// Returns the start of the upper partition.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    TIterator partition_pivot(TIterator first, TIterator last, TCompare compare)
+    {
+      TIterator middle = first + ((last - first) / 2);
+      move_median_to_first(first, first + 1, middle, last - 1, compare);
+
+      // The pivot is at 'first'. The median of three guarantees a value
+      // on each side that stops the scans, so they need no bounds checks.
+      TIterator pivot = first;
+      TIterator low   = first + 1;
+      TIterator high  = last;
+
+      while (true)
+      {
+        while (compare(*low, *pivot))
+        {
+          ++low;
+        }
+
+        --high;
+
+        while (compare(*pivot, *high))
+        {
+          --high;
+        }
+
+        if (!(low < high))
+        {
+          return low;
+        }
+
+        ETLSTD::iter_swap(low, high);
+        ++low;
+      }
+    }
+
+    //*************************************************************************
+    /// Quicksort down to small ranges, switching to heapsort if the recursion
+    /// gets too deep.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void introsort_loop(TIterator first, TIterator last, TDistance depth_limit, TCompare compare)
+    {
+      while ((last - first) > SORT_THRESHOLD)
+      {
+        if (depth_limit == 0)
+        {
+          etl::private_algorithm::heap_select(first, last, last, compare);
+          etl::private_algorithm::sort_heap(first, last, compare);
+          return;
+        }
+
+        --depth_limit;
+
+        TIterator cut = partition_pivot(first, last, compare);
+
+        introsort_loop(cut, last, depth_limit, compare);
+        last = cut;
+      }
+    }
+
+    //*************************************************************************
+    /// Sort for random access iterators. Introsort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, ETLSTD::random_access_iterator_tag)
+    {
+      if ((last - first) < 2)
+      {
+        return;
+      }
+
+      introsort_loop(first, last, 2 * sort_log2(last - first), compare);
+
+      // Every value is now within SORT_THRESHOLD of its final position,
+      // and the smallest value is within the first SORT_THRESHOLD.
+      if ((last - first) > SORT_THRESHOLD)
+      {
+        insertion_sort(first, first + SORT_THRESHOLD, compare);
+        unguarded_insertion_sort(first + SORT_THRESHOLD, last, compare);
+      }
+      else
+      {
+        insertion_sort(first, last, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Rotates [first, last) so that 'middle' becomes the first element.
+    //*************************************************************************
+    template <typename TIterator>
+    void rotate(TIterator first, TIterator middle, TIterator last)
+    {
+      if ((first == middle) || (middle == last))
+      {
+        return;
+      }
+
+      TIterator next = middle;
+
+      while (first != next)
+      {
+        ETLSTD::iter_swap(first++, next++);
+
+        if (next == last)
+        {
+          next = middle;
+        }
+        else if (first == middle)
+        {
+          middle = next;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last) in place,
+    /// without a buffer. Stable.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void merge_without_buffer(TIterator first, TIterator middle, TIterator last, TDistance length1, TDistance length2, TCompare compare)
+    {
+      while ((length1 != 0) && (length2 != 0))
+      {
+        if ((length1 + length2) == 2)
+        {
+          if (compare(*middle, *first))
+          {
+            ETLSTD::iter_swap(first, middle);
+          }
+
+          return;
+        }
+
+        TIterator first_cut  = first;
+        TIterator second_cut = middle;
+        TDistance length11;
+        TDistance length22;
+
+        // Split the longer range in half and find where its middle value goes in the other.
+        if (length1 > length2)
+        {
+          length11 = length1 / 2;
+          ETLSTD::advance(first_cut, length11);
+          second_cut = ETLSTD::lower_bound(middle, last, *first_cut, compare);
+          length22 = TDistance(ETLSTD::distance(middle, second_cut));
+        }
+        else
+        {
+          length22 = length2 / 2;
+          ETLSTD::advance(second_cut, length22);
+          first_cut = ETLSTD::upper_bound(first, middle, *second_cut, compare);
+          length11 = TDistance(ETLSTD::distance(first, first_cut));
+        }
+
+        etl::private_algorithm::rotate(first_cut, middle, second_cut);
+
+        TIterator new_middle = first_cut;
+        ETLSTD::advance(new_middle, length22);
+
+        // Recurse on the left part and loop on the right part.
+        merge_without_buffer(first, first_cut, new_middle, length11, length22, compare);
+
+        first   = new_middle;
+        middle  = second_cut;
+        length1 = length1 - length11;
+        length2 = length2 - length22;
+      }
+    }
+
+    //*************************************************************************
+    /// Sorts a small range, if the iterators allow it.
+    /// Returns false if the range should be split further.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    bool stable_sort_small(TIterator, TIterator, TDistance length, TCompare, ETLSTD::forward_iterator_tag)
+    {
+      return length < 2;
+    }
+
+    template <typename TIterator, typename TDistance, typename TCompare>
+    bool stable_sort_small(TIterator first, TIterator last, TDistance length, TCompare compare, ETLSTD::bidirectional_iterator_tag)
+    {
+      if (length > SORT_THRESHOLD)
+      {
+        return false;
+      }
+
+      insertion_sort(first, last, compare);
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Merge sort in place.
+    //*************************************************************************
+    template <typename TIterator, typename TDistance, typename TCompare>
+    void stable_sort(TIterator first, TIterator last, TDistance length, TCompare compare)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::iterator_category iterator_category;
+
+      if (stable_sort_small(first, last, length, compare, iterator_category()))
+      {
+        return;
+      }
+
+      const TDistance length1 = length / 2;
+      const TDistance length2 = length - length1;
+
+      TIterator middle = first;
+      ETLSTD::advance(middle, length1);
+
+      stable_sort(first,  middle, length1, compare);
+      stable_sort(middle, last,   length2, compare);
+      merge_without_buffer(first, middle, last, length1, length2, compare);
+    }
+
+    //*************************************************************************
+    /// Sort for forward and bidirectional iterators. In place merge sort.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void sort(TIterator first, TIterator last, TCompare compare, ETLSTD::forward_iterator_tag)
+    {
+      etl::private_algorithm::stable_sort(first, last, ETLSTD::distance(first, last), compare);
+    }
+  }
+
   //***************************************************************************
-  /// Sorts the elements using shell sort.
+  /// Sorts the elements.
+  /// Random access iterators use introsort; median of three quicksort,
+  /// falling back to heapsort if the partitions are poor, and insertion sort
+  /// for small ranges. O(N log N). Not stable.
+  /// Other iterators use an in place merge sort. O(N log N log N).
+  /// Does not allocate.
   /// Uses users defined comparison.
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator, typename TCompare>
   void sort(TIterator first, TIterator last, TCompare compare)
+  {
+    typedef typename ETLSTD::iterator_traits<TIterator>::iterator_category iterator_category;
+
+    etl::private_algorithm::sort(first, last, compare, iterator_category());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void sort(TIterator first, TIterator last)
+  {
+    etl::sort(first, last, ETLSTD::less<typename ETLSTD::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, keeping the order of equal elements.
+  /// In place merge sort. O(N log N log N). Does not allocate.
+  /// Uses users defined comparison.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void stable_sort(TIterator first, TIterator last, TCompare compare)
+  {
+    etl::private_algorithm::stable_sort(first, last, ETLSTD::distance(first, last), compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the elements, keeping the order of equal elements.
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void stable_sort(TIterator first, TIterator last)
+  {
+    etl::stable_sort(first, last, ETLSTD::less<typename ETLSTD::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  /// The order of the rest is unspecified. Random access iterators.
+  /// Heap sort. O(N log M).
+  /// Uses users defined comparison.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void partial_sort(TIterator first, TIterator middle, TIterator last, TCompare compare)
+  {
+    etl::private_algorithm::heap_select(first, middle, last, compare);
+    etl::private_algorithm::sort_heap(first, middle, compare);
+  }
+
+  //***************************************************************************
+  /// Sorts the smallest (middle - first) elements into [first, middle).
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/partial_sort"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator>
+  void partial_sort(TIterator first, TIterator middle, TIterator last)
+  {
+    etl::partial_sort(first, middle, last, ETLSTD::less<typename ETLSTD::iterator_traits<TIterator>::value_type>());
+  }
+
+  //***************************************************************************
+  /// Puts the element that would be at 'nth' in a sorted range there, with
+  /// no greater elements before it and no smaller elements after it.
+  /// Random access iterators. Introselect. O(N) on average.
+  /// Uses users defined comparison.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
+  ///\ingroup algorithm
+  //***************************************************************************
+  template <typename TIterator, typename TCompare>
+  void nth_element(TIterator first, TIterator nth, TIterator last, TCompare compare)
   {
     typedef typename ETLSTD::iterator_traits<TIterator>::difference_type difference_t;
 
-    difference_t n = ETLSTD::distance(first, last);
+    if ((first == last) || (nth == last))
+    {
+      return;
+    }
 
-    for (difference_t i = n / 2; i > 0; i /= 2)
+    difference_t depth_limit = 2 * etl::private_algorithm::sort_log2(last - first);
+
+    while ((last - first) > 3)
     {
-      for (difference_t j = i; j < n; ++j)
+      if (depth_limit == 0)
       {
-        for (difference_t k = j - i; k >= 0; k -= i)
-        {
-          TIterator itr1 = first;
-          TIterator itr2 = first;
+        etl::private_algorithm::heap_select(first, nth + 1, last, compare);
+        // The largest of the selected values is at the top of the heap.
+        ETLSTD::iter_swap(first, nth);
+        return;
+      }
 
-          ETLSTD::advance(itr1, k);
-          ETLSTD::advance(itr2, k + i);
+      --depth_limit;
 
-          if (compare(*itr2, *itr1))
-          {
-            ETLSTD::iter_swap(itr1, itr2);
-          }
-        }
+      TIterator cut = etl::private_algorithm::partition_pivot(first, last, compare);
+
+      if (cut <= nth)
+      {
+        first = cut;
+      }
+      else
+      {
+        last = cut;
       }
     }
+
+    etl::private_algorithm::insertion_sort(first, last, compare);
   }
 
   //***************************************************************************
-  /// Sorts the elements using shell sort.
+  /// Puts the element that would be at 'nth' in a sorted range there.
+  ///<a href="http://en.cppreference.com/w/cpp/algorithm/nth_element"></a>
   ///\ingroup algorithm
   //***************************************************************************
   template <typename TIterator>
-  void sort(TIterator first, TIterator last)
+  void nth_element(TIterator first, TIterator nth, TIterator last)
   {
-    etl::sort(first, last, ETLSTD::less<typename ETLSTD::iterator_traits<TIterator>::value_type>());
+    etl::nth_element(first, nth, last, ETLSTD::less<typename ETLSTD::iterator_traits<TIterator>::value_type>());
   }
 
 #if ETL_CPP11_SUPPORTED
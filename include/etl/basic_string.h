@@ -51,6 +51,7 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "exception.h"
 #include "memory.h"
+#include "private/string_search.h"
 
 #undef ETL_FILE
 #define ETL_FILE "27"
@@ -1115,21 +1116,7 @@ namespace etl
     //*********************************************************************
     size_t find(const ibasic_string<T>& str, size_t pos = 0) const
     {
-      if ((pos + str.size()) > size())
-      {
-        return npos;
-      }
-
-      const_iterator iposition = ETLSTD::search(begin() + pos, end(), str.begin(), str.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return ETLSTD::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1139,23 +1126,7 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos = 0) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s)) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = ETLSTD::search(begin() + pos, end(), s, s + etl::strlen(s));
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return ETLSTD::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1166,23 +1137,7 @@ namespace etl
     //*********************************************************************
     size_t find(const_pointer s, size_t pos, size_t n) const
     {
-#if defined(ETL_DEBUG)
-      if ((pos + etl::strlen(s) - n) > size())
-      {
-        return npos;
-      }
-#endif
-
-      const_iterator iposition = ETLSTD::search(begin() + pos, end(), s, s + n);
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return ETLSTD::distance(begin(), iposition);
-      }
+      return etl::private_string_search::find(p_buffer, size(), pos, s, n);
     }
 
     //*********************************************************************
@@ -1192,16 +1147,14 @@ namespace etl
     //*********************************************************************
     size_t find(T c, size_t position = 0) const
     {
-      const_iterator i = ETLSTD::find(begin() + position, end(), c);
-
-      if (i != end())
-      {
-        return ETLSTD::distance(begin(), i);
-      }
-      else
+      if (position >= size())
       {
         return npos;
       }
+
+      const_pointer p = etl::private_string_search::find_char(p_buffer + position, p_buffer + size(), c);
+
+      return (p == (p_buffer + size())) ? npos : size_t(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1211,28 +1164,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const ibasic_string<T>& str, size_t position = npos) const
     {
-      if ((str.size()) > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator iposition = ETLSTD::search(rbegin() + position, rend(), str.rbegin(), str.rend());
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - str.size() - ETLSTD::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, str.data(), str.size());
     }
 
     //*********************************************************************
@@ -1242,33 +1174,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const_pointer s, size_t position = npos) const
     {
-      size_t len = etl::strlen(s);
-
-      if (len > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + len);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = ETLSTD::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - len - ETLSTD::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, s, etl::strlen(s));
     }
 
     //*********************************************************************
@@ -1278,31 +1184,7 @@ namespace etl
     //*********************************************************************
     size_t rfind(const_pointer s, size_t position, size_t length_) const
     {
-      if (length_ > size())
-      {
-        return npos;
-      }
-
-      if (position >= size())
-      {
-        position = size();
-      }
-
-      position = size() - position;
-
-      const_reverse_iterator srbegin(s + length_);
-      const_reverse_iterator srend(s);
-
-      const_reverse_iterator iposition = ETLSTD::search(rbegin() + position, rend(), srbegin, srend);
-
-      if (iposition == rend())
-      {
-        return npos;
-      }
-      else
-      {
-        return size() - length_ - ETLSTD::distance(rbegin(), iposition);
-      }
+      return etl::private_string_search::rfind(p_buffer, size(), position, s, length_);
     }
 
     //*********************************************************************
@@ -1317,18 +1199,9 @@ namespace etl
         position = size();
       }
 
-      position = size() - position;
-
-      const_reverse_iterator i = ETLSTD::find(rbegin() + position, rend(), c);
+      const_pointer p = etl::private_string_search::find_char_last(p_buffer, p_buffer + position, c);
 
-      if (i != rend())
-      {
-        return size() - ETLSTD::distance(rbegin(), i) - 1;
-      }
-      else
-      {
-        return npos;
-      }
+      return (p == (p_buffer + position)) ? npos : size_t(p - p_buffer);
     }
 
     //*********************************************************************
@@ -1641,21 +1514,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(const_pointer s, size_t position, size_t n) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_first_of(p_buffer, size(), position, s, n, true);
     }
 
     //*********************************************************************
@@ -1665,18 +1524,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_of(value_type c, size_t position = 0) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          if (p_buffer[i] == c)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return find(c, position);
     }
 
     //*********************************************************************
@@ -1707,30 +1555,7 @@ namespace etl
     //*********************************************************************
     size_t find_last_of(const_pointer s, size_t position, size_t n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = ETLSTD::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::find_last_of(p_buffer, size(), position, s, n, true);
     }
 
     //*********************************************************************
@@ -1791,28 +1616,7 @@ namespace etl
     //*********************************************************************
     size_t find_first_not_of(const_pointer s, size_t position, size_t n) const
     {
-      if (position < size())
-      {
-        for (size_t i = position; i < size(); ++i)
-        {
-          bool found = false;
-
-          for (size_t j = 0; j < n; ++j)
-          {
-            if (p_buffer[i] == s[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_first_of(p_buffer, size(), position, s, n, false);
     }
 
     //*********************************************************************
@@ -1864,37 +1668,7 @@ namespace etl
     //*********************************************************************
     size_t find_last_not_of(const_pointer s, size_t position, size_t n) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = ETLSTD::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        for (size_t j = 0; j < n; ++j)
-        {
-          if (p_buffer[position] == s[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::find_last_of(p_buffer, size(), position, s, n, false);
     }
 
     //*********************************************************************
@@ -50,6 +50,14 @@ SOFTWARE.
 #undef ETL_FILE
 #define ETL_FILE "50"
 
+// GCC and Clang builtins compile to single instructions where the target has them.
+// Define ETL_BINARY_NO_BUILTINS to always use the portable versions.
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_BINARY_NO_BUILTINS)
+  #define ETL_BINARY_USE_BUILTINS 1
+#else
+  #define ETL_BINARY_USE_BUILTINS 0
+#endif
+
 namespace etl
 {
   //***************************************************************************
@@ -810,6 +818,9 @@ namespace etl
   //***************************************************************************
   inline uint_least8_t count_bits(uint32_t value)
   {
+#if ETL_BINARY_USE_BUILTINS
+    return uint_least8_t(__builtin_popcountl(value));
+#else
     uint32_t count;
 
     count = value - ((value >> 1) & 0x55555555);
@@ -819,6 +830,7 @@ namespace etl
     count = ((count >> 16) + count) & 0x0000FF;
 
     return uint_least8_t(count);
+#endif
   }
 
   inline uint_least8_t count_bits(int32_t value)
@@ -832,6 +844,9 @@ namespace etl
   //***************************************************************************
   inline uint_least8_t count_bits(uint64_t value)
   {
+#if ETL_BINARY_USE_BUILTINS
+    return uint_least8_t(__builtin_popcountll(value));
+#else
     uint64_t count;
 
     count = value - ((value >> 1) & 0x5555555555555555);
@@ -842,6 +857,7 @@ namespace etl
     count = ((count >> 32) + count) & 0x00000000FFFFFFFF;
 
     return uint_least8_t(count);
+#endif
   }
 
   inline uint_least8_t count_bits(int64_t value)
@@ -1011,11 +1027,18 @@ namespace etl
 
   //***************************************************************************
   /// Count trailing zeros. 32bit.
-  /// Uses a binary search.
+  /// Uses the compiler builtin where available, otherwise a binary search.
   ///\ingroup binary
   //***************************************************************************
   inline uint_least8_t count_trailing_zeros(uint32_t value)
   {
+#if ETL_BINARY_USE_BUILTINS
+    if (value != 0)
+    {
+      return uint_least8_t(__builtin_ctzl(value));
+    }
+#endif
+
     uint_least8_t count;
 
     if (value & 0x1)
@@ -1063,11 +1086,18 @@ namespace etl
 
   //***************************************************************************
   /// Count trailing zeros. 64bit.
-  /// Uses a binary search.
+  /// Uses the compiler builtin where available, otherwise a binary search.
   ///\ingroup binary
   //***************************************************************************
   inline uint_least8_t count_trailing_zeros(uint64_t value)
   {
+#if ETL_BINARY_USE_BUILTINS
+      if (value != 0)
+      {
+        return uint_least8_t(__builtin_ctzll(value));
+      }
+#endif
+
       uint_least8_t count;
 
       if (value & 0x1)
@@ -36,6 +36,8 @@ SOFTWARE.
 #include "etl/integral_limits.h"
 #include "etl/binary.h"
 
+#include "private/bit_stream_unpack.h"
+
 #include "etl/stl/algorithm.h"
 #include "etl/stl/iterator.h"
 
@@ -261,18 +263,7 @@ namespace etl
         // Do we have enough bits?
         if (bits_remaining >= width)
         {
-          value = 0;
-
-          // Get the bits from the stream.
-          while (width != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(ETLSTD::min(width, bits_in_byte));
-            unsigned char chunk = get_chunk(mask_width);
-
-            width -= mask_width;
-            value |= static_cast<T>(chunk) << width;
-          }
-
+          value = static_cast<T>(get_integral(width));
           success = true;
         }
       }
@@ -322,6 +313,206 @@ namespace etl
       return success;
     }
 
+    //***************************************************************************
+    /// Puts a range of integral values to the stream, each 'width' bits wide.
+    /// Nothing is written if there is not room for all of them.
+    //***************************************************************************
+    template <typename TIterator>
+    bool put(TIterator first, TIterator last, uint_least8_t width)
+    {
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        // Do we have enough bits?
+        if (bits_remaining >= (size_t(ETLSTD::distance(first, last)) * width))
+        {
+          while (first != last)
+          {
+            put_value(uint64_t(*first), width);
+            ++first;
+          }
+
+          success = true;
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Gets a range of integral values from the stream, each 'width' bits wide.
+    /// Signed values are sign extended.
+    /// Fields of 1, 2, 4, 8 or 16 bits that start on a char boundary are
+    /// unpacked 16 chars at a time, with SSE2 or NEON where available.
+    /// Nothing is read if the stream does not hold all of them.
+    //***************************************************************************
+    template <typename TIterator>
+    bool get(TIterator first, TIterator last, uint_least8_t width)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type T;
+
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        size_t n = size_t(ETLSTD::distance(first, last));
+
+        // Do we have enough bits?
+        if (bits_remaining >= (n * width))
+        {
+          const bool sign_extend = etl::is_signed<T>::value && (width != (CHAR_BIT * sizeof(T)));
+
+          if (private_bit_stream::is_block_width(width))
+          {
+            // Single fields, up to a char boundary.
+            while ((n != 0U) && (bits_in_byte != 8U))
+            {
+              store_field(first, get_bits(width), width, sign_extend);
+              --n;
+            }
+
+            const size_t block_fields = (private_bit_stream::BLOCK_CHARS * 8U) / width;
+
+            while (n >= block_fields)
+            {
+              if (width == 16U)
+              {
+                uint16_t fields[private_bit_stream::BLOCK_CHARS / 2U];
+                private_bit_stream::unpack_block_16(pdata + byte_index, fields);
+                store_fields(first, fields, block_fields, width, sign_extend);
+              }
+              else
+              {
+                uint8_t fields[private_bit_stream::BLOCK_CHARS * 8U];
+                private_bit_stream::unpack_block(pdata + byte_index, width, fields);
+                store_fields(first, fields, block_fields, width, sign_extend);
+              }
+
+              byte_index     += private_bit_stream::BLOCK_CHARS;
+              bits_remaining -= private_bit_stream::BLOCK_CHARS * 8U;
+              n              -= block_fields;
+            }
+          }
+
+          while (n != 0U)
+          {
+            store_field(first, get_integral(width), width, sign_extend);
+            --n;
+          }
+
+          success = true;
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Puts an integral value to the stream as a variable length LEB128 value.
+    /// Seven bits per char, least significant first, with the top bit set on all
+    /// but the last. Signed values are zig-zag encoded first, so that values
+    /// near zero are short whatever their sign.
+    /// Nothing is written if there is not room for the whole value.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      put_varint(T value)
+    {
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        uint64_t encoded = zigzag_encode(value);
+
+        // Count the chars needed.
+        size_t   chars     = 1U;
+        uint64_t remaining = encoded >> 7;
+
+        while (remaining != 0U)
+        {
+          ++chars;
+          remaining >>= 7;
+        }
+
+        // Do we have enough bits?
+        if (bits_remaining >= (chars * 8U))
+        {
+          while (encoded >= 0x80U)
+          {
+            put_bits((encoded & 0x7FU) | 0x80U, 8U);
+            encoded >>= 7;
+          }
+
+          put_bits(encoded, 8U);
+
+          success = true;
+        }
+      }
+
+      return success;
+    }
+
+    //***************************************************************************
+    /// Gets an integral value that was put with put_varint.
+    /// Fails, and leaves the stream unchanged, if the value is truncated or too
+    /// large for T.
+    //***************************************************************************
+    template <typename T>
+    typename etl::enable_if<etl::is_integral<T>::value, bool>::type
+      get_varint(T& value)
+    {
+      typedef typename etl::make_unsigned<T>::type UT;
+
+      bool success = false;
+
+      if (pdata != nullptr)
+      {
+        const size_t        start_byte_index     = byte_index;
+        const unsigned char start_bits_in_byte   = bits_in_byte;
+        const size_t        start_bits_remaining = bits_remaining;
+
+        uint64_t     encoded = 0U;
+        unsigned int shift   = 0U;
+        bool         more    = true;
+        bool         valid   = true;
+
+        while (more && valid)
+        {
+          if ((bits_remaining < 8U) || (shift >= (CHAR_BIT * sizeof(T))))
+          {
+            valid = false;
+          }
+          else
+          {
+            const uint64_t chunk = get_bits(8U);
+
+            encoded |= (chunk & 0x7FU) << shift;
+            more     = (chunk & 0x80U) != 0U;
+
+            // Bits that do not fit in T.
+            valid = ((shift + 7U) <= (CHAR_BIT * sizeof(T))) || ((chunk & 0x7FU) >> ((CHAR_BIT * sizeof(T)) - shift)) == 0U;
+
+            shift += 7U;
+          }
+        }
+
+        if (valid)
+        {
+          value   = zigzag_decode<T>(UT(encoded));
+          success = true;
+        }
+        else
+        {
+          byte_index     = start_byte_index;
+          bits_in_byte   = start_bits_in_byte;
+          bits_remaining = start_bits_remaining;
+        }
+      }
+
+      return success;
+    }
+
     //***************************************************************************
     /// Returns the number of bytes used in the stream.
     //***************************************************************************
@@ -364,10 +555,22 @@ namespace etl
 
   private:
 
+    // The most bits that put_bits and get_bits handle at once.
+    // With up to seven bits of the current char they fit in 64.
+    static const uint_least8_t MAX_REGISTER_WIDTH = 56U;
+
     //***************************************************************************
     /// For unsigned integral types
     //***************************************************************************
     bool put_integral(uint32_t value, uint_least8_t width)
+    {
+      return put_integral(uint64_t(value), width);
+    }
+
+    //***************************************************************************
+    /// For unsigned integral types. 64bit
+    //***************************************************************************
+    bool put_integral(uint64_t value, uint_least8_t width)
     {
       bool success = false;
 
@@ -376,20 +579,7 @@ namespace etl
         // Do we have enough bits?
         if (bits_remaining >= width)
         {
-          // Send the bits to the stream.
-          while (width != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(ETLSTD::min(width, bits_in_byte));
-            width -= mask_width;
-            uint32_t mask = ((uint32_t(1U) << mask_width) - 1U) << width;
-
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint32_t chunk = ((value & mask) >> width) << (bits_in_byte - mask_width);
-
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
-          }
-
+          put_value(value, width);
           success = true;
         }
       }
@@ -398,78 +588,135 @@ namespace etl
     }
 
     //***************************************************************************
-    /// For unsigned integral types. 64bit
+    /// Put an unsigned integral value to the stream.
+    /// There must be room for 'width' bits.
     //***************************************************************************
-    bool put_integral(uint64_t value, uint_least8_t width)
+    void put_value(uint64_t value, uint_least8_t width)
     {
-      bool success = false;
-
-      if (pdata != nullptr)
+      if (width > MAX_REGISTER_WIDTH)
       {
-        // Do we have enough bits?
-        if (bits_remaining >= width)
-        {
-          // Send the bits to the stream.
-          while (width != 0)
-          {
-            unsigned char mask_width = static_cast<unsigned char>(ETLSTD::min(width, bits_in_byte));
-            width -= mask_width;
-            uint64_t mask = ((uint64_t(1U) << mask_width) - 1U) << width;
-
-            // Move chunk to lowest char bits.
-            // Chunks are never larger than one char.
-            uint64_t chunk = ((value & mask) >> width) << (bits_in_byte - mask_width);
+        put_bits(value >> 32, width - 32U);
+        put_bits(value, 32U);
+      }
+      else
+      {
+        put_bits(value, width);
+      }
+    }
 
-            put_chunk(static_cast<unsigned char>(chunk), mask_width);
-          }
+    //***************************************************************************
+    /// Get an unsigned integral value from the stream.
+    /// There must be at least 'width' bits remaining.
+    //***************************************************************************
+    uint64_t get_integral(uint_least8_t width)
+    {
+      if (width > MAX_REGISTER_WIDTH)
+      {
+        const uint64_t high = get_bits(width - 32U);
 
-          success = true;
-        }
+        return (high << 32) | get_bits(32U);
+      }
+      else
+      {
+        return get_bits(width);
       }
-
-      return success;
     }
 
     //***************************************************************************
-    /// Put a data chunk to the stream
+    /// Put up to MAX_REGISTER_WIDTH bits to the stream.
+    /// The bits already in the current char and the new ones are assembled in
+    /// a register and written out a whole char at a time, in network order.
     //***************************************************************************
-    void put_chunk(unsigned char chunk, unsigned char width)
+    void put_bits(uint64_t value, uint_least8_t width)
     {
-      // Clear if new byte.
-      if (bits_in_byte == 8)
+      const uint_least8_t used = uint_least8_t(8U - bits_in_byte);
+
+      uint64_t register_bits = value & ((uint64_t(1U) << width) - 1U);
+
+      if (used != 0U)
+      {
+        register_bits |= uint64_t(pdata[byte_index] >> bits_in_byte) << width;
+      }
+
+      uint_least8_t total = uint_least8_t(used + width);
+      unsigned char* p    = pdata + byte_index;
+
+      while (total >= 8U)
       {
-        pdata[byte_index] = 0U;
+        total -= 8U;
+        *p++ = static_cast<unsigned char>(register_bits >> total);
       }
 
-      pdata[byte_index] |= chunk;
-      step(width);
+      // The last char is partly filled.
+      if (total != 0U)
+      {
+        *p = static_cast<unsigned char>(register_bits << (8U - total));
+      }
+
+      byte_index      = size_t(p - pdata);
+      bits_in_byte    = static_cast<unsigned char>(8U - total);
+      bits_remaining -= width;
     }
 
     //***************************************************************************
-    /// Get a data chunk from the stream
+    /// Get up to MAX_REGISTER_WIDTH bits from the stream.
+    /// The chars that hold them are read into a register in one pass.
     //***************************************************************************
-    unsigned char get_chunk(unsigned char width)
+    uint64_t get_bits(uint_least8_t width)
     {
-      unsigned char value = pdata[byte_index];
+      const uint_least8_t used  = uint_least8_t(8U - bits_in_byte);
+      const uint_least8_t total = uint_least8_t(used + width);
+      const size_t        chars = (total + 7U) / 8U;
 
-      value >>= (bits_in_byte - width);
+      const unsigned char* p = pdata + byte_index;
 
-      unsigned char mask;
+      uint64_t register_bits = 0U;
 
-      if (width == CHAR_BIT)
+      for (size_t i = 0U; i < chars; ++i)
       {
-        mask = etl::integral_limits<unsigned char>::max;
+        register_bits = (register_bits << 8) | p[i];
       }
-      else
+
+      register_bits >>= (chars * 8U) - total;
+
+      byte_index     += total / 8U;
+      bits_in_byte    = static_cast<unsigned char>(8U - (total % 8U));
+      bits_remaining -= width;
+
+      return register_bits & ((uint64_t(1U) << width) - 1U);
+    }
+
+    //***************************************************************************
+    /// Stores a field through the iterator and moves it on.
+    /// Sign extends the value, if required.
+    //***************************************************************************
+    template <typename TIterator>
+    static void store_field(TIterator& first, uint64_t field, uint_least8_t width, bool sign_extend)
+    {
+      typedef typename ETLSTD::iterator_traits<TIterator>::value_type T;
+
+      T value = static_cast<T>(field);
+
+      if (sign_extend)
       {
-        mask = (1U << width) - 1;
+        typedef typename etl::make_signed<T>::type ST;
+        value = etl::sign_extend<ST, ST>(value, width);
       }
 
-      value &= mask;
-
-      step(width);
+      *first = value;
+      ++first;
+    }
 
-      return value;
+    //***************************************************************************
+    /// Stores 'n' unpacked fields through the iterator and moves it on.
+    //***************************************************************************
+    template <typename TIterator, typename TField>
+    static void store_fields(TIterator& first, const TField* fields, size_t n, uint_least8_t width, bool sign_extend)
+    {
+      for (size_t i = 0U; i < n; ++i)
+      {
+        store_field(first, fields[i], width, sign_extend);
+      }
     }
 
     //***************************************************************************
@@ -484,6 +731,49 @@ namespace etl
       return result;
     }
 
+    //***************************************************************************
+    /// Zig-zag encodes signed values: 0, -1, 1, -2, 2 ... become 0, 1, 2, 3, 4 ...
+    /// Unsigned values are unchanged.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_signed<T>::value, uint64_t>::type
+      zigzag_encode(T value)
+    {
+      typedef typename etl::make_unsigned<T>::type UT;
+
+      const UT sign = (value < 0) ? UT(~UT(0U)) : UT(0U);
+
+      return uint64_t(UT(UT(UT(value) << 1) ^ sign));
+    }
+
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<!etl::is_signed<T>::value, uint64_t>::type
+      zigzag_encode(T value)
+    {
+      return uint64_t(value);
+    }
+
+    //***************************************************************************
+    /// Reverses zigzag_encode.
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<etl::is_signed<T>::value, T>::type
+      zigzag_decode(typename etl::make_unsigned<T>::type value)
+    {
+      typedef typename etl::make_unsigned<T>::type UT;
+
+      return static_cast<T>(UT(UT(value >> 1) ^ UT(UT(0U) - UT(value & 1U))));
+    }
+
+    //***************************************************************************
+    template <typename T>
+    static typename etl::enable_if<!etl::is_signed<T>::value, T>::type
+      zigzag_decode(typename etl::make_unsigned<T>::type value)
+    {
+      return static_cast<T>(value);
+    }
+
     //***************************************************************************
     /// Helper function for floating point types
     //***************************************************************************
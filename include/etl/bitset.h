@@ -119,6 +119,9 @@ namespace etl
   protected:
 
     // The type used for each element in the array.
+    // Define ETL_BITSET_ELEMENT_TYPE as a word sized type, such as uint32_t or
+    // uint64_t, to count, search and shift whole words at a time, at the cost
+    // of rounding every bitset up to a whole number of words.
 #if !defined(ETL_BITSET_ELEMENT_TYPE)
     typedef uint_least8_t element_t;
 #else
@@ -242,6 +245,11 @@ namespace etl
     //*************************************************************************
     bool test(size_t position) const
     {
+      if (position >= NBITS)
+      {
+        return false;
+      }
+
       size_t    index;
       element_t mask;
 
@@ -264,9 +272,12 @@ namespace etl
     //*************************************************************************
     ibitset& set()
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const p = pdata;
+      const size_t     n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] = ALL_SET;
+        p[i] = ALL_SET;
       }
 
       pdata[SIZE - 1] &= TOP_MASK;
@@ -397,24 +408,27 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      T v = T(0);
+      // Built as unsigned, so that no signed value is shifted.
+      typedef typename etl::make_unsigned<T>::type unsigned_t;
+
+      unsigned_t v = unsigned_t(0);
 
-      const bool OK = (sizeof(T) * CHAR_BIT) >= (SIZE * BITS_PER_ELEMENT);
+      const bool OK = (sizeof(T) * CHAR_BIT) >= NBITS;
 
       ETL_ASSERT(OK, ETL_ERROR(etl::bitset_type_too_small));
 
       if (OK)
       {
-        T shift = T(0);
+        size_t shift = 0U;
 
         for (size_t i = 0; i < SIZE; ++i)
         {
-          v |= T(pdata[i]) << shift;
-          shift += T(BITS_PER_ELEMENT);
+          v |= unsigned_t(unsigned_t(pdata[i]) << shift);
+          shift += BITS_PER_ELEMENT;
         }
       }
 
-      return v;
+      return T(v);
     }
 
     //*************************************************************************
@@ -422,9 +436,12 @@ namespace etl
     //*************************************************************************
     ibitset& reset()
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const p = pdata;
+      const size_t     n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] = ALL_CLEAR;
+        p[i] = ALL_CLEAR;
       }
 
       return *this;
@@ -459,9 +476,12 @@ namespace etl
     //*************************************************************************
     ibitset& flip()
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const p = pdata;
+      const size_t     n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] = ~pdata[i];
+        p[i] = element_t(~p[i]);
       }
 
       pdata[SIZE - 1] &= TOP_MASK;
@@ -561,57 +581,66 @@ namespace etl
     //*************************************************************************
     size_t find_next(bool state, size_t position) const
     {
-      // Where to start.
-      size_t index;
-      size_t bit;
-
-      if (SIZE == 1)
+      if (position >= NBITS)
       {
-        index = 0;
-        bit = position;
+        return ibitset::npos;
       }
-      else
+
+      size_t index = position >> etl::log2<BITS_PER_ELEMENT>::value;
+
+      // Searching for a clear bit is a search for a set bit in the inverted element.
+      const element_t invert_mask = state ? ALL_CLEAR : ALL_SET;
+
+      // Ignore the bits below the start position.
+      element_t value = element_t((pdata[index] ^ invert_mask) & element_t(ALL_SET << (position & (BITS_PER_ELEMENT - 1))));
+
+      while (value == ALL_CLEAR)
       {
-        index = position >> log2<BITS_PER_ELEMENT>::value;
-        bit = position & (BITS_PER_ELEMENT - 1);
+        if (++index == SIZE)
+        {
+          return ibitset::npos;
+        }
+
+        value = element_t(pdata[index] ^ invert_mask);
       }
 
-      element_t mask = 1 << bit;
+      position = (index * BITS_PER_ELEMENT) + etl::count_trailing_zeros(value);
 
-      // For each element in the bitset...
-      while (index < SIZE)
+      // The unused bits in the last element are clear, so may be found when searching for a clear bit.
+      return (position < NBITS) ? position : size_t(ibitset::npos);
+    }
+
+    //*************************************************************************
+    /// Finds the next run of bits in the specified state.
+    ///\param state    The state to search for.
+    ///\param length   The number of consecutive bits required.
+    ///\param position The position to start from.
+    ///\returns The position of the first bit of the run or npos if none were found.
+    //*************************************************************************
+    size_t find_next_run(bool state, size_t length, size_t position = 0) const
+    {
+      while (position < NBITS)
       {
-        element_t value = pdata[index];
+        const size_t first = find_next(state, position);
 
-        // Needs checking?
-        if ((state && (value != ALL_CLEAR)) ||
-          (!state && (value != ALL_SET)))
+        if ((first == ibitset::npos) || ((NBITS - first) < length))
         {
-          // For each bit in the element...
-          while ((bit < BITS_PER_ELEMENT) && (position < NBITS))
-          {
-            // Equal to the required state?
-            if (((value & mask) != 0) == state)
-            {
-              return position;
-            }
-
-            // Move on to the next bit.
-            mask <<= 1;
-            ++position;
-            ++bit;
-          }
+          return ibitset::npos;
         }
-        else
+
+        size_t last = find_next(!state, first);
+
+        if (last == ibitset::npos)
         {
-          position += BITS_PER_ELEMENT;
+          last = NBITS;
         }
 
-        // Start at the beginning for all other elements.
-        bit = 0;
-        mask = 1;
+        if ((last - first) >= length)
+        {
+          return first;
+        }
 
-        ++index;
+        position = last;
       }
 
       return ibitset::npos;
@@ -638,9 +667,14 @@ namespace etl
     //*************************************************************************
     ibitset& operator &=(const ibitset& other)
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      // Use locals, as stores through pdata could alias the members, which prevents vectorisation.
+      element_t* const       p = pdata;
+      const element_t* const q = other.pdata;
+      const size_t           n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] &= other.pdata[i];
+        p[i] &= q[i];
       }
 
       return *this;
@@ -651,9 +685,13 @@ namespace etl
     //*************************************************************************
     ibitset& operator |=(const ibitset& other)
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const       p = pdata;
+      const element_t* const q = other.pdata;
+      const size_t           n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] |= other.pdata[i];
+        p[i] |= q[i];
       }
 
       return *this;
@@ -664,9 +702,13 @@ namespace etl
     //*************************************************************************
     ibitset& operator ^=(const ibitset& other)
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const       p = pdata;
+      const element_t* const q = other.pdata;
+      const size_t           n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] ^= other.pdata[i];
+        p[i] ^= q[i];
       }
 
       return *this;
@@ -677,26 +719,48 @@ namespace etl
     //*************************************************************************
     ibitset& operator<<=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
       {
-        pdata[0] <<= shift;
+        return reset();
       }
-      else
-      {
-        size_t source = NBITS - shift - 1;
-        size_t destination = NBITS - 1;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+      element_t* const p             = pdata;
+      const size_t     element_shift = shift >> etl::log2<BITS_PER_ELEMENT>::value;
+      const size_t     bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+
+      // Work down from the top, so that each source element is read before it is overwritten.
+      size_t i = SIZE - 1;
+
+      if (bit_shift == 0)
+      {
+        while (i >= element_shift)
         {
-          set(destination--, test(source--));
-        }
+          p[i] = p[i - element_shift];
 
-        for (size_t i = 0; i < shift; ++i)
+          if (i-- == 0)
+          {
+            break;
+          }
+        }
+      }
+      else
+      {
+        while (i > element_shift)
         {
-          reset(destination--);
+          p[i] = element_t((p[i - element_shift] << bit_shift) | (p[i - element_shift - 1] >> (BITS_PER_ELEMENT - bit_shift)));
+          --i;
         }
+
+        p[element_shift] = element_t(p[0] << bit_shift);
+      }
+
+      for (i = 0; i < element_shift; ++i)
+      {
+        p[i] = ALL_CLEAR;
       }
 
+      p[SIZE - 1] &= TOP_MASK;
+
       return *this;
     }
 
@@ -705,24 +769,36 @@ namespace etl
     //*************************************************************************
     ibitset& operator>>=(size_t shift)
     {
-      if (SIZE == 1)
+      if (shift >= NBITS)
       {
-        pdata[0] >>= shift;
+        return reset();
       }
-      else
-      {
-        size_t source = shift;
-        size_t destination = 0;
 
-        for (size_t i = 0; i < (NBITS - shift); ++i)
+      element_t* const p             = pdata;
+      const size_t     element_shift = shift >> etl::log2<BITS_PER_ELEMENT>::value;
+      const size_t     bit_shift     = shift & (BITS_PER_ELEMENT - 1);
+      const size_t     last          = SIZE - 1 - element_shift;
+
+      if (bit_shift == 0)
+      {
+        for (size_t i = 0; i <= last; ++i)
         {
-          set(destination++, test(source++));
+          p[i] = p[i + element_shift];
         }
-
-        for (size_t i = 0; i < shift; ++i)
+      }
+      else
+      {
+        for (size_t i = 0; i < last; ++i)
         {
-          reset(destination++);
+          p[i] = element_t((p[i + element_shift] >> bit_shift) | (p[i + element_shift + 1] << (BITS_PER_ELEMENT - bit_shift)));
         }
+
+        p[last] = element_t(p[SIZE - 1] >> bit_shift);
+      }
+
+      for (size_t i = last + 1; i < SIZE; ++i)
+      {
+        p[i] = ALL_CLEAR;
       }
 
       return *this;
@@ -786,10 +862,15 @@ namespace etl
     //*************************************************************************
     void invert()
     {
-      for (size_t i = 0; i < SIZE; ++i)
+      element_t* const p = pdata;
+      const size_t     n = SIZE;
+
+      for (size_t i = 0; i < n; ++i)
       {
-        pdata[i] = ~pdata[i];
+        p[i] = element_t(~p[i]);
       }
+
+      pdata[SIZE - 1] &= TOP_MASK;
     }
 
     //*************************************************************************
@@ -979,7 +1060,7 @@ namespace etl
     typename etl::enable_if<etl::is_integral<T>::value, T>::type
       value() const
     {
-      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= (ARRAY_SIZE * BITS_PER_ELEMENT), "Type too small");
+      ETL_STATIC_ASSERT((sizeof(T) * CHAR_BIT) >= MAXN, "Type too small");
 
       return ibitset::value<T>();
     }
@@ -38,6 +38,17 @@ SOFTWARE.
 #include "binary.h"
 #include "log.h"
 #include "power.h"
+#include "static_assert.h"
+#include "private/padding.h"
+
+#include <stdint.h>
+
+// The blocked filter prefetches blocks in its batch lookup where the compiler supports it.
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_BLOOM_FILTER_PREFETCH(p) __builtin_prefetch(p)
+#else
+  #define ETL_BLOOM_FILTER_PREFETCH(p)
+#endif
 
 ///\defgroup bloom_filter bloom_filter
 /// A Bloom filter
@@ -184,6 +195,345 @@ namespace etl
     /// The Bloom filter flags.
     etl::bitset<WIDTH> flags;
   };
+
+  //***************************************************************************
+  /// A blocked Bloom filter.
+  /// All of the probes for a key fall within one cache line sized block, 512
+  /// bits for 64 byte lines, so a lookup touches a single cache line.
+  /// The probes are derived from one hash of the key by enhanced double hashing.
+  /// The hash must support the () operator and define 'argument_type'.
+  ///\tparam DESIRED_WIDTH    The desired number of bits. Rounded up to a power of 2 number of blocks.
+  ///\tparam NUMBER_OF_HASHES The number of bits set for each key.
+  ///\tparam THash            The hash generator class.
+  ///\ingroup bloom_filter
+  //***************************************************************************
+  template <const size_t DESIRED_WIDTH,
+            const size_t NUMBER_OF_HASHES,
+            typename     THash>
+  class blocked_bloom_filter
+  {
+  private:
+
+    typedef typename etl::parameter_type<typename THash::argument_type>::type parameter_t;
+
+    enum
+    {
+      WORD_BITS       = 64,
+      WORDS_PER_BLOCK = ETL_CACHE_LINE_SIZE / 8,
+      DESIRED_BLOCKS  = (DESIRED_WIDTH + (WORD_BITS * WORDS_PER_BLOCK) - 1) / (WORD_BITS * WORDS_PER_BLOCK)
+    };
+
+  public:
+
+    ETL_STATIC_ASSERT((NUMBER_OF_HASHES > 0) && (NUMBER_OF_HASHES <= 16), "Number of hashes must be 1 to 16");
+    ETL_STATIC_ASSERT((WORDS_PER_BLOCK > 0) && ((WORDS_PER_BLOCK & (WORDS_PER_BLOCK - 1)) == 0), "Cache line size must be a power of 2 of at least 8 bytes");
+
+    enum
+    {
+      BLOCK_BITS       = WORD_BITS * WORDS_PER_BLOCK,
+      NUMBER_OF_BLOCKS = (DESIRED_BLOCKS <= 1) ? 1 : etl::power_of_2_round_up<DESIRED_BLOCKS>::value,
+      WIDTH            = NUMBER_OF_BLOCKS * BLOCK_BITS,
+      PREFETCH_DEPTH   = 8
+    };
+
+    //***************************************************************************
+    /// Constructor.
+    //***************************************************************************
+    blocked_bloom_filter()
+      : pblocks(align_blocks())
+    {
+      clear();
+    }
+
+    //***************************************************************************
+    /// Copy constructor.
+    //***************************************************************************
+    blocked_bloom_filter(const blocked_bloom_filter& other)
+      : pblocks(align_blocks())
+    {
+      copy_blocks(other);
+    }
+
+    //***************************************************************************
+    /// Assignment operator.
+    //***************************************************************************
+    blocked_bloom_filter& operator =(const blocked_bloom_filter& other)
+    {
+      if (&other != this)
+      {
+        copy_blocks(other);
+      }
+
+      return *this;
+    }
+
+    //***************************************************************************
+    /// Clears the bloom filter of all entries.
+    //***************************************************************************
+    void clear()
+    {
+      uint64_t* p = pblocks;
+
+      for (size_t i = 0; i < (NUMBER_OF_BLOCKS * WORDS_PER_BLOCK); ++i)
+      {
+        p[i] = 0U;
+      }
+    }
+
+    //***************************************************************************
+    /// Adds a key to the filter.
+    ///\param key The key to add.
+    //***************************************************************************
+    void add(parameter_t key)
+    {
+      const uint64_t hash  = get_hash(key);
+      uint64_t*      block = block_of(hash);
+
+      uint32_t bit  = uint32_t(hash);
+      uint32_t step = probe_step(hash);
+
+      for (size_t i = 0; i < NUMBER_OF_HASHES; ++i)
+      {
+        block[(bit >> 6) & (WORDS_PER_BLOCK - 1U)] |= uint64_t(1U) << (bit & 63U);
+        bit  += step;
+        step += uint32_t(i);
+      }
+    }
+
+    //***************************************************************************
+    /// Tests a key to see if it exists in the filter.
+    ///\param  key The key to test.
+    ///\return <b>true</b> if the key exists in the filter.
+    //***************************************************************************
+    bool exists(parameter_t key) const
+    {
+      return test_hash(get_hash(key));
+    }
+
+    //***************************************************************************
+    /// Tests a range of keys, writing a bool for each to the output.
+    /// The block for each key is prefetched PREFETCH_DEPTH keys before it is tested.
+    ///\param  first The first key.
+    ///\param  last  One past the last key.
+    ///\param  out   The output for the results.
+    ///\return The output iterator, one past the last result.
+    //***************************************************************************
+    template <typename TIterator, typename TOutputIterator>
+    TOutputIterator exists(TIterator first, TIterator last, TOutputIterator out) const
+    {
+      uint64_t pending[PREFETCH_DEPTH];
+      size_t   n = 0;
+
+      // Fill the pipeline.
+      while ((first != last) && (n < PREFETCH_DEPTH))
+      {
+        pending[n] = get_hash(*first);
+        ETL_BLOOM_FILTER_PREFETCH(block_of(pending[n]));
+        ++first;
+        ++n;
+      }
+
+      // Test the oldest key as each new one is prefetched.
+      while (first != last)
+      {
+        const uint64_t hash  = get_hash(*first);
+        const size_t   index = n % PREFETCH_DEPTH;
+
+        ETL_BLOOM_FILTER_PREFETCH(block_of(hash));
+        ++first;
+
+        *out = test_hash(pending[index]);
+        ++out;
+
+        pending[index] = hash;
+        ++n;
+      }
+
+      // Test the keys still waiting.
+      for (size_t i = (n > PREFETCH_DEPTH) ? n - PREFETCH_DEPTH : 0U; i < n; ++i)
+      {
+        *out = test_hash(pending[i % PREFETCH_DEPTH]);
+        ++out;
+      }
+
+      return out;
+    }
+
+    //***************************************************************************
+    /// Returns the width of the Bloom filter.
+    //***************************************************************************
+    size_t width() const
+    {
+      return WIDTH;
+    }
+
+    //***************************************************************************
+    /// Returns the number of bits set for each key.
+    //***************************************************************************
+    size_t number_of_hashes() const
+    {
+      return NUMBER_OF_HASHES;
+    }
+
+    //***************************************************************************
+    /// Returns the percentage of usage. Range 0 to 100.
+    //***************************************************************************
+    size_t usage() const
+    {
+      return size_t((100U * uint64_t(count())) / WIDTH);
+    }
+
+    //***************************************************************************
+    /// Returns the fraction of the filter flags that are set. Range 0 to 1.
+    //***************************************************************************
+    double fill_ratio() const
+    {
+      return double(count()) / double(WIDTH);
+    }
+
+    //***************************************************************************
+    /// Returns the estimated false positive rate for the current contents.
+    /// An absent key passes if all of its probes hit set flags in its block,
+    /// so the estimate is the mean over the blocks of (block fill ratio)^k.
+    //***************************************************************************
+    double false_positive_rate() const
+    {
+      const uint64_t* p = pblocks;
+      double total = 0.0;
+
+      for (size_t b = 0; b < NUMBER_OF_BLOCKS; ++b)
+      {
+        size_t n = 0;
+
+        for (size_t i = 0; i < WORDS_PER_BLOCK; ++i)
+        {
+          n += etl::count_bits(*p++);
+        }
+
+        const double fill = double(n) / double(BLOCK_BITS);
+        double       rate = 1.0;
+
+        for (size_t i = 0; i < NUMBER_OF_HASHES; ++i)
+        {
+          rate *= fill;
+        }
+
+        total += rate;
+      }
+
+      return total / double(NUMBER_OF_BLOCKS);
+    }
+
+    //***************************************************************************
+    /// Returns the number of filter flags set.
+    //***************************************************************************
+    size_t count() const
+    {
+      const uint64_t* p = pblocks;
+      size_t n = 0;
+
+      for (size_t i = 0; i < (NUMBER_OF_BLOCKS * WORDS_PER_BLOCK); ++i)
+      {
+        n += etl::count_bits(p[i]);
+      }
+
+      return n;
+    }
+
+  private:
+
+    //***************************************************************************
+    /// Gets the 64 bit hash for the key.
+    /// The user hash is mixed so that weak hashes, such as the identity, still
+    /// spread over the blocks and bits.
+    //***************************************************************************
+    static uint64_t get_hash(parameter_t key)
+    {
+      uint64_t hash = uint64_t(THash()(key));
+
+      hash ^= hash >> 33;
+      hash *= 0xFF51AFD7ED558CCDULL;
+      hash ^= hash >> 33;
+      hash *= 0xC4CEB9FE1A85EC53ULL;
+      hash ^= hash >> 33;
+
+      return hash;
+    }
+
+    //***************************************************************************
+    /// The block for a hash is selected by the top 32 bits.
+    //***************************************************************************
+    uint64_t* block_of(uint64_t hash) const
+    {
+      const size_t index = size_t(((hash >> 32) * NUMBER_OF_BLOCKS) >> 32);
+
+      return pblocks + (index * WORDS_PER_BLOCK);
+    }
+
+    //***************************************************************************
+    /// The initial step between probes.
+    /// The probes use enhanced double hashing, where the step grows with each
+    /// probe, as plain double hashing puts keys with the same step on the same
+    /// stride and raises the false positive rate.
+    //***************************************************************************
+    static uint32_t probe_step(uint64_t hash)
+    {
+      return (uint32_t(hash) >> 9) | 1U;
+    }
+
+    //***************************************************************************
+    /// Tests the probes for a hash.
+    //***************************************************************************
+    bool test_hash(uint64_t hash) const
+    {
+      const uint64_t* block = block_of(hash);
+
+      uint32_t bit  = uint32_t(hash);
+      uint32_t step = probe_step(hash);
+
+      // The block is already in the cache, so testing every probe is cheaper
+      // than a hard to predict early exit.
+      uint64_t result = 1U;
+
+      for (size_t i = 0; i < NUMBER_OF_HASHES; ++i)
+      {
+        result &= block[(bit >> 6) & (WORDS_PER_BLOCK - 1U)] >> (bit & 63U);
+        bit  += step;
+        step += uint32_t(i);
+      }
+
+      return (result & 1U) != 0U;
+    }
+
+    //***************************************************************************
+    /// Returns the first cache line boundary in the storage.
+    //***************************************************************************
+    uint64_t* align_blocks()
+    {
+      const uintptr_t address = reinterpret_cast<uintptr_t>(storage);
+      const uintptr_t aligned = (address + (ETL_CACHE_LINE_SIZE - 1U)) & ~uintptr_t(ETL_CACHE_LINE_SIZE - 1U);
+
+      return reinterpret_cast<uint64_t*>(aligned);
+    }
+
+    //***************************************************************************
+    /// Copies the flags from another filter.
+    //***************************************************************************
+    void copy_blocks(const blocked_bloom_filter& other)
+    {
+      const uint64_t* source      = other.pblocks;
+      uint64_t*       destination = pblocks;
+
+      for (size_t i = 0; i < (NUMBER_OF_BLOCKS * WORDS_PER_BLOCK); ++i)
+      {
+        destination[i] = source[i];
+      }
+    }
+
+    /// The storage has one extra block so that the flags can start on a cache line.
+    uint64_t  storage[(NUMBER_OF_BLOCKS + 1) * WORDS_PER_BLOCK];
+    uint64_t* pblocks;
+  };
 }
 
 #endif
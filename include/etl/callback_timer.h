@@ -38,6 +38,7 @@ SOFTWARE.
 #include "function.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "private/timer_wheel.h"
 #include "atomic.h"
 
 #undef ETL_FILE
@@ -422,7 +423,7 @@ namespace etl
           if (timer.is_active())
           {
             ETL_DISABLE_TIMER_UPDATES;
-            active_list.remove(timer.id, false);
+            remove_active(timer.id);
             ETL_ENABLE_TIMER_UPDATES;
           }
 
@@ -460,6 +461,11 @@ namespace etl
     {
       ETL_DISABLE_TIMER_UPDATES;
       active_list.clear();
+
+      if (p_wheel != nullptr)
+      {
+        p_wheel->clear();
+      }
       ETL_ENABLE_TIMER_UPDATES;
 
       for (int i = 0; i < MAX_TIMERS; ++i)
@@ -482,6 +488,20 @@ namespace etl
       {
         if (ETL_TIMER_UPDATES_ENABLED)
         {
+          if (p_wheel != nullptr)
+          {
+            // Expire the timers that are due now, then step through the elapsed time.
+            expire_wheel_timers();
+
+            while (count > 0)
+            {
+              count -= p_wheel->advance(count);
+              expire_wheel_timers();
+            }
+
+            return true;
+          }
+
           // We have something to do?
           bool has_active = !active_list.empty();
 
@@ -554,11 +574,10 @@ namespace etl
             ETL_DISABLE_TIMER_UPDATES;
             if (timer.is_active())
             {
-              active_list.remove(timer.id, false);
+              remove_active(timer.id);
             }
 
-            timer.delta = immediate_ ? 0 : timer.period;
-            active_list.insert(timer.id);
+            insert_active(timer.id, immediate_ ? 0 : timer.period);
             ETL_ENABLE_TIMER_UPDATES;
 
             result = true;
@@ -587,7 +606,7 @@ namespace etl
           if (timer.is_active())
           {
             ETL_DISABLE_TIMER_UPDATES;
-            active_list.remove(timer.id, false);
+            remove_active(timer.id);
             ETL_ENABLE_TIMER_UPDATES;
           }
 
@@ -631,9 +650,12 @@ namespace etl
     //*******************************************
     /// Constructor.
     //*******************************************
-    icallback_timer(callback_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+    icallback_timer(callback_timer_data* const timer_array_,
+                    const uint_least8_t  MAX_TIMERS_,
+                    private_timer::timer_wheel<callback_timer_data>* const p_wheel_ = nullptr)
       : timer_array(timer_array_),
         active_list(timer_array_),
+        p_wheel(p_wheel_),
         enabled(false),
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
         process_semaphore(0),
@@ -645,12 +667,82 @@ namespace etl
 
   private:
 
+    //*******************************************
+    /// Adds a timer to the active timers.
+    //*******************************************
+    void insert_active(etl::timer::id::type id_, uint32_t delay)
+    {
+      if (p_wheel != nullptr)
+      {
+        p_wheel->insert(id_, delay);
+      }
+      else
+      {
+        timer_array[id_].delta = delay;
+        active_list.insert(id_);
+      }
+    }
+
+    //*******************************************
+    /// Removes a timer from the active timers.
+    //*******************************************
+    void remove_active(etl::timer::id::type id_)
+    {
+      if (p_wheel != nullptr)
+      {
+        p_wheel->remove(id_);
+      }
+      else
+      {
+        active_list.remove(id_, false);
+      }
+    }
+
+    //*******************************************
+    /// Expires the timers in the wheel that are due now.
+    //*******************************************
+    void expire_wheel_timers()
+    {
+      etl::timer::id::type id = p_wheel->front();
+
+      while (id != etl::timer::id::NO_TIMER)
+      {
+        callback_timer_data& timer = timer_array[id];
+
+        p_wheel->remove(id);
+
+        if (timer.repeating)
+        {
+          p_wheel->insert(id, timer.period);
+        }
+
+        if (timer.p_callback != nullptr)
+        {
+          if (timer.has_c_callback)
+          {
+            // Call the C callback.
+            reinterpret_cast<void(*)()>(timer.p_callback)();
+          }
+          else
+          {
+            // Call the function wrapper callback.
+            (*reinterpret_cast<etl::ifunction<void>*>(timer.p_callback))();
+          }
+        }
+
+        id = p_wheel->front();
+      }
+    }
+
     // The array of timer data structures.
     callback_timer_data* const timer_array;
 
     // The list of active timers.
     private_callback_timer::list active_list;
 
+    // The wheel of active timers, if used instead of the list.
+    private_timer::timer_wheel<callback_timer_data>* const p_wheel;
+
     volatile bool enabled;
 #if defined(ETL_CALLBACK_TIMER_USE_ATOMIC_LOCK)
     volatile etl::timer_semaphore_t process_semaphore;
@@ -664,8 +756,10 @@ namespace etl
 
   //***************************************************************************
   /// The callback timer
+  ///\tparam MAX_TIMERS_ The maximum number of timers. No more than 254.
+  ///\tparam TScheduler  etl::timer::scheduler::delta_list or etl::timer::scheduler::wheel.
   //***************************************************************************
-  template <const uint_least8_t MAX_TIMERS_>
+  template <const uint_least8_t MAX_TIMERS_, typename TScheduler = etl::timer::scheduler::delta_list>
   class callback_timer : public etl::icallback_timer
   {
   public:
@@ -684,6 +778,32 @@ namespace etl
 
     callback_timer_data timer_array[MAX_TIMERS_];
   };
+
+  //***************************************************************************
+  /// The callback timer, using a timing wheel.
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_>
+  class callback_timer<MAX_TIMERS_, etl::timer::scheduler::wheel> : public etl::icallback_timer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    callback_timer()
+      : icallback_timer(timer_array, MAX_TIMERS_, &wheel),
+        wheel(timer_array, slot_ids)
+    {
+    }
+
+  private:
+
+    callback_timer_data timer_array[MAX_TIMERS_];
+    uint_least16_t slot_ids[MAX_TIMERS_];
+    private_timer::timer_wheel<callback_timer_data> wheel;
+  };
 }
 
 #undef ETL_DISABLE_TIMER_UPDATES
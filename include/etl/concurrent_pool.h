@@ -0,0 +1,515 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CONCURRENT_POOL_INCLUDED
+#define ETL_CONCURRENT_POOL_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "pool.h"
+#include "atomic.h"
+#include "alignment.h"
+#include "static_assert.h"
+#include "private/padding.h"
+
+///\defgroup concurrent_pool concurrent_pool
+/// A fixed capacity pool that may be shared between threads.
+/// The free items are held in a lock free Treiber stack. The head is a 32 bit
+/// item index with a 32 bit tag that changes on every update, so a stale
+/// compare-and-swap cannot succeed after the head has been popped and pushed
+/// back (the ABA problem).
+/// Optionally, each thread has a small cache of free items that it refills
+/// from, and drains to, the shared stack in batches.
+/// The pool is used through the etl::ipool interface, so containers with
+/// shared pools may use it unchanged. The containers themselves are not
+/// thread safe; each must only be used by one thread at a time.
+///\ingroup pool
+
+#if ETL_HAS_ATOMIC
+
+namespace etl
+{
+  namespace private_pool
+  {
+    //*************************************************************************
+    /// Returns a small number unique to the calling thread.
+    /// Used to choose the thread's item cache.
+    //*************************************************************************
+#if ETL_CPP11_SUPPORTED
+    inline uint32_t thread_index()
+    {
+      static etl::atomic<uint32_t> next_index(0U);
+
+      // Constant initialised, so that access needs no guard.
+      static thread_local uint32_t index = 0xFFFFFFFFUL;
+
+      if (index == 0xFFFFFFFFUL)
+      {
+        index = next_index.fetch_add(1U, etl::memory_order_relaxed);
+      }
+
+      return index;
+    }
+#endif
+  }
+
+  //***************************************************************************
+  /// A pool of items that may be allocated and released by any thread.
+  ///\tparam TYPE_SIZE_  The size of the items.
+  ///\tparam ALIGNMENT_  The alignment of the items.
+  ///\tparam SIZE_       The number of items.
+  ///\tparam CACHE_SIZE_ The number of free items each thread may keep. Zero for none. Requires C++11.
+  ///\tparam CACHES_     The number of thread caches. Threads beyond this share a cache.
+  ///\ingroup concurrent_pool
+  //***************************************************************************
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_, const size_t CACHE_SIZE_ = 0U, const size_t CACHES_ = 16U>
+  class generic_concurrent_pool : private etl::private_pool::ishared_free_list, public etl::ipool
+  {
+  public:
+
+    static const size_t SIZE       = SIZE_;
+    static const size_t ALIGNMENT  = ALIGNMENT_;
+    static const size_t TYPE_SIZE  = TYPE_SIZE_;
+    static const size_t CACHE_SIZE = CACHE_SIZE_;
+    static const size_t CACHES     = CACHES_;
+
+    ETL_STATIC_ASSERT((SIZE_ > 0U) && (SIZE_ < 0xFFFFFFFFUL), "Pool size must be 1 to 2^32 - 2");
+    ETL_STATIC_ASSERT((CACHE_SIZE_ == 0U) || (CACHES_ > 0U), "There must be at least one cache");
+#if !ETL_CPP11_SUPPORTED
+    ETL_STATIC_ASSERT(CACHE_SIZE_ == 0U, "Thread caches require C++11");
+#endif
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    generic_concurrent_pool()
+      : etl::ipool(reinterpret_cast<char*>(&buffer[0]), ELEMENT_SIZE, SIZE, this)
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// Allocate an object from the pool.
+    /// If asserts or exceptions are enabled and there are no more free items an
+    /// etl::pool_no_allocation if thrown, otherwise a nullptr is returned.
+    /// Static asserts if the specified type is too large for the pool.
+    //*************************************************************************
+    template <typename U>
+    U* allocate()
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      return ipool::allocate<U>();
+    }
+
+    //*************************************************************************
+    /// Destroys the object.
+    /// Undefined behaviour if the pool does not contain a 'U'.
+    /// \param p_object A pointer to the object to be destroyed.
+    //*************************************************************************
+    template <typename U>
+    void destroy(const void* const p_object)
+    {
+      ETL_STATIC_ASSERT(etl::alignment_of<U>::value <= ALIGNMENT_, "Type has incompatible alignment");
+      ETL_STATIC_ASSERT(sizeof(U) <= TYPE_SIZE, "Type too large for pool");
+      reinterpret_cast<U*>((const_cast<void*>(p_object)))->~U();
+      ipool::release(p_object);
+    }
+
+  private:
+
+    enum
+    {
+      CACHE_LINE_SIZE = ETL_CACHE_LINE_SIZE,
+      REFILL_COUNT    = (CACHE_SIZE_ + 1U) / 2U,
+      DRAIN_COUNT     = (CACHE_SIZE_ + 1U) / 2U
+    };
+
+    static const uint32_t NO_ITEM = 0xFFFFFFFFUL;
+
+    // The pool element.
+    union Element
+    {
+      char*     next;              ///< Pointer to the next free element.
+      char      value[TYPE_SIZE_]; ///< Storage for value type.
+      typename  etl::type_with_alignment<ALIGNMENT_>::type dummy; ///< Dummy item to get correct alignment.
+    };
+
+    static const uint32_t ELEMENT_SIZE = sizeof(Element);
+
+    //*************************************************************************
+    /// A thread's cache of free items.
+    /// The lock is only contended when more threads than caches use the pool,
+    /// or when another thread takes items from it because the pool is empty.
+    //*************************************************************************
+    struct cache_t
+    {
+      etl::atomic<uint32_t> locked;
+      etl::atomic<uint32_t> count;
+      uint32_t              items[(CACHE_SIZE_ == 0U) ? 1U : CACHE_SIZE_];
+
+      private_padding::padding<CACHE_LINE_SIZE> padding;
+    };
+
+    //*************************************************************************
+    /// Allocates an item from the calling thread's cache, refilling it from
+    /// the shared stack if it is empty.
+    //*************************************************************************
+    char* shared_allocate()
+    {
+      uint32_t index = NO_ITEM;
+
+#if ETL_CPP11_SUPPORTED
+      if (CACHE_SIZE_ > 0U)
+      {
+        cache_t& cache = caches[private_pool::thread_index() % CACHES_];
+
+        if (try_lock(cache))
+        {
+          uint32_t n      = cache.count.load(etl::memory_order_relaxed);
+          uint32_t popped = 0U;
+
+          if (n == 0U)
+          {
+            popped = pop(cache.items, REFILL_COUNT);
+            n      = popped;
+          }
+
+          if (n != 0U)
+          {
+            --n;
+            index = cache.items[n];
+          }
+
+          cache.count.store(n, etl::memory_order_relaxed);
+          shared_count.fetch_sub(popped, etl::memory_order_relaxed);
+          unlock(cache);
+        }
+      }
+#endif
+
+      if ((index == NO_ITEM) && (pop(&index, 1U) != 0U))
+      {
+        shared_count.fetch_sub(1U, etl::memory_order_relaxed);
+      }
+
+      if ((index == NO_ITEM) && (CACHE_SIZE_ > 0U))
+      {
+        index = take_from_caches();
+      }
+
+      return (index == NO_ITEM) ? nullptr : reinterpret_cast<char*>(&buffer[index]);
+    }
+
+    //*************************************************************************
+    /// Releases an item to the calling thread's cache, draining the oldest
+    /// half of the cache to the shared stack if it is full.
+    //*************************************************************************
+    void shared_release(char* p_value)
+    {
+      uint32_t index = uint32_t((p_value - reinterpret_cast<char*>(&buffer[0])) / ELEMENT_SIZE);
+
+#if ETL_CPP11_SUPPORTED
+      if (CACHE_SIZE_ > 0U)
+      {
+        cache_t& cache = caches[private_pool::thread_index() % CACHES_];
+
+        if (try_lock(cache))
+        {
+          uint32_t n = cache.count.load(etl::memory_order_relaxed);
+
+          if (n == CACHE_SIZE_)
+          {
+            push(cache.items, DRAIN_COUNT);
+
+            for (uint32_t i = DRAIN_COUNT; i < n; ++i)
+            {
+              cache.items[i - DRAIN_COUNT] = cache.items[i];
+            }
+
+            n -= DRAIN_COUNT;
+          }
+
+          cache.items[n] = index;
+          cache.count.store(n + 1U, etl::memory_order_relaxed);
+          unlock(cache);
+
+          return;
+        }
+      }
+#endif
+
+      push(&index, 1U);
+    }
+
+    //*************************************************************************
+    /// Returns all items to the pool.
+    /// Must not be called while other threads are using the pool.
+    //*************************************************************************
+    void shared_release_all()
+    {
+      initialise();
+    }
+
+    //*************************************************************************
+    /// The number of allocated items.
+    /// Due to concurrency, this is a guess. Items moving between the caches and
+    /// the shared stack may briefly be counted twice, but never as allocated.
+    //*************************************************************************
+    size_t shared_size() const
+    {
+      size_t free_items = shared_count.load(etl::memory_order_relaxed);
+
+      if (CACHE_SIZE_ > 0U)
+      {
+        for (size_t i = 0U; i < CACHES_; ++i)
+        {
+          free_items += caches[i].count.load(etl::memory_order_relaxed);
+        }
+      }
+
+      return (free_items > SIZE_) ? 0U : SIZE_ - free_items;
+    }
+
+    //*************************************************************************
+    /// Links every item into the shared stack and empties the caches.
+    //*************************************************************************
+    void initialise()
+    {
+      for (uint32_t i = 0U; i < SIZE_; ++i)
+      {
+        next_free[i].store((i + 1U) < SIZE_ ? i + 1U : NO_ITEM, etl::memory_order_relaxed);
+      }
+
+      for (size_t i = 0U; i < CACHE_COUNT; ++i)
+      {
+        caches[i].locked.store(0U, etl::memory_order_relaxed);
+        caches[i].count.store(0U, etl::memory_order_relaxed);
+      }
+
+      shared_count.store(uint32_t(SIZE_), etl::memory_order_relaxed);
+      head.store(0U, etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Pops up to 'count' items from the shared stack with one compare-and-swap.
+    /// Returns the number popped.
+    /// The caller reduces the shared count once the items are accounted for
+    /// elsewhere, so that size() never counts free items as allocated.
+    //*************************************************************************
+    uint32_t pop(uint32_t* items, uint32_t count)
+    {
+      uint64_t old_head = head.load(etl::memory_order_acquire);
+
+      while (true)
+      {
+        uint32_t index = uint32_t(old_head);
+        uint32_t n     = 0U;
+
+        // The links below the head cannot change unless the head does, which the tag detects.
+        while ((index != NO_ITEM) && (n < count))
+        {
+          items[n++] = index;
+          index = next_free[index].load(etl::memory_order_relaxed);
+        }
+
+        if (n == 0U)
+        {
+          return 0U;
+        }
+
+        uint64_t new_head = (next_tag(old_head)) | index;
+
+        if (head.compare_exchange_weak(old_head, new_head, etl::memory_order_acquire, etl::memory_order_acquire))
+        {
+          return n;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Pushes 'count' items to the shared stack with one compare-and-swap.
+    //*************************************************************************
+    void push(const uint32_t* items, uint32_t count)
+    {
+      const uint32_t last = items[count - 1U];
+
+      for (uint32_t i = 1U; i < count; ++i)
+      {
+        next_free[items[i - 1U]].store(items[i], etl::memory_order_relaxed);
+      }
+
+      // Counted before they are visible, so that size() never counts free items as allocated.
+      shared_count.fetch_add(count, etl::memory_order_relaxed);
+
+      uint64_t old_head = head.load(etl::memory_order_relaxed);
+      uint64_t new_head;
+
+      do
+      {
+        next_free[last].store(uint32_t(old_head), etl::memory_order_relaxed);
+        new_head = next_tag(old_head) | items[0];
+      } while (!head.compare_exchange_weak(old_head, new_head, etl::memory_order_release, etl::memory_order_relaxed));
+    }
+
+    //*************************************************************************
+    /// Takes a free item from any cache when the shared stack is empty.
+    //*************************************************************************
+    uint32_t take_from_caches()
+    {
+      for (size_t i = 0U; i < CACHE_COUNT; ++i)
+      {
+        cache_t& cache = caches[i];
+
+        if (cache.count.load(etl::memory_order_relaxed) != 0U)
+        {
+          // Only one cache lock is held at a time, so this cannot deadlock.
+          lock(cache);
+
+          uint32_t n     = cache.count.load(etl::memory_order_relaxed);
+          uint32_t index = NO_ITEM;
+
+          if (n != 0U)
+          {
+            --n;
+            index = cache.items[n];
+            cache.count.store(n, etl::memory_order_relaxed);
+          }
+
+          unlock(cache);
+
+          if (index != NO_ITEM)
+          {
+            return index;
+          }
+        }
+      }
+
+      // Items may have been drained to the shared stack while the caches were searched.
+      uint32_t index = NO_ITEM;
+
+      if (pop(&index, 1U) != 0U)
+      {
+        shared_count.fetch_sub(1U, etl::memory_order_relaxed);
+      }
+
+      return index;
+    }
+
+    //*************************************************************************
+    /// The head with the tag advanced and the index cleared.
+    //*************************************************************************
+    static uint64_t next_tag(uint64_t head_value)
+    {
+      return ((head_value >> 32) + 1U) << 32;
+    }
+
+    //*************************************************************************
+    static bool try_lock(cache_t& cache)
+    {
+      return cache.locked.exchange(1U, etl::memory_order_acquire) == 0U;
+    }
+
+    //*************************************************************************
+    static void lock(cache_t& cache)
+    {
+      while (!try_lock(cache))
+      {
+      }
+    }
+
+    //*************************************************************************
+    static void unlock(cache_t& cache)
+    {
+      cache.locked.store(0U, etl::memory_order_release);
+    }
+
+    enum
+    {
+      CACHE_COUNT = (CACHE_SIZE_ == 0U) ? 0U : CACHES_
+    };
+
+    ///< The memory for the pool of objects.
+    typename etl::aligned_storage<sizeof(Element), etl::alignment_of<Element>::value>::type buffer[SIZE_];
+
+    /// The index of the next free item for each item on the shared stack.
+    /// Kept apart from the items so that a stale read never races with the new owner's writes.
+    etl::atomic<uint32_t> next_free[SIZE_];
+
+    private_padding::padding<CACHE_LINE_SIZE> padding1;
+
+    etl::atomic<uint64_t> head;         ///< The tag in the top 32 bits, the index of the top item in the bottom 32.
+    etl::atomic<uint32_t> shared_count; ///< The number of items on the shared stack.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding2;
+
+    cache_t caches[(CACHE_SIZE_ == 0U) ? 1U : CACHES_];
+
+    // Should not be copied.
+    generic_concurrent_pool(const generic_concurrent_pool&);
+    generic_concurrent_pool& operator =(const generic_concurrent_pool&);
+  };
+
+  template <const size_t TYPE_SIZE_, const size_t ALIGNMENT_, const size_t SIZE_, const size_t CACHE_SIZE_, const size_t CACHES_>
+  const uint32_t generic_concurrent_pool<TYPE_SIZE_, ALIGNMENT_, SIZE_, CACHE_SIZE_, CACHES_>::NO_ITEM;
+
+  //*************************************************************************
+  /// A pool of 'T' that may be allocated and released by any thread.
+  ///\tparam T          The type of the items.
+  ///\tparam SIZE_      The number of items.
+  ///\tparam CACHE_SIZE The number of free items each thread may keep. Zero for none. Requires C++11.
+  ///\tparam CACHES     The number of thread caches. Threads beyond this share a cache.
+  ///\ingroup concurrent_pool
+  //*************************************************************************
+  template <typename T, const size_t SIZE_, const size_t CACHE_SIZE = 0U, const size_t CACHES = 16U>
+  class concurrent_pool : public etl::generic_concurrent_pool<sizeof(T), etl::alignment_of<T>::value, SIZE_, CACHE_SIZE, CACHES>
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor
+    //*************************************************************************
+    concurrent_pool()
+    {
+    }
+
+  private:
+
+    // Should not be copied.
+    concurrent_pool(const concurrent_pool&);
+    concurrent_pool& operator =(const concurrent_pool&);
+  };
+}
+
+#endif
+
+#endif
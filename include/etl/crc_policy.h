@@ -0,0 +1,171 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_POLICY_INCLUDED
+#define ETL_CRC_POLICY_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "frame_check_sequence.h"
+#include "smallest.h"
+#include "binary.h"
+#include "static_assert.h"
+#include "private/crc_implementation.h"
+
+///\defgroup crc_policy Parameterised CRC calculation
+/// Any CRC of up to 64 bits, described by the Rocksoft model parameters.
+/// The lookup tables are generated at compile time.
+///\ingroup crc
+
+namespace etl
+{
+  //***************************************************************************
+  /// CRC policy.
+  ///\tparam WIDTH       The width of the CRC in bits. 1 to 64.
+  ///\tparam POLYNOMIAL  The polynomial in normal form, without the top bit.
+  ///\tparam INITIAL     The initial register value.
+  ///\tparam REFLECT_IN  true if input bytes are reflected.
+  ///\tparam REFLECT_OUT true if the result is reflected.
+  ///\tparam XOR_OUT     The value XORed with the result.
+  ///\tparam TABLE_BITS  8 for 256 entry tables, 4 for a single 16 entry table.
+  ///\ingroup crc_policy
+  //***************************************************************************
+  template <const size_t WIDTH,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type POLYNOMIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type INITIAL,
+            const bool REFLECT_IN,
+            const bool REFLECT_OUT,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type XOR_OUT,
+            const size_t TABLE_BITS = ETL_CRC_TABLE_BITS>
+  struct crc_policy
+  {
+    typedef typename etl::smallest_uint_for_bits<WIDTH>::type value_type;
+
+    ETL_STATIC_ASSERT((WIDTH > 0U) && (WIDTH <= 64U), "CRC width must be 1 to 64 bits");
+    ETL_STATIC_ASSERT((TABLE_BITS == 4U) || (TABLE_BITS == 8U), "Table bits must be 4 or 8");
+
+    static const size_t     width      = WIDTH;
+    static const size_t     table_bits = TABLE_BITS;
+    static const value_type polynomial = POLYNOMIAL;
+
+  private:
+
+    // The register is a whole number of bytes.
+    // Widths that are not a multiple of 8 are left aligned in it.
+    static const size_t     REGISTER_WIDTH      = ((WIDTH + 7U) / 8U) * 8U;
+    static const size_t     REGISTER_SHIFT      = REGISTER_WIDTH - WIDTH;
+    static const value_type REGISTER_POLYNOMIAL = value_type(POLYNOMIAL << REGISTER_SHIFT);
+    static const value_type MASK                = etl::private_crc::crc_mask<value_type, WIDTH>::value;
+
+    typedef etl::private_crc::crc_table_engine<value_type, REGISTER_WIDTH, REGISTER_POLYNOMIAL, REFLECT_IN, TABLE_BITS> engine_t;
+
+  public:
+
+    inline value_type initial() const
+    {
+      return REFLECT_IN ? value_type(etl::private_crc::crc_reflect<value_type, INITIAL, WIDTH>::value)
+                        : value_type(INITIAL << REGISTER_SHIFT);
+    }
+
+    inline value_type add(value_type crc, uint8_t value) const
+    {
+      return engine_t::add(crc, value);
+    }
+
+    inline value_type add(value_type crc, const uint8_t* begin, const uint8_t* end) const
+    {
+      return engine_t::add(crc, begin, end);
+    }
+
+    inline value_type final(value_type crc) const
+    {
+      if ETL_IF_CONSTEXPR(!REFLECT_IN)
+      {
+        crc = value_type(crc >> REGISTER_SHIFT);
+      }
+
+      if ETL_IF_CONSTEXPR(REFLECT_IN != REFLECT_OUT)
+      {
+        crc = value_type(etl::reverse_bits(crc) >> ((sizeof(value_type) * CHAR_BIT) - WIDTH));
+      }
+
+      return value_type((crc ^ XOR_OUT) & MASK);
+    }
+  };
+
+  //***************************************************************************
+  /// crc_policy processes contiguous blocks.
+  ///\ingroup crc_policy
+  //***************************************************************************
+  template <const size_t WIDTH,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type POLYNOMIAL,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type INITIAL,
+            const bool REFLECT_IN,
+            const bool REFLECT_OUT,
+            const typename etl::smallest_uint_for_bits<WIDTH>::type XOR_OUT,
+            const size_t TABLE_BITS>
+  struct frame_check_sequence_has_block_add<etl::crc_policy<WIDTH, POLYNOMIAL, INITIAL, REFLECT_IN, REFLECT_OUT, XOR_OUT, TABLE_BITS> > : public etl::true_type
+  {
+  };
+
+  //*************************************************************************
+  /// CRC calculator for a policy.
+  ///\ingroup crc_policy
+  //*************************************************************************
+  template <typename TPolicy>
+  class crc_type : public etl::frame_check_sequence<TPolicy>
+  {
+  public:
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    crc_type()
+    {
+      this->reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    //*************************************************************************
+    template<typename TIterator>
+    crc_type(TIterator begin, const TIterator end)
+    {
+      this->reset();
+      this->add(begin, end);
+    }
+  };
+}
+
+#endif
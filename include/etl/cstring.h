@@ -236,7 +236,7 @@ namespace etl
   {
     size_t operator()(const etl::istring& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -246,7 +246,7 @@ namespace etl
   {
     size_t operator()(const etl::string<SIZE>& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -0,0 +1,60 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_COUNT_INCLUDED
+#define ETL_EVENT_COUNT_INCLUDED
+
+#include "platform.h"
+
+///\defgroup event_count Event count
+/// Lets threads block until a condition becomes true, without polling.
+/// A waiter passes the condition to 'wait_for' with a timeout; a thread that
+/// makes the condition true calls 'notify_one' or 'notify_all'.
+///\ingroup mutex
+
+// On Linux the event count uses a futex.
+// Define ETL_EVENT_COUNT_NO_FUTEX to use the std::condition_variable version instead.
+#if defined(ETL_TARGET_OS_LINUX) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_EVENT_COUNT_NO_FUTEX)
+  #include "mutex/event_count_futex.h"
+  namespace etl
+  {
+    typedef etl::event_count_futex event_count;
+  }
+  #define ETL_HAS_EVENT_COUNT 1
+#elif ETL_CPP11_SUPPORTED == 1 && !defined(ETL_NO_STL)
+  #include "mutex/event_count_std.h"
+  namespace etl
+  {
+    typedef etl::event_count_std event_count;
+  }
+  #define ETL_HAS_EVENT_COUNT 1
+#else
+  #define ETL_HAS_EVENT_COUNT 0
+#endif
+
+#endif
@@ -0,0 +1,250 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EYTZINGER_FLAT_MAP_INCLUDED
+#define ETL_EYTZINGER_FLAT_MAP_INCLUDED
+
+#include <stddef.h>
+
+#include "platform.h"
+#include "flat_map.h"
+#include "reference_flat_map.h"
+#include "type_traits.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#include "private/eytzinger_index.h"
+
+#include "stl/algorithm.h"
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#undef ETL_FILE
+#define ETL_FILE "57"
+
+//*****************************************************************************
+///\defgroup eytzinger_flat_map eytzinger_flat_map
+/// A read only lookup index for a flat_map or reference_flat_map, with the
+/// capacity defined at compile time. It is built from the map in O(N) and
+/// copies the keys to one array, in Eytzinger (breadth first) order, so a
+/// search reads consecutive memory at the top of the tree and prefetches
+/// the levels below, rather than following a pointer at every probe.
+/// find, lower_bound and upper_bound return pointers to the map's elements.
+/// The index must be rebuilt if the map is modified.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the eytzinger_flat_map.
+  ///\ingroup eytzinger_flat_map
+  //***************************************************************************
+  class eytzinger_flat_map_exception : public etl::exception
+  {
+  public:
+
+    eytzinger_flat_map_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the eytzinger_flat_map.
+  ///\ingroup eytzinger_flat_map
+  //***************************************************************************
+  class eytzinger_flat_map_full : public etl::eytzinger_flat_map_exception
+  {
+  public:
+
+    eytzinger_flat_map_full(string_type file_name_, numeric_type line_number_)
+      : etl::eytzinger_flat_map_exception(ETL_ERROR_TEXT("eytzinger_flat_map:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_eytzinger
+  {
+    //*************************************************************************
+    /// Gets the key of a map element.
+    //*************************************************************************
+    template <typename TKey, typename TMapped>
+    struct map_key_of
+    {
+      static const TKey& key(const ETLSTD::pair<const TKey, TMapped>& value)
+      {
+        return value.first;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized eytzinger_flat_maps.
+  /// Can be used as a reference type for all eytzinger_flat_maps containing a specific type.
+  ///\ingroup eytzinger_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, typename TKeyCompare = ETLSTD::less<TKey> >
+  class ieytzinger_flat_map : public etl::private_eytzinger::ieytzinger_index<TKey,
+                                                                            ETLSTD::pair<const TKey, TMapped>,
+                                                                            etl::private_eytzinger::map_key_of<TKey, TMapped>,
+                                                                            TKeyCompare>
+  {
+  private:
+
+    typedef etl::private_eytzinger::ieytzinger_index<TKey,
+                                                     ETLSTD::pair<const TKey, TMapped>,
+                                                     etl::private_eytzinger::map_key_of<TKey, TMapped>,
+                                                     TKeyCompare> index_t;
+
+  public:
+
+    typedef TMapped mapped_type;
+
+    //*************************************************************************
+    /// Builds the index from a flat_map. O(N).
+    /// If asserts or exceptions are enabled, emits eytzinger_flat_map_full if the map is too large.
+    ///\param map The map to index.
+    //*************************************************************************
+    void assign(const etl::iflat_map<TKey, TMapped, TKeyCompare>& map)
+    {
+      ETL_ASSERT(map.size() <= this->max_size(), ETL_ERROR(eytzinger_flat_map_full));
+
+      index_t::assign(map.begin(), ETLSTD::min(map.size(), this->max_size()));
+    }
+
+    //*************************************************************************
+    /// Builds the index from a reference_flat_map. O(N).
+    /// If asserts or exceptions are enabled, emits eytzinger_flat_map_full if the map is too large.
+    ///\param map The map to index.
+    //*************************************************************************
+    void assign(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& map)
+    {
+      ETL_ASSERT(map.size() <= this->max_size(), ETL_ERROR(eytzinger_flat_map_full));
+
+      index_t::assign(map.begin(), ETLSTD::min(map.size(), this->max_size()));
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    ieytzinger_flat_map(TKey* pkeys_, typename index_t::const_pointer* pelements_, size_t MAX_SIZE_)
+      : index_t(pkeys_, pelements_, MAX_SIZE_)
+    {
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_EYTZINGER_FLAT_MAP) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~ieytzinger_flat_map()
+    {
+    }
+#else
+  protected:
+    ~ieytzinger_flat_map()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// An eytzinger_flat_map with a fixed capacity.
+  ///\tparam TKey        The key type.
+  ///\tparam TMapped     The mapped type.
+  ///\tparam MAX_SIZE_   The maximum number of elements that can be indexed.
+  ///\tparam TKeyCompare The type to compare keys. Default = std::less<TKey>
+  ///\ingroup eytzinger_flat_map
+  //***************************************************************************
+  template <typename TKey, typename TMapped, const size_t MAX_SIZE_, typename TKeyCompare = ETLSTD::less<TKey> >
+  class eytzinger_flat_map : public etl::ieytzinger_flat_map<TKey, TMapped, TKeyCompare>
+  {
+  private:
+
+    typedef etl::ieytzinger_flat_map<TKey, TMapped, TKeyCompare> base_t;
+
+  public:
+
+    static const size_t MAX_SIZE = MAX_SIZE_;
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    eytzinger_flat_map()
+      : base_t(reinterpret_cast<TKey*>(&keys), elements, MAX_SIZE)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor, from a flat_map.
+    //*************************************************************************
+    explicit eytzinger_flat_map(const etl::iflat_map<TKey, TMapped, TKeyCompare>& map)
+      : base_t(reinterpret_cast<TKey*>(&keys), elements, MAX_SIZE)
+    {
+      this->assign(map);
+    }
+
+    //*************************************************************************
+    /// Constructor, from a reference_flat_map.
+    //*************************************************************************
+    explicit eytzinger_flat_map(const etl::ireference_flat_map<TKey, TMapped, TKeyCompare>& map)
+      : base_t(reinterpret_cast<TKey*>(&keys), elements, MAX_SIZE)
+    {
+      this->assign(map);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~eytzinger_flat_map()
+    {
+      this->clear();
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    eytzinger_flat_map(const eytzinger_flat_map&);
+    eytzinger_flat_map& operator =(const eytzinger_flat_map&);
+
+    /// The keys, in Eytzinger order. The first is not used.
+    typename etl::aligned_storage<sizeof(TKey) * (MAX_SIZE + 1), etl::alignment_of<TKey>::value>::type keys;
+
+    /// The element of each key.
+    typename base_t::const_pointer elements[MAX_SIZE + 1];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
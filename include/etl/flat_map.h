@@ -273,11 +273,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -318,14 +314,28 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_map.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Values with keys that are already present, or repeated in the range, are not inserted.
     /// If asserts or exceptions are enabled, emits flat_map_full if the flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !refmap_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refmap_t::append(*pvalue);
+      }
+
+      erase(refmap_t::merge_appended(n_sorted), end());
+
+      // Any that did not fit go in one at a time, as they may be duplicates.
       while (first != last)
       {
         insert(*first++);
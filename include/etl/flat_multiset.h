@@ -214,11 +214,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -255,14 +251,28 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the flat_multiset.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Equal values are placed after those already present, in the order of the range.
     /// If asserts or exceptions are enabled, emits flat_multiset_full if the flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !refset_t::full())
+      {
+        value_type* pvalue = storage.allocate<value_type>();
+        ::new (pvalue) value_type(*first++);
+        ETL_INCREMENT_DEBUG_COUNT
+        refset_t::append(*pvalue);
+      }
+
+      refset_t::merge_appended(n_sorted);
+
+      // Any that did not fit go to insert, which reports the error.
       while (first != last)
       {
         insert(*first++);
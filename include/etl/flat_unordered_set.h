@@ -0,0 +1,398 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_UNORDERED_SET_INCLUDED
+#define ETL_FLAT_UNORDERED_SET_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "stl/algorithm.h"
+#include "stl/iterator.h"
+#include "stl/functional.h"
+#include "stl/utility.h"
+
+#include "private/flat_hash_table.h"
+#include "hash.h"
+#include "type_traits.h"
+#include "parameter_type.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "56"
+
+//*****************************************************************************
+///\defgroup flat_unordered_set flat_unordered_set
+/// A flat_unordered_set with the capacity defined at compile time.
+/// The elements are stored in an open addressed table rather than in nodes,
+/// so a lookup reads consecutive memory. Insertions may move elements, so
+/// iterators and references are invalidated by insert. Erase only
+/// invalidates iterators and references to the erased element and to the
+/// elements that follow it in the table.
+/// An element is never stored more than 254 slots from the one its hash
+/// selects. An insert that would need to is reported as full.
+///\ingroup containers
+//*****************************************************************************
+
+namespace etl
+{
+  //***************************************************************************
+  /// Exception for the flat_unordered_set.
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  class flat_unordered_set_exception : public etl::exception
+  {
+  public:
+
+    flat_unordered_set_exception(string_type reason_, string_type file_name_, numeric_type line_number_)
+      : etl::exception(reason_, file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Full exception for the flat_unordered_set.
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  class flat_unordered_set_full : public etl::flat_unordered_set_exception
+  {
+  public:
+
+    flat_unordered_set_full(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_set_exception(ETL_ERROR_TEXT("flat_unordered_set:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Iterator exception for the flat_unordered_set.
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  class flat_unordered_set_iterator : public etl::flat_unordered_set_exception
+  {
+  public:
+
+    flat_unordered_set_iterator(string_type file_name_, numeric_type line_number_)
+      : etl::flat_unordered_set_exception(ETL_ERROR_TEXT("flat_unordered_set:iterator", ETL_FILE"B"), file_name_, line_number_)
+    {
+    }
+  };
+
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// Gets the key of a flat_unordered_set element.
+    //*************************************************************************
+    template <typename TKey>
+    struct set_key_of
+    {
+      static const TKey& key(const TKey& value)
+      {
+        return value;
+      }
+    };
+  }
+
+  //***************************************************************************
+  /// The base class for specifically sized flat_unordered_set.
+  /// Can be used as a reference type for all flat_unordered_set containing a specific type.
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash = etl::hash<TKey>, typename TKeyEqual = ETLSTD::equal_to<TKey> >
+  class iflat_unordered_set : public etl::private_flat_hash::iflat_hash_table<const TKey,
+                                                                              TKey,
+                                                                              etl::private_flat_hash::set_key_of<TKey>,
+                                                                              THash,
+                                                                              TKeyEqual>
+  {
+  private:
+
+    typedef etl::private_flat_hash::iflat_hash_table<const TKey,
+                                                     TKey,
+                                                     etl::private_flat_hash::set_key_of<TKey>,
+                                                     THash,
+                                                     TKeyEqual> table_t;
+
+  public:
+
+    typedef TKey                              value_type;
+    typedef TKey                              key_type;
+    typedef THash                             hasher;
+    typedef TKeyEqual                         key_equal;
+    typedef typename table_t::reference       reference;
+    typedef typename table_t::const_reference const_reference;
+    typedef typename table_t::pointer         pointer;
+    typedef typename table_t::const_pointer   const_pointer;
+    typedef typename table_t::size_type       size_type;
+    typedef typename table_t::iterator        iterator;
+    typedef typename table_t::const_iterator  const_iterator;
+    typedef typename table_t::difference_type difference_type;
+    typedef typename table_t::key_parameter_t key_parameter_t;
+    typedef typename table_t::storage_t       storage_t;
+
+    //*********************************************************************
+    /// Assigns values to the flat_unordered_set.
+    /// If asserts or exceptions are enabled, emits flat_unordered_set_full if the flat_unordered_set does not have enough free space.
+    /// If asserts or exceptions are enabled, emits flat_unordered_set_iterator if the iterators are reversed.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*********************************************************************
+    template <typename TIterator>
+    void assign(TIterator first_, TIterator last_)
+    {
+#if defined(ETL_DEBUG)
+      difference_type d = ETLSTD::distance(first_, last_);
+      ETL_ASSERT(d >= 0, ETL_ERROR(flat_unordered_set_iterator));
+      ETL_ASSERT(size_t(d) <= this->max_size(), ETL_ERROR(flat_unordered_set_full));
+#endif
+
+      this->clear();
+
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_set.
+    /// If asserts or exceptions are enabled, emits flat_unordered_set_full if the flat_unordered_set is already full.
+    ///\param value The value to insert.
+    //*********************************************************************
+    ETLSTD::pair<iterator, bool> insert(const_reference key)
+    {
+      ETLSTD::pair<size_t, bool> result = table_t::insert_value(key);
+
+      ETL_ASSERT(result.first != table_t::NOT_FOUND, ETL_ERROR(flat_unordered_set_full));
+
+      return ETLSTD::pair<iterator, bool>(table_t::iterator_at(result.first), result.second);
+    }
+
+    //*********************************************************************
+    /// Inserts a value to the flat_unordered_set.
+    /// If asserts or exceptions are enabled, emits flat_unordered_set_full if the flat_unordered_set is already full.
+    ///\param position The position to insert at.
+    ///\param value    The value to insert.
+    //*********************************************************************
+    iterator insert(const_iterator, const_reference key)
+    {
+      return insert(key).first;
+    }
+
+    //*********************************************************************
+    /// Inserts a range of values to the flat_unordered_set.
+    /// If asserts or exceptions are enabled, emits flat_unordered_set_full if the flat_unordered_set does not have enough free space.
+    ///\param first The first element to add.
+    ///\param last  The last + 1 element to add.
+    //*********************************************************************
+    template <class TIterator>
+    void insert(TIterator first_, TIterator last_)
+    {
+      while (first_ != last_)
+      {
+        insert(*first_++);
+      }
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    iflat_unordered_set& operator = (const iflat_unordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  protected:
+
+    //*********************************************************************
+    /// Constructor.
+    //*********************************************************************
+    iflat_unordered_set(uint8_t* pcontrol_, storage_t* pslots_, size_t number_of_slots_, size_t maximum_size_)
+      : table_t(pcontrol_, pslots_, number_of_slots_, maximum_size_)
+    {
+    }
+
+  private:
+
+    // Disable copy construction.
+    iflat_unordered_set(const iflat_unordered_set&);
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_FLAT_UNORDERED_SET) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~iflat_unordered_set()
+    {
+    }
+#else
+  protected:
+    ~iflat_unordered_set()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  /// Equal operator.
+  /// The sets are equal if they hold the same keys.
+  ///\param lhs Reference to the first flat_unordered_set.
+  ///\param rhs Reference to the second flat_unordered_set.
+  ///\return <b>true</b> if the sets are equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator ==(const etl::iflat_unordered_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_unordered_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    if (lhs.size() != rhs.size())
+    {
+      return false;
+    }
+
+    typename etl::iflat_unordered_set<TKey, THash, TKeyEqual>::const_iterator itr = lhs.begin();
+
+    while (itr != lhs.end())
+    {
+      if (rhs.find(*itr) == rhs.end())
+      {
+        return false;
+      }
+
+      ++itr;
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  /// Not equal operator.
+  ///\param lhs Reference to the first flat_unordered_set.
+  ///\param rhs Reference to the second flat_unordered_set.
+  ///\return <b>true</b> if the sets are not equal, otherwise <b>false</b>
+  ///\ingroup flat_unordered_set
+  //***************************************************************************
+  template <typename TKey, typename THash, typename TKeyEqual>
+  bool operator !=(const etl::iflat_unordered_set<TKey, THash, TKeyEqual>& lhs, const etl::iflat_unordered_set<TKey, THash, TKeyEqual>& rhs)
+  {
+    return !(lhs == rhs);
+  }
+
+  //*************************************************************************
+  /// A templated flat_unordered_set implementation that uses a fixed size buffer.
+  /// The table has a power of 2 number of slots, with at least 20% left empty.
+  //*************************************************************************
+  template <typename TKey, const size_t MAX_SIZE_, typename THash = etl::hash<TKey>, typename TKeyEqual = ETLSTD::equal_to<TKey> >
+  class flat_unordered_set : public etl::iflat_unordered_set<TKey, THash, TKeyEqual>
+  {
+  private:
+
+    typedef etl::iflat_unordered_set<TKey, THash, TKeyEqual> base;
+
+  public:
+
+    static const size_t MAX_SIZE    = MAX_SIZE_;
+    static const size_t MAX_BUCKETS = etl::private_flat_hash::slot_count<MAX_SIZE_>::value;
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    flat_unordered_set()
+      : base(control, slots, MAX_BUCKETS, MAX_SIZE)
+    {
+      base::initialise();
+    }
+
+    //*************************************************************************
+    /// Copy constructor.
+    //*************************************************************************
+    flat_unordered_set(const flat_unordered_set& other)
+      : base(control, slots, MAX_BUCKETS, MAX_SIZE)
+    {
+      base::initialise();
+      base::assign(other.cbegin(), other.cend());
+    }
+
+    //*************************************************************************
+    /// Constructor, from an iterator range.
+    ///\tparam TIterator The iterator type.
+    ///\param first The iterator to the first element.
+    ///\param last  The iterator to the last element + 1.
+    //*************************************************************************
+    template <typename TIterator>
+    flat_unordered_set(TIterator first_, TIterator last_)
+      : base(control, slots, MAX_BUCKETS, MAX_SIZE)
+    {
+      base::initialise();
+      base::assign(first_, last_);
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~flat_unordered_set()
+    {
+      base::clear();
+    }
+
+    //*************************************************************************
+    /// Assignment operator.
+    //*************************************************************************
+    flat_unordered_set& operator = (const flat_unordered_set& rhs)
+    {
+      // Skip if doing self assignment
+      if (this != &rhs)
+      {
+        base::assign(rhs.cbegin(), rhs.cend());
+      }
+
+      return *this;
+    }
+
+  private:
+
+    /// The control bytes, followed by copies of the first ones.
+    uint8_t control[MAX_BUCKETS + etl::private_flat_hash::control::GROUP_SIZE - 1U];
+
+    /// The element slots.
+    typename base::storage_t slots[MAX_BUCKETS];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -51,6 +51,8 @@ SOFTWARE.
 #include "type_traits.h"
 #include "memory.h"
 
+#include "private/list_sort.h"
+
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
   #include <initializer_list>
 #endif
@@ -1185,120 +1187,19 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Sort using in-place merge sort algorithm.
+    /// Sort using a bottom-up merge sort that only relinks the nodes.
     /// Uses a supplied predicate function or functor.
-    /// This is not my algorithm. I got it off the web somewhere.
+    /// Stable. Equal elements keep their order.
     //*************************************************************************
     template <typename TCompare>
     void sort(TCompare compare)
     {
-      iterator p_left;
-      iterator p_right;
-      iterator p_node;
-      iterator p_head;
-      iterator p_tail;
-      int      list_size = 1;
-      int      number_of_merges;
-      int      left_size;
-      int      right_size;
-
       if (is_trivial_list())
       {
         return;
       }
 
-      while (true)
-      {
-        p_left = begin();
-        p_head = before_begin();
-        p_tail = before_begin();
-
-        number_of_merges = 0;  // Count the number of merges we do in this pass.
-
-        while (p_left != end())
-        {
-          ++number_of_merges;  // There exists a merge to be done.
-          p_right = p_left;
-          left_size = 0;
-
-          // Step 'list_size' places along from left
-          for (int i = 0; i < list_size; ++i)
-          {
-            ++left_size;
-
-            ++p_right;
-
-            if (p_right == end())
-            {
-              break;
-            }
-          }
-
-          // If right hasn't fallen off end, we have two lists to merge.
-          right_size = list_size;
-
-          // Now we have two lists. Merge them.
-          while (left_size > 0 || (right_size > 0 && p_right != end()))
-          {
-            // Decide whether the next node of merge comes from left or right.
-            if (left_size == 0)
-            {
-              // Left is empty. The node must come from right.
-              p_node = p_right;
-              ++p_right;
-              --right_size;
-            }
-            else if (right_size == 0 || p_right == end())
-            {
-              // Right is empty. The node must come from left.
-              p_node = p_left;
-              ++p_left;
-              --left_size;
-            }
-            else if (!compare(*p_right, *p_left))
-            {
-              // First node of left is lower or same. The node must come from left.
-              p_node = p_left;
-              ++p_left;
-              --left_size;
-            }
-            else
-            {
-              // First node of right is lower. The node must come from right.
-              p_node = p_right;
-              ++p_right;
-              --right_size;
-            }
-
-            // Add the next node to the merged head.
-            if (p_head == before_begin())
-            {
-              join(p_head.p_node, p_node.p_node);
-              p_head = p_node;
-              p_tail = p_node;
-            }
-            else
-            {
-              join(p_tail.p_node, p_node.p_node);
-              p_tail = p_node;
-            }
-
-            p_tail.p_node->next = nullptr;
-          }
-
-          // Now left has stepped `list_size' places along, and right has too.
-          p_left = p_right;
-        }
-
-        // If we have done only one merge, we're finished.
-        if (number_of_merges <= 1)   // Allow for number_of_merges == 0, the empty head case
-        {
-          return;
-        }
-
-        // Otherwise repeat, merging lists twice the size
-        list_size *= 2;
-      }
+      start_node.next = etl::private_list_sort::sort(get_head(), &node_t::next, node_compare<TCompare>(compare));
     }
 
     //*************************************************************************
@@ -1511,6 +1412,29 @@ namespace etl
       return static_cast<const data_node_t&>(node);
     }
 
+    //*************************************************************************
+    /// Compares nodes by their values.
+    //*************************************************************************
+    template <typename TCompare>
+    class node_compare
+    {
+    public:
+
+      node_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const node_t& lhs, const node_t& rhs)
+      {
+        return compare(data_cast(lhs).value, data_cast(rhs).value);
+      }
+
+    private:
+
+      TCompare compare;
+    };
+
     //*************************************************************************
     /// Remove a node.
     //*************************************************************************
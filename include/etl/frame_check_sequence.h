@@ -43,6 +43,17 @@ ETL_STATIC_ASSERT(ETL_8BIT_SUPPORT, "This file does not currently support target
 
 namespace etl
 {
+  //***************************************************************************
+  /// Indicates that a policy can process a contiguous block of bytes.
+  /// Specialise as etl::true_type for policies that define
+  /// value_type add(value_type, const uint8_t* begin, const uint8_t* end) const
+  ///\ingroup frame_check_sequence
+  //***************************************************************************
+  template <typename TPolicy>
+  struct frame_check_sequence_has_block_add : public etl::false_type
+  {
+  };
+
   //***************************************************************************
   /// Calculates a frame check sequence according to the specified policy.
   ///\tparam TPolicy The type used to enact the policy.
@@ -98,10 +109,9 @@ namespace etl
     {
       ETL_STATIC_ASSERT(sizeof(typename ETLSTD::iterator_traits<TIterator>::value_type) == 1, "Type not supported");
 
-      while (begin != end)
-      {
-        frame_check = policy.add(frame_check, *begin++);
-      }
+      typedef etl::integral_constant<bool, etl::is_pointer<TIterator>::value && etl::frame_check_sequence_has_block_add<TPolicy>::value> is_block_t;
+
+      add_range(begin, end, is_block_t());
     }
 
     //*************************************************************************
@@ -130,6 +140,27 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, one value at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type)
+    {
+      while (begin != end)
+      {
+        frame_check = policy.add(frame_check, *begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range using the policy's block algorithm.
+    //*************************************************************************
+    template<typename TPointer>
+    void add_range(TPointer begin, const TPointer end, etl::true_type)
+    {
+      frame_check = policy.add(frame_check, reinterpret_cast<const uint8_t*>(begin), reinterpret_cast<const uint8_t*>(end));
+    }
+
     value_type  frame_check;
     policy_type policy;
   };
@@ -62,12 +62,30 @@ SOFTWARE.
 #include "message_router.h"
 #include "integral_limits.h"
 #include "largest.h"
+#include "static_assert.h"
+
+#if defined(ETL_FSM_TRACE)
+  #include "atomic.h"
+  #include "queue_spsc_atomic.h"
+#endif
 
 #undef ETL_FILE
 #define ETL_FILE "34"
 
 #include "private/minmax_push.h"
 
+///\defgroup fsm Finite State Machine
+/// Define ETL_FSM_TRACE to enable the tracing of events through etl::fsm::set_trace.
+/// Define ETL_FSM_TRACE_CYCLES() to read a cycle counter, such as DWT->CYCCNT on Cortex-M.
+/// The time stamp counter is used by default on x86, otherwise cycles are not recorded.
+#if defined(ETL_FSM_TRACE) && !defined(ETL_FSM_TRACE_CYCLES)
+  #if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+    #define ETL_FSM_TRACE_CYCLES() uint32_t(__builtin_ia32_rdtsc())
+  #else
+    #define ETL_FSM_TRACE_CYCLES() uint32_t(0U)
+  #endif
+#endif
+
 namespace etl
 {
   class fsm;
@@ -134,6 +152,86 @@ namespace etl
     }
   };
 
+#if defined(ETL_FSM_TRACE)
+  //***************************************************************************
+  /// A record of one event processed by an FSM.
+  //***************************************************************************
+  struct fsm_trace_record
+  {
+    etl::fsm_state_id_t state_id;      ///< The state that received the event.
+    etl::message_id_t   event_id;      ///< The event.
+    etl::fsm_state_id_t next_state_id; ///< The state after any transitions.
+    uint32_t            cycles;        ///< The cycles taken, including exit and entry handlers.
+  };
+
+  //***************************************************************************
+  /// Interface for FSM trace sinks.
+  /// 'record' is called by the thread that sends events to the FSM.
+  //***************************************************************************
+  class ifsm_trace
+  {
+  public:
+
+    virtual void record(const etl::fsm_trace_record& trace_record) = 0;
+
+  protected:
+
+    ~ifsm_trace()
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// Records FSM events in a lock free ring buffer.
+  /// One thread may read the records while the FSM runs in another.
+  /// Records are dropped while the buffer is full.
+  ///\tparam SIZE The number of records that can be buffered.
+  //***************************************************************************
+  template <const size_t SIZE>
+  class fsm_trace : public ifsm_trace
+  {
+  public:
+
+    fsm_trace()
+      : dropped(0U)
+    {
+    }
+
+    //*******************************************
+    /// Adds a record. Called by the FSM.
+    //*******************************************
+    void record(const etl::fsm_trace_record& trace_record)
+    {
+      if (!records.push(trace_record))
+      {
+        ++dropped;
+      }
+    }
+
+    //*******************************************
+    /// Removes the oldest record.
+    ///\return <b>false</b> if there are no records.
+    //*******************************************
+    bool pop(etl::fsm_trace_record& trace_record)
+    {
+      return records.pop(trace_record);
+    }
+
+    //*******************************************
+    /// The number of records dropped because the buffer was full.
+    //*******************************************
+    uint32_t dropped_count() const
+    {
+      return dropped.load();
+    }
+
+  private:
+
+    etl::queue_spsc_atomic<etl::fsm_trace_record, SIZE> records;
+    etl::atomic_uint32_t                                 dropped;
+  };
+#endif
+
   //***************************************************************************
   /// Interface class for FSM states.
   //***************************************************************************
@@ -213,6 +311,9 @@ namespace etl
     fsm(etl::message_router_id_t id)
       : imessage_router(id),
         p_state(nullptr)
+#if defined(ETL_FSM_TRACE)
+        , p_trace(nullptr)
+#endif
     {
     }
 
@@ -289,6 +390,11 @@ namespace etl
     //*******************************************
     void receive(etl::imessage_router& source, const etl::imessage& message)
     {
+#if defined(ETL_FSM_TRACE)
+        const uint32_t            start_cycles = ETL_FSM_TRACE_CYCLES();
+        const etl::fsm_state_id_t state_id     = p_state->get_state_id();
+#endif
+
         etl::fsm_state_id_t next_state_id = p_state->process_event(source, message);
         ETL_ASSERT(next_state_id < number_of_states, ETL_ERROR(etl::fsm_state_id_exception));
 
@@ -309,8 +415,34 @@ namespace etl
 
           } while (p_next_state != p_state); // Have we changed state again?
         }
+
+#if defined(ETL_FSM_TRACE)
+        if (p_trace != nullptr)
+        {
+          const etl::fsm_trace_record trace_record = { state_id, message.message_id, p_state->get_state_id(), uint32_t(ETL_FSM_TRACE_CYCLES() - start_cycles) };
+          p_trace->record(trace_record);
+        }
+#endif
     }
 
+#if defined(ETL_FSM_TRACE)
+    //*******************************************
+    /// Sets the sink for trace records.
+    //*******************************************
+    void set_trace(etl::ifsm_trace& trace)
+    {
+      p_trace = &trace;
+    }
+
+    //*******************************************
+    /// Stops tracing.
+    //*******************************************
+    void clear_trace()
+    {
+      p_trace = nullptr;
+    }
+#endif
+
     using imessage_router::accepts;
 
     //*******************************************
@@ -382,8 +514,119 @@ namespace etl
     etl::ifsm_state*    p_state;          ///< A pointer to the current state.
     etl::ifsm_state**   state_list;       ///< The list of added states.
     etl::fsm_state_id_t number_of_states; ///< The number of states.
+
+#if defined(ETL_FSM_TRACE)
+    etl::ifsm_trace*    p_trace;          ///< The sink for trace records, if any.
+#endif
+  };
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03) && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  /// A state for any number of event types.
+  /// Events are dispatched through a table of handlers built at compile time,
+  /// in the same way as etl::message_router.
+  //***************************************************************************
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_, typename... TMessages>
+  class fsm_state : public ifsm_state
+  {
+  private:
+
+    typedef private_message_router::message_ids<TMessages...> ids_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(private_message_router::ids_are_unique(ids_t::ids, sizeof...(TMessages)), "Event IDs must be unique");
+
+    enum
+    {
+      STATE_ID = STATE_ID_
+    };
+
+    fsm_state()
+      : ifsm_state(STATE_ID)
+    {
+    }
+
+  protected:
+
+    ~fsm_state()
+    {
+    }
+
+    inline TContext& get_fsm_context() const
+    {
+      return static_cast<TContext&>(ifsm_state::get_fsm_context());
+    }
+
+  private:
+
+    template <typename, typename, typename, typename>
+    friend struct private_message_router::dense_dispatch;
+
+    template <typename, typename>
+    friend struct private_message_router::hashed_dispatch;
+
+    typedef etl::fsm_state_id_t (*handler_t)(fsm_state&, etl::imessage_router&, const etl::imessage&);
+
+    typedef typename private_message_router::select_dispatch<fsm_state, TMessages...>::type dispatch_t;
+
+    //*******************************************
+    etl::fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message)
+    {
+      return dispatch_t::lookup(message.message_id)(*this, source, message);
+    }
+
+    //*******************************************
+    template <typename T>
+    static etl::fsm_state_id_t on_message(fsm_state& state, etl::imessage_router& source, const etl::imessage& message)
+    {
+      return static_cast<TDerived&>(state).on_event(source, static_cast<const T&>(message));
+    }
+
+    //*******************************************
+    static etl::fsm_state_id_t on_unknown(fsm_state& state, etl::imessage_router& source, const etl::imessage& message)
+    {
+      return static_cast<TDerived&>(state).on_event_unknown(source, message);
+    }
   };
 
+  //***************************************************************************
+  /// Specialisation for 0 event types.
+  //***************************************************************************
+  template <typename TContext, typename TDerived, const etl::fsm_state_id_t STATE_ID_>
+  class fsm_state<TContext, TDerived, STATE_ID_> : public ifsm_state
+  {
+  public:
+
+    enum
+    {
+      STATE_ID = STATE_ID_
+    };
+
+    fsm_state()
+      : ifsm_state(STATE_ID)
+    {
+    }
+
+  protected:
+
+    ~fsm_state()
+    {
+    }
+
+    inline TContext& get_fsm_context() const
+    {
+      return static_cast<TContext&>(ifsm_state::get_fsm_context());
+    }
+
+  private:
+
+    etl::fsm_state_id_t process_event(etl::imessage_router& source, const etl::imessage& message)
+    {
+      return static_cast<TDerived*>(this)->on_event_unknown(source, message);
+    }
+  };
+#else
   //***************************************************************************
   // The definition for all 16 message types.
   //***************************************************************************
@@ -1315,6 +1558,7 @@ namespace etl
       return static_cast<TDerived*>(this)->on_event_unknown(source, message);
     }
   };
+#endif
 }
 
 #undef ETL_FILE
@@ -36,8 +36,12 @@ SOFTWARE.
 
 #include "platform.h"
 
-// The default hash calculation.
+// The default hash calculation is FNV-1a.
+// Define ETL_HASH_USE_WYHASH in the profile to use a word at a time hash
+// for strings, string views and byte ranges instead. It is several times
+// faster for keys longer than a few bytes, but gives different values.
 #include "fnv_1.h"
+#include "private/wyhash.h"
 #include "type_traits.h"
 #include "static_assert.h"
 
@@ -82,6 +86,59 @@ namespace etl
     {
       return fnv_1a_64(begin, end);
     }
+
+    //*************************************************************************
+    /// Hash for strings, string views and byte ranges.
+    /// The same as generic_hash unless ETL_HASH_USE_WYHASH is defined.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint16_t), size_t>::type
+    range_hash(const uint8_t* begin, const uint8_t* end)
+    {
+#if defined(ETL_HASH_USE_WYHASH)
+      uint64_t h64 = etl::private_wyhash::hash(begin, end);
+      uint32_t h   = uint32_t(h64 ^ (h64 >> 32));
+
+      return static_cast<size_t>(h ^ (h >> 16));
+#else
+      return generic_hash<T>(begin, end);
+#endif
+    }
+
+    //*************************************************************************
+    /// Hash for strings, string views and byte ranges.
+    /// The same as generic_hash unless ETL_HASH_USE_WYHASH is defined.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint32_t), size_t>::type
+    range_hash(const uint8_t* begin, const uint8_t* end)
+    {
+#if defined(ETL_HASH_USE_WYHASH)
+      uint64_t h = etl::private_wyhash::hash(begin, end);
+
+      return static_cast<size_t>(h ^ (h >> 32));
+#else
+      return generic_hash<T>(begin, end);
+#endif
+    }
+
+    //*************************************************************************
+    /// Hash for strings, string views and byte ranges.
+    /// The same as generic_hash unless ETL_HASH_USE_WYHASH is defined.
+    /// T is always expected to be size_t.
+    //*************************************************************************
+    template <typename T>
+    typename enable_if<sizeof(T) == sizeof(uint64_t), size_t>::type
+    range_hash(const uint8_t* begin, const uint8_t* end)
+    {
+#if defined(ETL_HASH_USE_WYHASH)
+      return static_cast<size_t>(etl::private_wyhash::hash(begin, end));
+#else
+      return generic_hash<T>(begin, end);
+#endif
+    }
   }
 
   //***************************************************************************
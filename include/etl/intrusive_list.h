@@ -46,6 +46,8 @@ SOFTWARE.
 #include "static_assert.h"
 #include "algorithm.h"
 
+#include "private/list_sort.h"
+
 #include "stl/algorithm.h"
 #include "stl/iterator.h"
 #include "stl/functional.h"
@@ -784,116 +786,34 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Sort using in-place merge sort algorithm.
+    /// Sort using a bottom-up merge sort that only relinks the nodes.
     /// Uses a supplied predicate function or functor.
-    /// This is not my algorithm. I got it off the web somewhere.
+    /// Stable. Equal elements keep their order.
     //*************************************************************************
     template <typename TCompare>
     void sort(TCompare compare)
     {
-      iterator i_left;
-      iterator i_right;
-      iterator i_node;
-      iterator i_head;
-      iterator i_tail;
-      int      list_size = 1;
-      int      number_of_merges;
-      int      left_size;
-      int      right_size;
-
       if (this->is_trivial_list())
       {
         return;
       }
 
-      while (true)
-      {
-        i_left = begin();
-        i_head = end();
-        i_tail = end();
-
-        number_of_merges = 0;  // Count the number of merges we do in this pass.
-
-        while (i_left != end())
-        {
-          ++number_of_merges;  // There exists a merge to be done.
-          i_right = i_left;
-          left_size = 0;
-
-          // Step 'list_size' places along from left
-          for (int i = 0; i < list_size; ++i)
-          {
-            ++left_size;
-            ++i_right;
-
-            if (i_right == end())
-            {
-              break;
-            }
-          }
-
-          // If right hasn't fallen off end, we have two lists to merge.
-          right_size = list_size;
-
-          // Now we have two lists. Merge them.
-          while (left_size > 0 || (right_size > 0 && i_right != end()))
-          {
-            // Decide whether the next node of merge comes from left or right.
-            if (left_size == 0)
-            {
-              // Left is empty. The node must come from right.
-              i_node = i_right++;
-              --right_size;
-            }
-            else if (right_size == 0 || i_right == end())
-            {
-              // Right is empty. The node must come from left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else if (!compare(*i_right, *i_left))
-            {
-              // First node of left is lower or same. The node must come from left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else
-            {
-              // First node of right is lower. The node must come from right.
-              i_node = i_right;
-              ++i_right;
-              --right_size;
-            }
-
-            // Add the next node to the merged head.
-            if (i_head == end())
-            {
-              etl::link<link_type>(i_head.p_value, i_node.p_value);
-              i_head = i_node;
-              i_tail = i_node;
-            }
-            else
-            {
-              etl::link<link_type>(i_tail.p_value, i_node.p_value);
-              i_tail = i_node;
-            }
-
-            etl::link<link_type>(i_tail.p_value, this->terminal_link);
-          }
+      // Sort the links as a null terminated chain.
+      this->get_tail()->etl_next = nullptr;
 
-          // Now left has stepped `list_size' places along, and right has too.
-          i_left = i_right;
-        }
+      link_type* p_link = etl::private_list_sort::sort(this->get_head(), &link_type::etl_next, link_compare<TCompare>(compare));
 
-        // If we have done only one merge, we're finished.
-        if (number_of_merges <= 1)   // Allow for number_of_merges == 0, the empty head case
-        {
-          return;
-        }
+      // Restore the previous links and the ring through the terminal link.
+      link_type* p_previous = &this->terminal_link;
 
-        // Otherwise repeat, merging lists twice the size
-        list_size *= 2;
+      while (p_link != nullptr)
+      {
+        etl::link<link_type>(p_previous, p_link);
+        p_previous = p_link;
+        p_link     = p_link->etl_next;
       }
+
+      etl::link<link_type>(p_previous, this->terminal_link);
     }
 
     //*************************************************************************
@@ -1071,6 +991,29 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Compares links by the values that contain them.
+    //*************************************************************************
+    template <typename TCompare>
+    class link_compare
+    {
+    public:
+
+      link_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const link_type& lhs, const link_type& rhs)
+      {
+        return compare(static_cast<const value_type&>(lhs), static_cast<const value_type&>(rhs));
+      }
+
+    private:
+
+      TCompare compare;
+    };
+
     // Disabled.
     intrusive_list(const intrusive_list& other);
     intrusive_list& operator = (const intrusive_list& rhs);
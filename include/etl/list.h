@@ -51,6 +51,8 @@ SOFTWARE.
 #include "algorithm.h"
 #include "memory.h"
 
+#include "private/list_sort.h"
+
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_NO_STL)
   #include <initializer_list>
 #endif
@@ -476,6 +478,29 @@ namespace etl
       return reinterpret_cast<const data_node_t&>(node);
     }
 
+    //*************************************************************************
+    /// Compares nodes by their values.
+    //*************************************************************************
+    template <typename TCompare>
+    class node_compare
+    {
+    public:
+
+      node_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const node_t& lhs, const node_t& rhs)
+      {
+        return compare(data_cast(lhs).value, data_cast(rhs).value);
+      }
+
+    private:
+
+      TCompare compare;
+    };
+
   public:
 
     //*************************************************************************
@@ -1606,116 +1631,34 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Sort using in-place merge sort algorithm.
+    /// Sort using a bottom-up merge sort that only relinks the nodes.
     /// Uses a supplied predicate function or functor.
-    /// This is not my algorithm. I got it off the web somewhere.
+    /// Stable. Equal elements keep their order.
     //*************************************************************************
     template <typename TCompare>
     void sort(TCompare compare)
     {
-      iterator i_left;
-      iterator i_right;
-      iterator i_node;
-      iterator i_head;
-      iterator i_tail;
-      int   list_size = 1;
-      int   number_of_merges;
-      int   left_size;
-      int   right_size;
-
       if (is_trivial_list())
       {
         return;
       }
 
-      while (true)
-      {
-        i_left = begin();
-        i_head = end();
-        i_tail = end();
-
-        number_of_merges = 0;  // Count the number of merges we do in this pass.
-
-        while (i_left != end())
-        {
-          ++number_of_merges;  // There exists a merge to be done.
-          i_right = i_left;
-          left_size = 0;
-
-          // Step 'list_size' places along from left
-          for (int i = 0; i < list_size; ++i)
-          {
-            ++left_size;
-            ++i_right;
-
-            if (i_right == end())
-            {
-              break;
-            }
-          }
-
-          // If right hasn't fallen off end, we have two lists to merge.
-          right_size = list_size;
-
-          // Now we have two lists. Merge them.
-          while (left_size > 0 || (right_size > 0 && i_right != end()))
-          {
-            // Decide whether the next node of merge comes from left or right.
-            if (left_size == 0)
-            {
-              // Left is empty. The node must come from right.
-              i_node = i_right++;
-              --right_size;
-            }
-            else if (right_size == 0 || i_right == end())
-            {
-              // Right is empty. The node must come from left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else if (!compare(*i_right, *i_left))
-            {
-              // First node of left is lower or same. The node must come from left.
-              i_node = i_left++;
-              --left_size;
-            }
-            else
-            {
-              // First node of right is lower. The node must come from right.
-              i_node = i_right;
-              ++i_right;
-              --right_size;
-            }
+      // Sort the nodes as a null terminated chain.
+      get_tail().next = nullptr;
 
-            // Add the next node to the merged head.
-            if (i_head == end())
-            {
-              join(*i_head.p_node, *i_node.p_node);
-              i_head = i_node;
-              i_tail = i_node;
-            }
-            else
-            {
-              join(*i_tail.p_node, *i_node.p_node);
-              i_tail = i_node;
-            }
+      node_t* p_node = etl::private_list_sort::sort(&get_head(), &node_t::next, node_compare<TCompare>(compare));
 
-            join(*i_tail.p_node, terminal_node);
-          }
+      // Restore the previous links and the ring through the terminal node.
+      node_t* p_previous = &terminal_node;
 
-          // Now left has stepped `list_size' places along, and right has too.
-          i_left = i_right;
-        }
-
-        // If we have done only one merge, we're finished.
-        if (number_of_merges <= 1)   // Allow for number_of_merges == 0, the empty head case
-        {
-          return;
-        }
-
-        // Otherwise repeat, merging lists twice the size
-        list_size *= 2;
+      while (p_node != nullptr)
+      {
+        join(*p_previous, *p_node);
+        p_previous = p_node;
+        p_node     = p_node->next;
       }
+
+      join(*p_previous, terminal_node);
     }
 
     //*************************************************************************
@@ -41,6 +41,7 @@ SOFTWARE.
 #include "message_types.h"
 #include "message.h"
 #include "message_router.h"
+#include "binary.h"
 
 #undef ETL_FILE
 #define ETL_FILE "39"
@@ -107,6 +108,7 @@ namespace etl
                                                              router.get_message_router_id(),
                                                              compare_router_id());
 
+          index_insert(size_t(ETLSTD::distance(router_list.begin(), irouter)), router);
           router_list.insert(irouter, &router);
         }
       }
@@ -130,6 +132,8 @@ namespace etl
                                                                                              id,
                                                                                              compare_router_id());
 
+        index_erase(size_t(ETLSTD::distance(router_list.begin(), range.first)),
+                    size_t(ETLSTD::distance(range.first, range.second)));
         router_list.erase(range.first, range.second);
       }
     }
@@ -143,6 +147,7 @@ namespace etl
 
       if (irouter != router_list.end())
       {
+        index_erase(size_t(ETLSTD::distance(router_list.begin(), irouter)), 1U);
         router_list.erase(irouter);
       }
     }
@@ -187,6 +192,27 @@ namespace etl
         // Broadcast to all routers.
         case etl::imessage_router::ALL_MESSAGE_ROUTERS:
         {
+          // Only visit the routers that accept the message id, if it is indexed.
+          if (is_indexed(message.message_id))
+          {
+            const uint32_t* const p_row = p_index + (size_t(message.message_id) * index_words);
+
+            for (size_t word = 0U; word < index_words; ++word)
+            {
+              uint32_t bits = p_row[word];
+
+              while (bits != 0U)
+              {
+                const size_t position = (word * 32U) + etl::count_trailing_zeros(bits);
+                bits &= (bits - 1U);
+
+                router_list[position]->receive(source, destination_router_id, message);
+              }
+            }
+
+            break;
+          }
+
           router_list_t::iterator irouter = router_list.begin();
 
           // Broadcast to everyone.
@@ -268,7 +294,12 @@ namespace etl
     //*******************************************
     void clear()
     {
-      return router_list.clear();
+      router_list.clear();
+
+      for (size_t i = 0U; i < (indexed_ids * index_words); ++i)
+      {
+        p_index[i] = 0U;
+      }
     }
 
     //********************************************
@@ -284,7 +315,25 @@ namespace etl
     //*******************************************
     imessage_bus(router_list_t& list)
       : imessage_router(etl::imessage_router::MESSAGE_BUS),
-        router_list(list)
+        router_list(list),
+        p_index(nullptr),
+        indexed_ids(0U),
+        index_words(0U)
+    {
+    }
+
+    //*******************************************
+    /// Constructor with a subscription index.
+    ///\param p_index_     One row of 'index_words_' words for each indexed message id.
+    ///\param indexed_ids_ Message ids from 0 to indexed_ids_ - 1 are indexed.
+    ///\param index_words_ The number of 32 bit words in a row. One bit per router.
+    //*******************************************
+    imessage_bus(router_list_t& list, uint32_t* p_index_, size_t indexed_ids_, size_t index_words_)
+      : imessage_router(etl::imessage_router::MESSAGE_BUS),
+        router_list(list),
+        p_index(p_index_),
+        indexed_ids(indexed_ids_),
+        index_words(index_words_)
     {
     }
 
@@ -306,15 +355,116 @@ namespace etl
       }
     };
 
+    //*******************************************
+    /// Is there an index row for the message id?
+    //*******************************************
+    bool is_indexed(etl::message_id_t id) const
+    {
+      return size_t(id) < indexed_ids;
+    }
+
+    //*******************************************
+    /// Makes room in the index for a router at 'position' in the list
+    /// and records the message ids that it accepts.
+    //*******************************************
+    void index_insert(size_t position, const etl::imessage_router& router)
+    {
+      const size_t   first_word = position / 32U;
+      const uint32_t bit        = uint32_t(1U) << (position % 32U);
+      const uint32_t low_bits   = bit - 1U;
+
+      for (size_t id = 0U; id < indexed_ids; ++id)
+      {
+        uint32_t* const p_row = p_index + (id * index_words);
+
+        // Shift the bits at and above 'position' up by one.
+        for (size_t word = index_words - 1U; word > first_word; --word)
+        {
+          p_row[word] = (p_row[word] << 1U) | (p_row[word - 1U] >> 31U);
+        }
+
+        uint32_t value = p_row[first_word];
+        value = (value & low_bits) | ((value & ~low_bits) << 1U);
+
+        if (router.accepts(etl::message_id_t(id)))
+        {
+          value |= bit;
+        }
+
+        p_row[first_word] = value;
+      }
+    }
+
+    //*******************************************
+    /// Removes 'count' routers from the index, starting at 'position' in the list.
+    //*******************************************
+    void index_erase(size_t position, size_t count)
+    {
+      const size_t   first_word = position / 32U;
+      const uint32_t low_bits   = (uint32_t(1U) << (position % 32U)) - 1U;
+
+      for (size_t id = 0U; id < indexed_ids; ++id)
+      {
+        uint32_t* const p_row = p_index + (id * index_words);
+
+        for (size_t i = 0U; i < count; ++i)
+        {
+          // Shift the bits above 'position' down by one.
+          uint32_t value = p_row[first_word];
+          p_row[first_word] = (value & low_bits) | ((value >> 1U) & ~low_bits);
+
+          for (size_t word = first_word + 1U; word < index_words; ++word)
+          {
+            p_row[word - 1U] |= (p_row[word] << 31U);
+            p_row[word] >>= 1U;
+          }
+        }
+      }
+    }
+
     router_list_t& router_list;
+
+    uint32_t* const p_index;     ///< One bit per router for each indexed message id.
+    const size_t    indexed_ids; ///< The number of indexed message ids.
+    const size_t    index_words; ///< The number of words per message id.
   };
 
   //***************************************************************************
   /// The message bus
+  ///\tparam MAX_ROUTERS_         The maximum number of subscribed routers.
+  ///\tparam INDEXED_MESSAGE_IDS_ If not zero, message ids 0 to INDEXED_MESSAGE_IDS_ - 1
+  /// are indexed, so that a broadcast only visits the routers that accept the message.
+  /// The index takes INDEXED_MESSAGE_IDS_ * ((MAX_ROUTERS_ + 31) / 32) words.
+  /// A router's accepted message ids must not change while it is subscribed.
   //***************************************************************************
-  template <uint_least8_t MAX_ROUTERS_>
+  template <uint_least8_t MAX_ROUTERS_, size_t INDEXED_MESSAGE_IDS_ = 0U>
   class message_bus : public etl::imessage_bus
   {
+  public:
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_bus()
+      : imessage_bus(router_list, subscription_index, INDEXED_MESSAGE_IDS_, INDEX_WORDS)
+    {
+      clear();
+    }
+
+  private:
+
+    static const size_t INDEX_WORDS = (MAX_ROUTERS_ + 31U) / 32U;
+
+    etl::vector<etl::imessage_router*, MAX_ROUTERS_> router_list;
+    uint32_t subscription_index[INDEXED_MESSAGE_IDS_ * INDEX_WORDS];
+  };
+
+  //***************************************************************************
+  /// The message bus, without a subscription index.
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_>
+  class message_bus<MAX_ROUTERS_, 0U> : public etl::imessage_bus
+  {
   public:
 
     //*******************************************
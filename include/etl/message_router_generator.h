@@ -74,6 +74,8 @@ cog.outl("//********************************************************************
 #include "exception.h"
 #include "largest.h"
 #include "nullptr.h"
+#include "static_assert.h"
+#include "type_traits.h"
 
 #undef ETL_FILE
 #define ETL_FILE "35"
@@ -250,6 +252,641 @@ namespace etl
     destination.receive(source, message);
   }
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  namespace private_message_router
+  {
+    //*************************************************************************
+    /// A compile time sequence of indexes.
+    //*************************************************************************
+    template <size_t... Indexes>
+    struct index_sequence
+    {
+      typedef index_sequence type;
+    };
+
+    template <typename TFirst, typename TSecond>
+    struct concatenate_sequence;
+
+    template <size_t... Indexes1, size_t... Indexes2>
+    struct concatenate_sequence<index_sequence<Indexes1...>, index_sequence<Indexes2...> >
+    {
+      typedef index_sequence<Indexes1..., (sizeof...(Indexes1) + Indexes2)...> type;
+    };
+
+    // Halves the sequence at each step, so that long sequences do not hit the template depth limit.
+    template <size_t N>
+    struct make_index_sequence
+      : concatenate_sequence<typename make_index_sequence<N / 2>::type, typename make_index_sequence<N - (N / 2)>::type>
+    {
+    };
+
+    template <>
+    struct make_index_sequence<0>
+    {
+      typedef index_sequence<> type;
+    };
+
+    template <>
+    struct make_index_sequence<1>
+    {
+      typedef index_sequence<0> type;
+    };
+
+    //*************************************************************************
+    /// A list of types.
+    //*************************************************************************
+    template <typename... TTypes>
+    struct type_list
+    {
+    };
+
+    //*************************************************************************
+    /// The IDs of a set of messages, in declaration order.
+    //*************************************************************************
+    template <typename... TMessages>
+    struct message_ids
+    {
+      static constexpr etl::message_id_t ids[sizeof...(TMessages)] = { etl::message_id_t(TMessages::ID)... };
+    };
+
+    template <typename... TMessages>
+    constexpr etl::message_id_t message_ids<TMessages...>::ids[sizeof...(TMessages)];
+
+    //*************************************************************************
+    constexpr size_t minimum_id(const etl::message_id_t* ids, size_t count, size_t result)
+    {
+      return (count == 0U) ? result : minimum_id(ids + 1, count - 1U, (size_t(*ids) < result) ? size_t(*ids) : result);
+    }
+
+    //*************************************************************************
+    constexpr size_t maximum_id(const etl::message_id_t* ids, size_t count, size_t result)
+    {
+      return (count == 0U) ? result : maximum_id(ids + 1, count - 1U, (size_t(*ids) > result) ? size_t(*ids) : result);
+    }
+
+    //*************************************************************************
+    /// The index of the ID in the list, or 'count' if it is not there.
+    //*************************************************************************
+    constexpr size_t index_of_id(const etl::message_id_t* ids, size_t count, size_t id, size_t index)
+    {
+      return (index == count) ? count : ((size_t(ids[index]) == id) ? index : index_of_id(ids, count, id, index + 1U));
+    }
+
+    //*************************************************************************
+    constexpr bool ids_are_unique(const etl::message_id_t* ids, size_t count)
+    {
+      return (count < 2U) ? true : ((index_of_id(ids + 1, count - 1U, size_t(*ids), 0U) == (count - 1U)) && ids_are_unique(ids + 1, count - 1U));
+    }
+
+    //*************************************************************************
+    /// The 32 bit word of an accepts mask that starts at 'first_id'.
+    //*************************************************************************
+    constexpr uint32_t id_mask_word(const etl::message_id_t* ids, size_t count, size_t first_id, uint32_t result)
+    {
+      return (count == 0U) ? result
+                           : id_mask_word(ids + 1, count - 1U, first_id,
+                                          result | (((size_t(*ids) >= first_id) && (size_t(*ids) < (first_id + 32U))) ? (uint32_t(1U) << (size_t(*ids) - first_id)) : 0U));
+    }
+
+    //*************************************************************************
+    constexpr size_t round_up_power_of_2(size_t n, size_t result = 1U)
+    {
+      return (result >= n) ? result : round_up_power_of_2(n, result * 2U);
+    }
+
+    //*************************************************************************
+    /// Direct lookup, indexed by the message ID less the lowest ID.
+    /// Used when the IDs are dense.
+    //*************************************************************************
+    template <typename TRouter, typename TSequence, typename TWords, typename TMessages>
+    struct dense_dispatch;
+
+    template <typename TRouter, size_t... Indexes, size_t... Words, typename... TMessages>
+    struct dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >
+    {
+      typedef typename TRouter::handler_t handler_t;
+      typedef message_ids<TMessages...>    ids_t;
+
+      static const size_t COUNT  = sizeof...(TMessages);
+      static const size_t MIN_ID = minimum_id(ids_t::ids, COUNT, size_t(ids_t::ids[0]));
+      static const size_t RANGE  = sizeof...(Indexes);
+
+      /// The handler for each message, followed by the handler for unknown messages.
+      static constexpr handler_t handlers[COUNT + 1U] = { &TRouter::template on_message<TMessages>..., &TRouter::on_unknown };
+
+      /// The handler for each ID in the range.
+      static constexpr handler_t table[RANGE] = { handlers[index_of_id(ids_t::ids, COUNT, MIN_ID + Indexes, 0U)]... };
+
+      /// A bit for each ID in the range.
+      static constexpr uint32_t mask[sizeof...(Words)] = { id_mask_word(ids_t::ids, COUNT, MIN_ID + (Words * 32U), 0U)... };
+
+      //*******************************************
+      static handler_t lookup(etl::message_id_t id)
+      {
+        const size_t index = size_t(id) - MIN_ID;
+
+        return (index < RANGE) ? table[index] : &TRouter::on_unknown;
+      }
+
+      //*******************************************
+      static bool accepts(etl::message_id_t id)
+      {
+        const size_t index = size_t(id) - MIN_ID;
+
+        return (index < RANGE) && (((mask[index / 32U] >> (index % 32U)) & 1U) != 0U);
+      }
+    };
+
+    template <typename TRouter, size_t... Indexes, size_t... Words, typename... TMessages>
+    constexpr typename dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >::handler_t dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >::handlers[];
+
+    template <typename TRouter, size_t... Indexes, size_t... Words, typename... TMessages>
+    constexpr typename dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >::handler_t dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >::table[];
+
+    template <typename TRouter, size_t... Indexes, size_t... Words, typename... TMessages>
+    constexpr uint32_t dense_dispatch<TRouter, index_sequence<Indexes...>, index_sequence<Words...>, type_list<TMessages...> >::mask[];
+
+#if ETL_CPP14_SUPPORTED
+    //*************************************************************************
+    /// A perfect hash of a set of message IDs, built at compile time.
+    /// Each ID hashes to a bucket and a base slot. The bucket's displacement is
+    /// XORed with the base slot to give a slot that no other ID uses.
+    //*************************************************************************
+    template <size_t COUNT>
+    struct perfect_hash
+    {
+      static const size_t SLOTS   = round_up_power_of_2(COUNT * 2U);
+      static const size_t BUCKETS = round_up_power_of_2((COUNT + 1U) / 2U);
+
+      //*******************************************
+      static constexpr uint64_t mix(size_t id, uint64_t seed)
+      {
+        return (uint64_t(id) + seed) * 0x9E3779B97F4A7C15ULL;
+      }
+
+      //*******************************************
+      static constexpr size_t bucket_of(uint64_t hash)
+      {
+        return size_t(hash >> 44) & (BUCKETS - 1U);
+      }
+
+      //*******************************************
+      static constexpr size_t base_of(uint64_t hash)
+      {
+        return size_t(hash >> 24) & (SLOTS - 1U);
+      }
+
+      //*******************************************
+      constexpr size_t slot_of(size_t id) const
+      {
+        const uint64_t hash = mix(id, seed);
+
+        return base_of(hash) ^ displacement[bucket_of(hash)];
+      }
+
+      uint64_t          seed;
+      size_t            displacement[BUCKETS];
+      etl::message_id_t slot_id[SLOTS];    ///< The ID in each slot.
+      size_t            slot_index[SLOTS]; ///< The index of the message in each slot, or COUNT if empty.
+      bool              valid;
+    };
+
+    //*************************************************************************
+    /// Tries to place every ID with the given seed.
+    /// The buckets are placed largest first, trying each displacement in turn.
+    //*************************************************************************
+    template <size_t COUNT>
+    constexpr bool place_ids(perfect_hash<COUNT>& hash, const etl::message_id_t* ids)
+    {
+      typedef perfect_hash<COUNT> hash_t;
+
+      size_t bucket[COUNT]                = {};
+      size_t bucket_size[hash_t::BUCKETS] = {};
+      bool   placed[hash_t::BUCKETS]      = {};
+      bool   used[hash_t::SLOTS]          = {};
+
+      for (size_t i = 0U; i < COUNT; ++i)
+      {
+        bucket[i] = hash_t::bucket_of(hash_t::mix(ids[i], hash.seed));
+        ++bucket_size[bucket[i]];
+      }
+
+      for (size_t n = 0U; n < hash_t::BUCKETS; ++n)
+      {
+        // Find the largest bucket not yet placed.
+        size_t b = hash_t::BUCKETS;
+
+        for (size_t i = 0U; i < hash_t::BUCKETS; ++i)
+        {
+          if (!placed[i] && ((b == hash_t::BUCKETS) || (bucket_size[i] > bucket_size[b])))
+          {
+            b = i;
+          }
+        }
+
+        placed[b] = true;
+
+        if (bucket_size[b] == 0U)
+        {
+          continue;
+        }
+
+        bool found = false;
+
+        for (size_t d = 0U; (d < hash_t::SLOTS) && !found; ++d)
+        {
+          found = true;
+
+          for (size_t i = 0U; (i < COUNT) && found; ++i)
+          {
+            if (bucket[i] == b)
+            {
+              const size_t slot = hash_t::base_of(hash_t::mix(ids[i], hash.seed)) ^ d;
+
+              // The slot must be free and not wanted by an earlier ID in the same bucket.
+              found = !used[slot];
+
+              for (size_t j = 0U; (j < i) && found; ++j)
+              {
+                found = !((bucket[j] == b) && ((hash_t::base_of(hash_t::mix(ids[j], hash.seed)) ^ d) == slot));
+              }
+            }
+          }
+
+          if (found)
+          {
+            hash.displacement[b] = d;
+
+            for (size_t i = 0U; i < COUNT; ++i)
+            {
+              if (bucket[i] == b)
+              {
+                const size_t slot = hash_t::base_of(hash_t::mix(ids[i], hash.seed)) ^ d;
+
+                used[slot]            = true;
+                hash.slot_id[slot]    = ids[i];
+                hash.slot_index[slot] = i;
+              }
+            }
+          }
+        }
+
+        if (!found)
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Builds the perfect hash, trying seeds until every ID has its own slot.
+    //*************************************************************************
+    template <size_t COUNT>
+    constexpr perfect_hash<COUNT> make_perfect_hash(const etl::message_id_t* ids)
+    {
+      perfect_hash<COUNT> hash = {};
+
+      for (uint64_t seed = 0U; seed < 64U; ++seed)
+      {
+        hash = perfect_hash<COUNT>{};
+        hash.seed = seed;
+
+        for (size_t i = 0U; i < perfect_hash<COUNT>::SLOTS; ++i)
+        {
+          hash.slot_index[i] = COUNT;
+        }
+
+        if (place_ids(hash, ids))
+        {
+          hash.valid = true;
+          return hash;
+        }
+      }
+
+      return hash;
+    }
+
+    //*************************************************************************
+    /// Lookup through a perfect hash of the IDs.
+    /// Used when the IDs are sparse.
+    //*************************************************************************
+    template <typename TRouter, typename TMessages>
+    struct hashed_dispatch;
+
+    template <typename TRouter, typename... TMessages>
+    struct hashed_dispatch<TRouter, type_list<TMessages...> >
+    {
+      typedef typename TRouter::handler_t handler_t;
+      typedef message_ids<TMessages...>    ids_t;
+
+      static const size_t COUNT = sizeof...(TMessages);
+
+      static constexpr handler_t           handlers[COUNT + 1U] = { &TRouter::template on_message<TMessages>..., &TRouter::on_unknown };
+      static constexpr perfect_hash<COUNT> hash                 = make_perfect_hash<COUNT>(ids_t::ids);
+
+      ETL_STATIC_ASSERT(hash.valid, "Unable to build a perfect hash of the message IDs");
+
+      //*******************************************
+      static size_t index_of(etl::message_id_t id)
+      {
+        const size_t slot = hash.slot_of(id);
+
+        return (hash.slot_id[slot] == id) ? hash.slot_index[slot] : COUNT;
+      }
+
+      //*******************************************
+      static handler_t lookup(etl::message_id_t id)
+      {
+        return handlers[index_of(id)];
+      }
+
+      //*******************************************
+      static bool accepts(etl::message_id_t id)
+      {
+        return index_of(id) != COUNT;
+      }
+    };
+
+    template <typename TRouter, typename... TMessages>
+    constexpr typename hashed_dispatch<TRouter, type_list<TMessages...> >::handler_t hashed_dispatch<TRouter, type_list<TMessages...> >::handlers[];
+
+    template <typename TRouter, typename... TMessages>
+    constexpr perfect_hash<hashed_dispatch<TRouter, type_list<TMessages...> >::COUNT> hashed_dispatch<TRouter, type_list<TMessages...> >::hash;
+#else
+    //*************************************************************************
+    /// Lookup by searching the IDs.
+    /// Used when the IDs are sparse and C++14 is not available to build a perfect hash.
+    //*************************************************************************
+    template <typename TRouter, typename TMessages>
+    struct hashed_dispatch;
+
+    template <typename TRouter, typename... TMessages>
+    struct hashed_dispatch<TRouter, type_list<TMessages...> >
+    {
+      typedef typename TRouter::handler_t handler_t;
+      typedef message_ids<TMessages...>    ids_t;
+
+      static const size_t COUNT = sizeof...(TMessages);
+
+      static constexpr handler_t handlers[COUNT + 1U] = { &TRouter::template on_message<TMessages>..., &TRouter::on_unknown };
+
+      //*******************************************
+      static size_t index_of(etl::message_id_t id)
+      {
+        size_t i = 0U;
+
+        while ((i < COUNT) && (ids_t::ids[i] != id))
+        {
+          ++i;
+        }
+
+        return i;
+      }
+
+      //*******************************************
+      static handler_t lookup(etl::message_id_t id)
+      {
+        return handlers[index_of(id)];
+      }
+
+      //*******************************************
+      static bool accepts(etl::message_id_t id)
+      {
+        return index_of(id) != COUNT;
+      }
+    };
+
+    template <typename TRouter, typename... TMessages>
+    constexpr typename hashed_dispatch<TRouter, type_list<TMessages...> >::handler_t hashed_dispatch<TRouter, type_list<TMessages...> >::handlers[];
+#endif
+
+    //*************************************************************************
+    /// Selects the dispatch for a set of messages.
+    /// TRouter supplies 'handler_t', 'on_message<T>' and 'on_unknown'.
+    //*************************************************************************
+    template <typename TRouter, typename... TMessages>
+    struct select_dispatch
+    {
+      typedef message_ids<TMessages...> ids_t;
+
+      static const size_t COUNT  = sizeof...(TMessages);
+      static const size_t MIN_ID = minimum_id(ids_t::ids, COUNT, size_t(ids_t::ids[0]));
+      static const size_t MAX_ID = maximum_id(ids_t::ids, COUNT, size_t(ids_t::ids[0]));
+      static const size_t RANGE  = (MAX_ID - MIN_ID) + 1U;
+
+      // A direct table is used if it would be no more than four times the number of messages.
+      static const bool DENSE = (RANGE <= (4U * COUNT)) || (RANGE <= 32U);
+
+      typedef dense_dispatch<TRouter,
+                             typename make_index_sequence<DENSE ? RANGE : 1U>::type,
+                             typename make_index_sequence<DENSE ? ((RANGE + 31U) / 32U) : 1U>::type,
+                             type_list<TMessages...> > dense_dispatch_t;
+
+      typedef hashed_dispatch<TRouter, type_list<TMessages...> > hashed_dispatch_t;
+
+      typedef typename etl::conditional<DENSE, dense_dispatch_t, hashed_dispatch_t>::type type;
+    };
+  }
+
+  //***************************************************************************
+  /// A message router for any number of message types.
+  /// 'receive' dispatches through a table of handlers built at compile time.
+  /// If the IDs are dense, the table is indexed by the ID and 'accepts' tests
+  /// a bit mask. Otherwise the table is a perfect hash of the IDs (C++14).
+  //***************************************************************************
+  template <typename TDerived, typename... TMessages>
+  class message_router : public imessage_router
+  {
+  private:
+
+    typedef private_message_router::message_ids<TMessages...> ids_t;
+
+  public:
+
+    ETL_STATIC_ASSERT(sizeof...(TMessages) > 0U, "A message router must handle at least one message");
+    ETL_STATIC_ASSERT(private_message_router::ids_are_unique(ids_t::ids, sizeof...(TMessages)), "Message IDs must be unique");
+
+    //**********************************************
+    class message_packet
+    {
+    public:
+
+      //********************************************
+      explicit message_packet(const etl::imessage& msg)
+      {
+        construct(msg, private_message_router::type_list<TMessages...>());
+      }
+
+      //********************************************
+      template <typename T>
+      explicit message_packet(const T& msg)
+      {
+        ETL_STATIC_ASSERT((etl::is_one_of<T, TMessages...>::value), "Unsupported type for this message packet");
+
+        void* p = data;
+        ::new (p) T(static_cast<const T&>(msg));
+      }
+
+      //********************************************
+      ~message_packet()
+      {
+        etl::imessage* pmsg = static_cast<etl::imessage*>(data);
+
+  #if defined(ETL_MESSAGES_ARE_VIRTUAL) || defined(ETL_POLYMORPHIC_MESSAGES)
+        pmsg->~imessage();
+  #else
+        destruct(pmsg, private_message_router::type_list<TMessages...>());
+  #endif
+      }
+
+      //********************************************
+      etl::imessage& get()
+      {
+        return *static_cast<etl::imessage*>(data);
+      }
+
+      //********************************************
+      const etl::imessage& get() const
+      {
+        return *static_cast<const etl::imessage*>(data);
+      }
+
+      enum
+      {
+        SIZE      = etl::largest<TMessages...>::size,
+        ALIGNMENT = etl::largest<TMessages...>::alignment
+      };
+
+    private:
+
+      //********************************************
+      template <typename T1, typename... TRest>
+      void construct(const etl::imessage& msg, private_message_router::type_list<T1, TRest...>)
+      {
+        if (msg.message_id == T1::ID)
+        {
+          void* p = data;
+          ::new (p) T1(static_cast<const T1&>(msg));
+        }
+        else
+        {
+          construct(msg, private_message_router::type_list<TRest...>());
+        }
+      }
+
+      //********************************************
+      void construct(const etl::imessage&, private_message_router::type_list<>)
+      {
+        ETL_ASSERT(false, ETL_ERROR(unhandled_message_exception));
+      }
+
+      //********************************************
+      template <typename T1, typename... TRest>
+      static void destruct(etl::imessage* pmsg, private_message_router::type_list<T1, TRest...>)
+      {
+        if (pmsg->message_id == T1::ID)
+        {
+          static_cast<T1*>(pmsg)->~T1();
+        }
+        else
+        {
+          destruct(pmsg, private_message_router::type_list<TRest...>());
+        }
+      }
+
+      //********************************************
+      static void destruct(etl::imessage*, private_message_router::type_list<>)
+      {
+        assert(false);
+      }
+
+      typename etl::aligned_storage<SIZE, ALIGNMENT>::type data;
+    };
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_)
+      : imessage_router(id_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    message_router(etl::message_router_id_t id_, etl::imessage_router& successor_)
+      : imessage_router(id_, successor_)
+    {
+      ETL_ASSERT(id_ <= etl::imessage_router::MAX_MESSAGE_ROUTER, ETL_ERROR(etl::message_router_illegal_id));
+    }
+
+    //**********************************************
+    void receive(const etl::imessage& msg)
+    {
+      receive(etl::null_message_router::instance(), msg);
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, etl::message_router_id_t destination_router_id, const etl::imessage& msg)
+    {
+      if ((destination_router_id == get_message_router_id()) || (destination_router_id == imessage_router::ALL_MESSAGE_ROUTERS))
+      {
+        receive(source, msg);
+      }
+    }
+
+    //**********************************************
+    void receive(etl::imessage_router& source, const etl::imessage& msg)
+    {
+      dispatch_t::lookup(msg.message_id)(*this, source, msg);
+    }
+
+    using imessage_router::accepts;
+
+    //**********************************************
+    bool accepts(etl::message_id_t id) const
+    {
+      return dispatch_t::accepts(id);
+    }
+
+    //********************************************
+    bool is_null_router() const
+    {
+      return false;
+    }
+
+  private:
+
+    template <typename, typename, typename, typename>
+    friend struct private_message_router::dense_dispatch;
+
+    template <typename, typename>
+    friend struct private_message_router::hashed_dispatch;
+
+    typedef void (*handler_t)(message_router&, etl::imessage_router&, const etl::imessage&);
+
+    typedef typename private_message_router::select_dispatch<message_router, TMessages...>::type dispatch_t;
+
+    //**********************************************
+    template <typename T>
+    static void on_message(message_router& router, etl::imessage_router& source, const etl::imessage& msg)
+    {
+      static_cast<TDerived&>(router).on_receive(source, static_cast<const T&>(msg));
+    }
+
+    //**********************************************
+    static void on_unknown(message_router& router, etl::imessage_router& source, const etl::imessage& msg)
+    {
+      if (router.has_successor())
+      {
+        router.get_successor().receive(source, msg);
+      }
+      else
+      {
+        static_cast<TDerived&>(router).on_receive_unknown(source, msg);
+      }
+    }
+  };
+#else
   /*[[[cog
       import cog
       ################################################
@@ -639,6 +1276,7 @@ namespace etl
           cog.outl("};")
   ]]]*/
   /*[[[end]]]*/
+#endif
 }
 
 #undef ETL_FILE
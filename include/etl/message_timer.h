@@ -40,6 +40,7 @@ SOFTWARE.
 #include "message_bus.h"
 #include "static_assert.h"
 #include "timer.h"
+#include "private/timer_wheel.h"
 #include "atomic.h"
 
 #undef ETL_FILE
@@ -383,7 +384,7 @@ namespace etl
           if (timer.is_active())
           {
             ETL_DISABLE_TIMER_UPDATES;
-            active_list.remove(timer.id, true);
+            remove_active(timer.id);
             ETL_ENABLE_TIMER_UPDATES;
           }
 
@@ -421,6 +422,11 @@ namespace etl
     {
       ETL_DISABLE_TIMER_UPDATES;
       active_list.clear();
+
+      if (p_wheel != nullptr)
+      {
+        p_wheel->clear();
+      }
       ETL_ENABLE_TIMER_UPDATES;
 
       for (int i = 0; i < MAX_TIMERS; ++i)
@@ -443,6 +449,20 @@ namespace etl
       {
         if (ETL_TIMER_UPDATES_ENABLED)
         {
+          if (p_wheel != nullptr)
+          {
+            // Expire the timers that are due now, then step through the elapsed time.
+            expire_wheel_timers();
+
+            while (count > 0)
+            {
+              count -= p_wheel->advance(count);
+              expire_wheel_timers();
+            }
+
+            return true;
+          }
+
           // We have something to do?
           bool has_active = !active_list.empty();
 
@@ -506,11 +526,10 @@ namespace etl
             ETL_DISABLE_TIMER_UPDATES;
             if (timer.is_active())
             {
-              active_list.remove(timer.id, false);
+              remove_active(timer.id);
             }
 
-            timer.delta = immediate_ ? 0 : timer.period;
-            active_list.insert(timer.id);
+            insert_active(timer.id, immediate_ ? 0 : timer.period);
             ETL_ENABLE_TIMER_UPDATES;
 
             result = true;
@@ -539,7 +558,7 @@ namespace etl
           if (timer.is_active())
           {
             ETL_DISABLE_TIMER_UPDATES;
-            active_list.remove(timer.id, false);
+            remove_active(timer.id);
             ETL_ENABLE_TIMER_UPDATES;
           }
 
@@ -583,9 +602,12 @@ namespace etl
     //*******************************************
     /// Constructor.
     //*******************************************
-    imessage_timer(message_timer_data* const timer_array_, const uint_least8_t  MAX_TIMERS_)
+    imessage_timer(message_timer_data* const timer_array_,
+                   const uint_least8_t  MAX_TIMERS_,
+                   private_timer::timer_wheel<message_timer_data>* const p_wheel_ = nullptr)
       : timer_array(timer_array_),
         active_list(timer_array_),
+        p_wheel(p_wheel_),
         enabled(false),
 #if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
         process_semaphore(0),
@@ -604,12 +626,74 @@ namespace etl
 
   private:
 
+    //*******************************************
+    /// Adds a timer to the active timers.
+    //*******************************************
+    void insert_active(etl::timer::id::type id_, uint32_t delay)
+    {
+      if (p_wheel != nullptr)
+      {
+        p_wheel->insert(id_, delay);
+      }
+      else
+      {
+        timer_array[id_].delta = delay;
+        active_list.insert(id_);
+      }
+    }
+
+    //*******************************************
+    /// Removes a timer from the active timers.
+    //*******************************************
+    void remove_active(etl::timer::id::type id_)
+    {
+      if (p_wheel != nullptr)
+      {
+        p_wheel->remove(id_);
+      }
+      else
+      {
+        active_list.remove(id_, false);
+      }
+    }
+
+    //*******************************************
+    /// Expires the timers in the wheel that are due now.
+    //*******************************************
+    void expire_wheel_timers()
+    {
+      etl::timer::id::type id = p_wheel->front();
+
+      while (id != etl::timer::id::NO_TIMER)
+      {
+        message_timer_data& timer = timer_array[id];
+
+        p_wheel->remove(id);
+
+        if (timer.repeating)
+        {
+          p_wheel->insert(id, timer.period);
+        }
+
+        if (timer.p_router != nullptr)
+        {
+          static etl::null_message_router nmr;
+          timer.p_router->receive(nmr, timer.destination_router_id, *(timer.p_message));
+        }
+
+        id = p_wheel->front();
+      }
+    }
+
     // The array of timer data structures.
     message_timer_data* const timer_array;
 
     // The list of active timers.
     private_message_timer::list active_list;
 
+    // The wheel of active timers, if used instead of the list.
+    private_timer::timer_wheel<message_timer_data>* const p_wheel;
+
     volatile bool enabled;
 
 #if defined(ETL_MESSAGE_TIMER_USE_ATOMIC_LOCK)
@@ -624,8 +708,10 @@ namespace etl
 
   //***************************************************************************
   /// The message timer
+  ///\tparam MAX_TIMERS_ The maximum number of timers. No more than 254.
+  ///\tparam TScheduler  etl::timer::scheduler::delta_list or etl::timer::scheduler::wheel.
   //***************************************************************************
-  template <uint_least8_t MAX_TIMERS_>
+  template <const uint_least8_t MAX_TIMERS_, typename TScheduler = etl::timer::scheduler::delta_list>
   class message_timer : public etl::imessage_timer
   {
   public:
@@ -644,6 +730,32 @@ namespace etl
 
     message_timer_data timer_array[MAX_TIMERS_];
   };
+
+  //***************************************************************************
+  /// The message timer, using a timing wheel.
+  //***************************************************************************
+  template <const uint_least8_t MAX_TIMERS_>
+  class message_timer<MAX_TIMERS_, etl::timer::scheduler::wheel> : public etl::imessage_timer
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TIMERS_ <= 254, "No more than 254 timers are allowed");
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    message_timer()
+      : imessage_timer(timer_array, MAX_TIMERS_, &wheel),
+        wheel(timer_array, slot_ids)
+    {
+    }
+
+  private:
+
+    message_timer_data timer_array[MAX_TIMERS_];
+    uint_least16_t slot_ids[MAX_TIMERS_];
+    private_timer::timer_wheel<message_timer_data> wheel;
+  };
 }
 
 #undef ETL_DISABLE_TIMER_UPDATES
@@ -36,6 +36,8 @@ SOFTWARE.
 #include "platform.h"
 #include "ihash.h"
 #include "binary.h"
+#include "array.h"
+#include "type_traits.h"
 #include "error_handler.h"
 
 #if defined(ETL_COMPILER_KEIL)
@@ -47,9 +49,34 @@ SOFTWARE.
 
 namespace etl
 {
+  namespace private_murmur3
+  {
+    //*************************************************************************
+    /// Reads a little endian 32 bit block, at any alignment.
+    /// Compilers make this a single load where the target allows.
+    //*************************************************************************
+    inline uint32_t get_block_32(const uint8_t* p)
+    {
+      return uint32_t(p[0]) |
+             (uint32_t(p[1]) << 8) |
+             (uint32_t(p[2]) << 16) |
+             (uint32_t(p[3]) << 24);
+    }
+
+    //*************************************************************************
+    /// Reads a little endian 64 bit block, at any alignment.
+    //*************************************************************************
+    inline uint64_t get_block_64(const uint8_t* p)
+    {
+      return uint64_t(get_block_32(p)) | (uint64_t(get_block_32(p + 4)) << 32);
+    }
+  }
+
   //***************************************************************************
   /// Calculates the murmur3 hash.
   /// See https://en.wikipedia.org/wiki/MurmurHash for more details.
+  /// murmur3<uint32_t> is MurmurHash3_x86_32.
+  /// Contiguous ranges, given as pointers, are hashed a block at a time.
   ///\ingroup murmur3
   //***************************************************************************
   template <typename THash>
@@ -84,19 +111,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename ETLSTD::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
 
       reset();
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add(begin, end);
     }
 
     //*************************************************************************
@@ -122,19 +137,7 @@ namespace etl
       ETL_STATIC_ASSERT(sizeof(typename ETLSTD::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      while (begin != end)
-      {
-        block |= (*begin++) << (block_fill_count * 8);
-
-        if (++block_fill_count == FULL_BLOCK)
-        {
-          add_block();
-          block_fill_count = 0;
-          block = 0;
-        }
-
-        ++char_count;
-      }
+      add_range(begin, end, etl::is_pointer<TIterator>());
     }
 
     //*************************************************************************
@@ -147,16 +150,7 @@ namespace etl
       // We can't add to a finalised hash!
       ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
 
-      block |= value_ << (block_fill_count * 8);
-
-      if (++block_fill_count == FULL_BLOCK)
-      {
-        add_block();
-        block_fill_count = 0;
-        block = 0;
-      }
-
-      ++char_count;
+      add_char(value_);
     }
 
     //*************************************************************************
@@ -178,16 +172,76 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Adds a range, a char at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type /*is_pointer*/)
+    {
+      while (begin != end)
+      {
+        add_char(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time once the current one is full.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin_, const TIterator end_, etl::true_type /*is_pointer*/)
+    {
+      const uint8_t* begin = reinterpret_cast<const uint8_t*>(begin_);
+      const uint8_t* end   = reinterpret_cast<const uint8_t*>(end_);
+
+      // Complete a block started by a previous call.
+      while ((begin != end) && (block_fill_count != 0))
+      {
+        add_char(*begin++);
+      }
+
+      const size_t blocks = size_t(end - begin) / FULL_BLOCK;
+
+      for (size_t i = 0; i < blocks; ++i)
+      {
+        add_block(private_murmur3::get_block_32(begin));
+        begin += FULL_BLOCK;
+      }
+
+      char_count += blocks * FULL_BLOCK;
+
+      while (begin != end)
+      {
+        add_char(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a char to the current block.
+    //*************************************************************************
+    void add_char(uint8_t value_)
+    {
+      block |= value_type(value_) << (block_fill_count * 8);
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(block);
+        block_fill_count = 0;
+        block = 0;
+      }
+
+      ++char_count;
+    }
+
     //*************************************************************************
     /// Adds a filled block to the hash.
     //*************************************************************************
-    void add_block()
+    void add_block(value_type k)
     {
-      block *= CONSTANT1;
-      block = rotate_left(block, SHIFT1);
-      block *= CONSTANT2;
+      k *= CONSTANT1;
+      k = rotate_left(k, SHIFT1);
+      k *= CONSTANT2;
 
-      hash ^= block;
+      hash ^= k;
       hash = rotate_left(hash, SHIFT2);
       hash = (hash * MULTIPLY) + ADD;
     }
@@ -230,6 +284,259 @@ namespace etl
     static const value_type MULTIPLY   = 5;
     static const value_type ADD        = 0xE6546B64;
   };
+
+  //***************************************************************************
+  /// Calculates the 128 bit MurmurHash3_x64_128 hash.
+  /// The value is { h1, h2 }, as the reference implementation writes them.
+  /// Contiguous ranges, given as pointers, are hashed a block at a time.
+  ///\ingroup murmur3
+  //***************************************************************************
+  class murmur3_x64_128
+  {
+  public:
+
+    typedef etl::array<uint64_t, 2> value_type;
+
+    //*************************************************************************
+    /// Default constructor.
+    /// \param seed The seed value. Default = 0.
+    //*************************************************************************
+    murmur3_x64_128(uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      reset();
+    }
+
+    //*************************************************************************
+    /// Constructor from range.
+    /// \param begin Start of the range.
+    /// \param end   End of the range.
+    /// \param seed  The seed value. Default = 0.
+    //*************************************************************************
+    template<typename TIterator>
+    murmur3_x64_128(TIterator begin, const TIterator end, uint32_t seed_ = 0)
+      : seed(seed_)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename ETLSTD::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+
+      reset();
+      add(begin, end);
+    }
+
+    //*************************************************************************
+    /// Resets the hash to the initial state.
+    //*************************************************************************
+    void reset()
+    {
+      h1               = seed;
+      h2               = seed;
+      char_count       = 0;
+      block_fill_count = 0;
+      is_finalised     = false;
+    }
+
+    //*************************************************************************
+    /// Adds a range.
+    /// \param begin
+    /// \param end
+    //*************************************************************************
+    template<typename TIterator>
+    void add(TIterator begin, const TIterator end)
+    {
+      ETL_STATIC_ASSERT(sizeof(typename ETLSTD::iterator_traits<TIterator>::value_type) == 1, "Incompatible type");
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_range(begin, end, etl::is_pointer<TIterator>());
+    }
+
+    //*************************************************************************
+    /// Adds a uint8_t value.
+    /// If the hash has already been finalised then a 'hash_finalised' error will be emitted.
+    /// \param value The char to add to the hash.
+    //*************************************************************************
+    void add(uint8_t value_)
+    {
+      // We can't add to a finalised hash!
+      ETL_ASSERT(!is_finalised, ETL_ERROR(hash_finalised));
+
+      add_char(value_);
+    }
+
+    //*************************************************************************
+    /// Gets the hash value.
+    //*************************************************************************
+    value_type value()
+    {
+      finalise();
+
+      value_type result;
+      result[0] = h1;
+      result[1] = h2;
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Conversion operator to value_type.
+    //*************************************************************************
+    operator value_type ()
+    {
+      return value();
+    }
+
+  private:
+
+    //*************************************************************************
+    /// Adds a range, a char at a time.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin, const TIterator end, etl::false_type /*is_pointer*/)
+    {
+      while (begin != end)
+      {
+        add_char(uint8_t(*begin++));
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a contiguous range, a block at a time once the current one is full.
+    //*************************************************************************
+    template<typename TIterator>
+    void add_range(TIterator begin_, const TIterator end_, etl::true_type /*is_pointer*/)
+    {
+      const uint8_t* begin = reinterpret_cast<const uint8_t*>(begin_);
+      const uint8_t* end   = reinterpret_cast<const uint8_t*>(end_);
+
+      // Complete a block started by a previous call.
+      while ((begin != end) && (block_fill_count != 0))
+      {
+        add_char(*begin++);
+      }
+
+      const size_t blocks = size_t(end - begin) / FULL_BLOCK;
+
+      for (size_t i = 0; i < blocks; ++i)
+      {
+        add_block(private_murmur3::get_block_64(begin), private_murmur3::get_block_64(begin + 8));
+        begin += FULL_BLOCK;
+      }
+
+      char_count += blocks * FULL_BLOCK;
+
+      while (begin != end)
+      {
+        add_char(*begin++);
+      }
+    }
+
+    //*************************************************************************
+    /// Adds a char to the current block.
+    //*************************************************************************
+    void add_char(uint8_t value_)
+    {
+      block[block_fill_count] = value_;
+
+      if (++block_fill_count == FULL_BLOCK)
+      {
+        add_block(private_murmur3::get_block_64(block), private_murmur3::get_block_64(block + 8));
+        block_fill_count = 0;
+      }
+
+      ++char_count;
+    }
+
+    //*************************************************************************
+    /// Adds a filled block to the hash.
+    //*************************************************************************
+    void add_block(uint64_t k1, uint64_t k2)
+    {
+      h1 ^= mix_k1(k1);
+      h1  = rotate_left(h1, 27);
+      h1 += h2;
+      h1  = (h1 * 5) + 0x52DCE729;
+
+      h2 ^= mix_k2(k2);
+      h2  = rotate_left(h2, 31);
+      h2 += h1;
+      h2  = (h2 * 5) + 0x38495AB5;
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k1(uint64_t k1)
+    {
+      k1 *= CONSTANT1;
+      k1  = rotate_left(k1, 31);
+      k1 *= CONSTANT2;
+
+      return k1;
+    }
+
+    //*************************************************************************
+    static uint64_t mix_k2(uint64_t k2)
+    {
+      k2 *= CONSTANT2;
+      k2  = rotate_left(k2, 33);
+      k2 *= CONSTANT1;
+
+      return k2;
+    }
+
+    //*************************************************************************
+    static uint64_t fmix(uint64_t k)
+    {
+      k ^= k >> 33;
+      k *= 0xFF51AFD7ED558CCDULL;
+      k ^= k >> 33;
+      k *= 0xC4CEB9FE1A85EC53ULL;
+      k ^= k >> 33;
+
+      return k;
+    }
+
+    //*************************************************************************
+    /// Finalises the hash.
+    //*************************************************************************
+    void finalise()
+    {
+      if (!is_finalised)
+      {
+        // The tail. Unused chars are zero, which adds nothing.
+        for (size_t i = block_fill_count; i < FULL_BLOCK; ++i)
+        {
+          block[i] = 0;
+        }
+
+        h1 ^= mix_k1(private_murmur3::get_block_64(block));
+        h2 ^= mix_k2(private_murmur3::get_block_64(block + 8));
+
+        h1 ^= uint64_t(char_count);
+        h2 ^= uint64_t(char_count);
+
+        h1 += h2;
+        h2 += h1;
+
+        h1 = fmix(h1);
+        h2 = fmix(h2);
+
+        h1 += h2;
+        h2 += h1;
+
+        is_finalised = true;
+      }
+    }
+
+    bool     is_finalised;
+    uint8_t  block_fill_count;
+    size_t   char_count;
+    uint8_t  block[16];
+    uint64_t h1;
+    uint64_t h2;
+    uint32_t seed;
+
+    static const uint8_t  FULL_BLOCK = 16;
+    static const uint64_t CONSTANT1  = 0x87C37B91114253D5ULL;
+    static const uint64_t CONSTANT2  = 0x4CF5AD432745937FULL;
+  };
 }
 
 #endif
@@ -31,7 +31,16 @@ SOFTWARE.
 
 #include "platform.h"
 
-#if ETL_CPP11_SUPPORTED == 1 && !defined(ETL_NO_STL)
+// Define ETL_MUTEX_USE_FUTEX to back etl::mutex with a futex on Linux.
+// etl::mutex_futex, in mutex/mutex_futex.h, may also be used directly.
+#if defined(ETL_TARGET_OS_LINUX) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && defined(ETL_MUTEX_USE_FUTEX)
+  #include "mutex/mutex_futex.h"
+  namespace etl
+  {
+    typedef etl::mutex_futex mutex;
+  }
+  #define ETL_HAS_MUTEX 1
+#elif ETL_CPP11_SUPPORTED == 1 && !defined(ETL_NO_STL)
   #include "mutex/mutex_std.h"
   #define ETL_HAS_MUTEX 1
 #elif defined(ETL_COMPILER_ARM)
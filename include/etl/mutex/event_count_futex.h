@@ -0,0 +1,142 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_COUNT_FUTEX_INCLUDED
+#define ETL_EVENT_COUNT_FUTEX_INCLUDED
+
+#include "../platform.h"
+#include "futex_operations.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief An event count implemented using a Linux futex.
+  /// Threads wait for a condition to become true; other threads make it true
+  /// and then notify. Notifying only makes a system call when a thread is waiting.
+  //***************************************************************************
+  class event_count_futex
+  {
+  public:
+
+    event_count_futex()
+      : sequence(0U),
+        waiters(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Waits until 'ready()' returns true or the timeout expires.
+    /// 'ready' is called once before waiting and again after each wake up.
+    ///\param ready      A function object returning bool.
+    ///\param timeout_ms The maximum time to wait, in milliseconds.
+    ///\return The last result of 'ready()'.
+    //*************************************************************************
+    template <typename TPredicate>
+    bool wait_for(TPredicate ready, uint32_t timeout_ms)
+    {
+      if (ready())
+      {
+        return true;
+      }
+
+      const int64_t deadline = etl::private_mutex::monotonic_ms() + timeout_ms;
+
+      __atomic_add_fetch(&waiters, 1U, __ATOMIC_SEQ_CST);
+
+      bool result = false;
+
+      while (true)
+      {
+        // Read the sequence before checking, so that a notify in between is not missed.
+        uint32_t key = __atomic_load_n(&sequence, __ATOMIC_SEQ_CST);
+
+        if (ready())
+        {
+          result = true;
+          break;
+        }
+
+        int64_t remaining = deadline - etl::private_mutex::monotonic_ms();
+
+        if (remaining <= 0)
+        {
+          break;
+        }
+
+        // 0 < remaining <= timeout_ms, so it fits.
+        etl::private_mutex::futex_wait_for(&sequence, key, uint32_t(remaining));
+      }
+
+      __atomic_sub_fetch(&waiters, 1U, __ATOMIC_SEQ_CST);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Wakes one waiting thread.
+    /// Call after making the condition true.
+    //*************************************************************************
+    void notify_one()
+    {
+      __atomic_add_fetch(&sequence, 1U, __ATOMIC_SEQ_CST);
+
+      if (__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0U)
+      {
+        etl::private_mutex::futex_wake(&sequence, 1);
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes all waiting threads.
+    /// Call after making the condition true.
+    //*************************************************************************
+    void notify_all()
+    {
+      __atomic_add_fetch(&sequence, 1U, __ATOMIC_SEQ_CST);
+
+      if (__atomic_load_n(&waiters, __ATOMIC_SEQ_CST) != 0U)
+      {
+        etl::private_mutex::futex_wake_all(&sequence);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    event_count_futex(const event_count_futex&);
+    event_count_futex& operator =(const event_count_futex&);
+
+    volatile uint32_t sequence; ///< Incremented by each notify. The futex word.
+    volatile uint32_t waiters;  ///< The number of threads in wait_for.
+  };
+}
+
+#endif
@@ -0,0 +1,156 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_EVENT_COUNT_STD_INCLUDED
+#define ETL_EVENT_COUNT_STD_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief An event count implemented using std::condition_variable.
+  /// Threads wait for a condition to become true; other threads make it true
+  /// and then notify. Notifying only takes the internal lock when a thread is waiting.
+  //***************************************************************************
+  class event_count_std
+  {
+  public:
+
+    event_count_std()
+      : sequence(0U),
+        waiters(0U)
+    {
+    }
+
+    //*************************************************************************
+    /// Waits until 'ready()' returns true or the timeout expires.
+    /// 'ready' is called once before waiting and again after each wake up.
+    ///\param ready      A function object returning bool.
+    ///\param timeout_ms The maximum time to wait, in milliseconds.
+    ///\return The last result of 'ready()'.
+    //*************************************************************************
+    template <typename TPredicate>
+    bool wait_for(TPredicate ready, uint32_t timeout_ms)
+    {
+      if (ready())
+      {
+        return true;
+      }
+
+      const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+
+      std::unique_lock<std::mutex> lock(access);
+
+      waiters.fetch_add(1U);
+
+      bool result = false;
+
+      while (true)
+      {
+        // Synchronise with the last notify, so that the condition it published is seen.
+        (void)sequence.load();
+
+        if (ready())
+        {
+          result = true;
+          break;
+        }
+
+        if (condition.wait_until(lock, deadline) == std::cv_status::timeout)
+        {
+          result = ready();
+          break;
+        }
+      }
+
+      waiters.fetch_sub(1U);
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Wakes one waiting thread.
+    /// Call after making the condition true.
+    //*************************************************************************
+    void notify_one()
+    {
+      sequence.fetch_add(1U);
+
+      if (waiters.load() != 0U)
+      {
+        // A waiter is either before its check, and will see the change,
+        // or waiting on the condition.
+        {
+          std::lock_guard<std::mutex> lock(access);
+        }
+
+        condition.notify_one();
+      }
+    }
+
+    //*************************************************************************
+    /// Wakes all waiting threads.
+    /// Call after making the condition true.
+    //*************************************************************************
+    void notify_all()
+    {
+      sequence.fetch_add(1U);
+
+      if (waiters.load() != 0U)
+      {
+        {
+          std::lock_guard<std::mutex> lock(access);
+        }
+
+        condition.notify_all();
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    event_count_std(const event_count_std&);
+    event_count_std& operator =(const event_count_std&);
+
+    std::mutex              access;
+    std::condition_variable condition;
+    std::atomic<uint32_t>   sequence; ///< Incremented by each notify.
+    std::atomic<uint32_t>   waiters;  ///< The number of threads in wait_for.
+  };
+}
+
+#endif
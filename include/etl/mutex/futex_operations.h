@@ -0,0 +1,107 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MUTEX_FUTEX_OPERATIONS_INCLUDED
+#define ETL_MUTEX_FUTEX_OPERATIONS_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+#include <limits.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+namespace etl
+{
+  namespace private_mutex
+  {
+    //*************************************************************************
+    /// Converts a timeout in milliseconds to a timespec.
+    /// The arithmetic is unsigned, so that every uint32_t timeout is valid.
+    //*************************************************************************
+    inline struct timespec make_timespec(uint32_t timeout_ms)
+    {
+      struct timespec timeout;
+      timeout.tv_sec  = time_t(timeout_ms / 1000U);
+      timeout.tv_nsec = long(timeout_ms % 1000U) * 1000000L;
+
+      return timeout;
+    }
+
+    //*************************************************************************
+    /// Sleeps while '*p_word' equals 'expected', until woken.
+    /// Returns early on a wake, a signal or a spurious wake up.
+    //*************************************************************************
+    inline void futex_wait(volatile uint32_t* p_word, uint32_t expected)
+    {
+      syscall(SYS_futex, p_word, FUTEX_WAIT_PRIVATE, expected, 0, 0, 0);
+    }
+
+    //*************************************************************************
+    /// Sleeps while '*p_word' equals 'expected', for at most 'timeout_ms'.
+    /// Returns early on a wake, a signal or a spurious wake up.
+    //*************************************************************************
+    inline void futex_wait_for(volatile uint32_t* p_word, uint32_t expected, uint32_t timeout_ms)
+    {
+      struct timespec timeout = make_timespec(timeout_ms);
+
+      syscall(SYS_futex, p_word, FUTEX_WAIT_PRIVATE, expected, &timeout, 0, 0);
+    }
+
+    //*************************************************************************
+    /// Wakes up to 'count' threads sleeping on 'p_word'.
+    //*************************************************************************
+    inline void futex_wake(volatile uint32_t* p_word, int count)
+    {
+      syscall(SYS_futex, p_word, FUTEX_WAKE_PRIVATE, count, 0, 0, 0);
+    }
+
+    //*************************************************************************
+    /// Wakes all threads sleeping on 'p_word'.
+    //*************************************************************************
+    inline void futex_wake_all(volatile uint32_t* p_word)
+    {
+      futex_wake(p_word, INT_MAX);
+    }
+
+    //*************************************************************************
+    /// A monotonic time in milliseconds, for timeouts.
+    //*************************************************************************
+    inline int64_t monotonic_ms()
+    {
+      struct timespec now;
+      clock_gettime(CLOCK_MONOTONIC, &now);
+
+      return (int64_t(now.tv_sec) * 1000) + (now.tv_nsec / 1000000L);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,115 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MUTEX_FUTEX_INCLUDED
+#define ETL_MUTEX_FUTEX_INCLUDED
+
+#include "../platform.h"
+#include "spin_backoff.h"
+#include "futex_operations.h"
+
+#include <stdint.h>
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup mutex
+  ///\brief This mutex class is implemented using a Linux futex.
+  /// A waiter first spins with a bounded exponential backoff, then sleeps in
+  /// the kernel until the holder unlocks. Unlocking only makes a system call
+  /// when there may be a sleeping waiter.
+  //***************************************************************************
+  class mutex_futex
+  {
+  public:
+
+    mutex_futex()
+      : state(UNLOCKED)
+    {
+    }
+
+    void lock()
+    {
+      uint32_t expected = UNLOCKED;
+
+      if (__atomic_compare_exchange_n(&state, &expected, LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+      {
+        return;
+      }
+
+      // Spin for a while, in case the holder is about to unlock.
+      etl::private_mutex::spin_backoff backoff;
+
+      while (backoff.spin())
+      {
+        expected = UNLOCKED;
+
+        if ((__atomic_load_n(&state, __ATOMIC_RELAXED) == UNLOCKED) &&
+            __atomic_compare_exchange_n(&state, &expected, LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+          return;
+        }
+      }
+
+      // Mark the mutex as contended and sleep until it is unlocked.
+      while (__atomic_exchange_n(&state, CONTENDED, __ATOMIC_ACQUIRE) != UNLOCKED)
+      {
+        etl::private_mutex::futex_wait(&state, CONTENDED);
+      }
+    }
+
+    bool try_lock()
+    {
+      uint32_t expected = UNLOCKED;
+
+      return __atomic_compare_exchange_n(&state, &expected, LOCKED, false, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+    }
+
+    void unlock()
+    {
+      if (__atomic_exchange_n(&state, UNLOCKED, __ATOMIC_RELEASE) == CONTENDED)
+      {
+        etl::private_mutex::futex_wake(&state, 1);
+      }
+    }
+
+  private:
+
+    // Disable copy construction and assignment.
+    mutex_futex(const mutex_futex&);
+    mutex_futex& operator =(const mutex_futex&);
+
+    static const uint32_t UNLOCKED  = 0U;
+    static const uint32_t LOCKED    = 1U; ///< Locked, with no sleeping waiters.
+    static const uint32_t CONTENDED = 2U; ///< Locked, and there may be sleeping waiters.
+
+    volatile uint32_t state;
+  };
+}
+
+#endif
@@ -30,6 +30,7 @@ SOFTWARE.
 #define ETL_MUTEX_GCC_SYNC_INCLUDED
 
 #include "../platform.h"
+#include "spin_backoff.h"
 
 #include <stdint.h>
 
@@ -38,6 +39,7 @@ namespace etl
   //***************************************************************************
   ///\ingroup mutex
   ///\brief This mutex class is implemented using GCC's __sync functions.
+  /// Waiters spin with a bounded exponential backoff.
   //***************************************************************************
   class mutex
   {
@@ -46,26 +48,33 @@ namespace etl
     mutex()
       : flag(0)
     {
-      __sync_lock_release(flag);
+      __sync_lock_release(&flag);
     }
 
     void lock()
     {
+      etl::private_mutex::spin_backoff backoff;
+
       while (__sync_lock_test_and_set(&flag, 1U))
       {
         while (flag)
         {
+          if (!backoff.spin())
+          {
+            backoff.spin_at_limit();
+          }
         }
+      }
     }
 
     bool try_lock()
     {
-      return (__sync_lock_test_and_set(&flag, 1U) == 1U);
+      return (__sync_lock_test_and_set(&flag, 1U) == 0U);
     }
 
     void unlock()
     {
-      __sync_lock_release(flag);
+      __sync_lock_release(&flag);
     }
 
   private:
@@ -0,0 +1,115 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MUTEX_SPIN_BACKOFF_INCLUDED
+#define ETL_MUTEX_SPIN_BACKOFF_INCLUDED
+
+#include "../platform.h"
+
+#include <stdint.h>
+
+#if !defined(ETL_MUTEX_SPIN_LIMIT)
+  /// The maximum number of pauses in one round of spinning.
+  /// Each round doubles the number of pauses, up to this limit.
+  #define ETL_MUTEX_SPIN_LIMIT 64U
+#endif
+
+namespace etl
+{
+  namespace private_mutex
+  {
+    //*************************************************************************
+    /// Tells the processor that this is a spin-wait loop.
+    /// Reduces power and frees pipeline resources for a hyper-thread sibling.
+    //*************************************************************************
+    inline void cpu_relax()
+    {
+#if defined(__i386__) || defined(__x86_64__)
+      __builtin_ia32_pause();
+#elif defined(__aarch64__) || (defined(__ARM_ARCH) && (__ARM_ARCH >= 7))
+      __asm__ __volatile__("yield" ::: "memory");
+#else
+      __asm__ __volatile__("" ::: "memory");
+#endif
+    }
+
+    //*************************************************************************
+    /// Bounded exponential backoff for spin loops.
+    /// Each call to spin() pauses twice as long as the one before, until
+    /// ETL_MUTEX_SPIN_LIMIT is reached.
+    //*************************************************************************
+    class spin_backoff
+    {
+    public:
+
+      spin_backoff()
+        : count(1U)
+      {
+      }
+
+      //***********************************************************************
+      /// Pauses for the current round.
+      /// Returns false, without pausing, once the limit has been passed.
+      //***********************************************************************
+      bool spin()
+      {
+        if (count > ETL_MUTEX_SPIN_LIMIT)
+        {
+          return false;
+        }
+
+        for (uint32_t i = 0U; i < count; ++i)
+        {
+          cpu_relax();
+        }
+
+        count <<= 1;
+
+        return true;
+      }
+
+      //***********************************************************************
+      /// Pauses for the longest round.
+      /// Used where there is no way to sleep.
+      //***********************************************************************
+      void spin_at_limit()
+      {
+        for (uint32_t i = 0U; i < ETL_MUTEX_SPIN_LIMIT; ++i)
+        {
+          cpu_relax();
+        }
+      }
+
+    private:
+
+      uint32_t count;
+    };
+  }
+}
+
+#endif
@@ -113,6 +113,30 @@ namespace etl
     {}
   };
 
+  namespace private_pool
+  {
+    //*************************************************************************
+    /// The free item management for a pool that is shared between threads.
+    /// ipool forwards allocation, release and size queries to it when one is
+    /// supplied by the derived pool.
+    //*************************************************************************
+    class ishared_free_list
+    {
+    public:
+
+      virtual char*  shared_allocate() = 0;
+      virtual void   shared_release(char* p_value) = 0;
+      virtual void   shared_release_all() = 0;
+      virtual size_t shared_size() const = 0;
+
+    protected:
+
+      ~ishared_free_list()
+      {
+      }
+    };
+  }
+
   //***************************************************************************
   ///\ingroup pool
   //***************************************************************************
@@ -264,6 +288,12 @@ namespace etl
     //*************************************************************************
     void release_all()
     {
+      if (p_shared != nullptr)
+      {
+        p_shared->shared_release_all();
+        return;
+      }
+
       items_allocated = 0;
       items_initialised = 0;
       p_next = p_buffer;
@@ -293,7 +323,7 @@ namespace etl
     //*************************************************************************
     size_t available() const
     {
-      return MAX_SIZE - items_allocated;
+      return MAX_SIZE - size();
     }
 
     //*************************************************************************
@@ -301,7 +331,7 @@ namespace etl
     //*************************************************************************
     size_t size() const
     {
-      return items_allocated;
+      return (p_shared != nullptr) ? p_shared->shared_size() : items_allocated;
     }
 
     //*************************************************************************
@@ -310,7 +340,7 @@ namespace etl
     //*************************************************************************
     bool empty() const
     {
-      return items_allocated == 0;
+      return size() == 0;
     }
 
     //*************************************************************************
@@ -319,7 +349,7 @@ namespace etl
     //*************************************************************************
     bool full() const
     {
-      return items_allocated == MAX_SIZE;
+      return size() == MAX_SIZE;
     }
 
   protected:
@@ -333,7 +363,22 @@ namespace etl
         items_allocated(0),
         items_initialised(0),
         ITEM_SIZE(item_size_),
-        MAX_SIZE(max_size_)
+        MAX_SIZE(max_size_),
+        p_shared(nullptr)
+    {
+    }
+
+    //*************************************************************************
+    /// Constructor for pools that manage their own free items.
+    //*************************************************************************
+    ipool(char* p_buffer_, uint32_t item_size_, uint32_t max_size_, private_pool::ishared_free_list* p_shared_)
+      : p_buffer(p_buffer_),
+        p_next(nullptr),
+        items_allocated(0),
+        items_initialised(0),
+        ITEM_SIZE(item_size_),
+        MAX_SIZE(max_size_),
+        p_shared(p_shared_)
     {
     }
 
@@ -346,6 +391,18 @@ namespace etl
     {
       char* p_value = nullptr;
 
+      if (p_shared != nullptr)
+      {
+        p_value = p_shared->shared_allocate();
+
+        if (p_value == nullptr)
+        {
+          ETL_ASSERT(false, ETL_ERROR(pool_no_allocation));
+        }
+
+        return p_value;
+      }
+
       // Any free space left?
       if (items_allocated < MAX_SIZE)
       {
@@ -389,6 +446,12 @@ namespace etl
       // Does it belong to us?
       ETL_ASSERT(is_item_in_pool(p_value), ETL_ERROR(pool_object_not_in_pool));
 
+      if (p_shared != nullptr)
+      {
+        p_shared->shared_release(p_value);
+        return;
+      }
+
       if (p_next != nullptr)
       {
         // Point it to the current free item.
@@ -438,6 +501,8 @@ namespace etl
     const uint32_t ITEM_SIZE;    ///< The size of allocated items.
     const uint32_t MAX_SIZE;    ///< The maximum number of objects that can be allocated.
 
+    private_pool::ishared_free_list* p_shared; ///< The free list of a pool shared between threads, or nullptr.
+
     //*************************************************************************
     /// Destructor.
     //*************************************************************************
@@ -0,0 +1,301 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_BIT_STREAM_UNPACK_INCLUDED
+#define ETL_BIT_STREAM_UNPACK_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+
+//*****************************************************************************
+// Fields of 1, 2, 4, 8 and 16 bits are unpacked 16 chars at a time, using
+// SSE2 or NEON where the target supports it.
+// Define ETL_BIT_STREAM_NO_SIMD to always use the scalar unpack.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_BIT_STREAM_NO_SIMD)
+  #if defined(__SSE2__)
+    #define ETL_BIT_STREAM_SSE2_SUPPORTED 1
+    #include <emmintrin.h>
+  #elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_BIT_STREAM_NEON_SUPPORTED 1
+    #include <arm_neon.h>
+  #endif
+#endif
+
+#if !defined(ETL_BIT_STREAM_SSE2_SUPPORTED)
+  #define ETL_BIT_STREAM_SSE2_SUPPORTED 0
+#endif
+
+#if !defined(ETL_BIT_STREAM_NEON_SUPPORTED)
+  #define ETL_BIT_STREAM_NEON_SUPPORTED 0
+#endif
+
+///\ingroup private
+
+namespace etl
+{
+  namespace private_bit_stream
+  {
+    /// The number of chars unpacked at a time.
+    static const size_t BLOCK_CHARS = 16U;
+
+    //*************************************************************************
+    /// Returns true if fields of 'width' bits can be unpacked a block at a time.
+    //*************************************************************************
+    inline bool is_block_width(uint_least8_t width)
+    {
+      return (width == 1U) || (width == 2U) || (width == 4U) || (width == 8U) || (width == 16U);
+    }
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into fields of 1, 2, 4 or 8 bits.
+    /// The fields are stored most significant first, as in the stream.
+    ///\param p     The chars.
+    ///\param width The width of each field.
+    ///\param out   Receives (BLOCK_CHARS * 8) / width fields.
+    //*************************************************************************
+    inline void unpack_block_scalar(const unsigned char* p, uint_least8_t width, uint8_t* out)
+    {
+      const uint8_t mask = uint8_t((1U << width) - 1U);
+
+      for (size_t i = 0U; i < BLOCK_CHARS; ++i)
+      {
+        const uint8_t c = p[i];
+
+        for (int shift = 8 - int(width); shift >= 0; shift -= int(width))
+        {
+          *out++ = uint8_t((c >> shift) & mask);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into 16 bit fields, in network order.
+    ///\param p   The chars.
+    ///\param out Receives BLOCK_CHARS / 2 fields.
+    //*************************************************************************
+    inline void unpack_block_16_scalar(const unsigned char* p, uint16_t* out)
+    {
+      for (size_t i = 0U; i < (BLOCK_CHARS / 2U); ++i)
+      {
+        out[i] = uint16_t((uint16_t(p[2U * i]) << 8) | p[(2U * i) + 1U]);
+      }
+    }
+
+#if ETL_BIT_STREAM_SSE2_SUPPORTED
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into fields of 1, 2, 4 or 8 bits. SSE2.
+    //*************************************************************************
+    inline void unpack_block_simd(const unsigned char* p, uint_least8_t width, uint8_t* out)
+    {
+      const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      __m128i* pout = reinterpret_cast<__m128i*>(out);
+
+      switch (width)
+      {
+        case 1U:
+        {
+          // Spread each char over eight lanes, then test one bit per lane.
+          const __m128i bits = _mm_setr_epi8(char(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+                                             char(0x80), 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+          const __m128i one  = _mm_set1_epi8(1);
+
+          const __m128i twos[2] = { _mm_unpacklo_epi8(chars, chars), _mm_unpackhi_epi8(chars, chars) };
+
+          for (size_t i = 0U; i < 2U; ++i)
+          {
+            const __m128i fours[2] = { _mm_unpacklo_epi16(twos[i], twos[i]), _mm_unpackhi_epi16(twos[i], twos[i]) };
+
+            for (size_t j = 0U; j < 2U; ++j)
+            {
+              const __m128i eights[2] = { _mm_unpacklo_epi32(fours[j], fours[j]), _mm_unpackhi_epi32(fours[j], fours[j]) };
+
+              for (size_t k = 0U; k < 2U; ++k)
+              {
+                const __m128i set = _mm_cmpeq_epi8(_mm_and_si128(eights[k], bits), bits);
+                _mm_storeu_si128(pout++, _mm_and_si128(set, one));
+              }
+            }
+          }
+          break;
+        }
+
+        case 2U:
+        {
+          const __m128i mask = _mm_set1_epi8(0x03);
+
+          // Shifting 16 bit lanes is fine, as the mask drops the bits from the neighbouring char.
+          const __m128i f0 = _mm_and_si128(_mm_srli_epi16(chars, 6), mask);
+          const __m128i f1 = _mm_and_si128(_mm_srli_epi16(chars, 4), mask);
+          const __m128i f2 = _mm_and_si128(_mm_srli_epi16(chars, 2), mask);
+          const __m128i f3 = _mm_and_si128(chars, mask);
+
+          const __m128i lo01 = _mm_unpacklo_epi8(f0, f1);
+          const __m128i lo23 = _mm_unpacklo_epi8(f2, f3);
+          const __m128i hi01 = _mm_unpackhi_epi8(f0, f1);
+          const __m128i hi23 = _mm_unpackhi_epi8(f2, f3);
+
+          _mm_storeu_si128(pout + 0, _mm_unpacklo_epi16(lo01, lo23));
+          _mm_storeu_si128(pout + 1, _mm_unpackhi_epi16(lo01, lo23));
+          _mm_storeu_si128(pout + 2, _mm_unpacklo_epi16(hi01, hi23));
+          _mm_storeu_si128(pout + 3, _mm_unpackhi_epi16(hi01, hi23));
+          break;
+        }
+
+        case 4U:
+        {
+          const __m128i mask = _mm_set1_epi8(0x0F);
+
+          const __m128i high = _mm_and_si128(_mm_srli_epi16(chars, 4), mask);
+          const __m128i low  = _mm_and_si128(chars, mask);
+
+          _mm_storeu_si128(pout + 0, _mm_unpacklo_epi8(high, low));
+          _mm_storeu_si128(pout + 1, _mm_unpackhi_epi8(high, low));
+          break;
+        }
+
+        default:
+        {
+          _mm_storeu_si128(pout, chars);
+          break;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into 16 bit fields, in network order. SSE2.
+    //*************************************************************************
+    inline void unpack_block_16_simd(const unsigned char* p, uint16_t* out)
+    {
+      const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_or_si128(_mm_slli_epi16(chars, 8), _mm_srli_epi16(chars, 8)));
+    }
+#elif ETL_BIT_STREAM_NEON_SUPPORTED
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into fields of 1, 2, 4 or 8 bits. NEON.
+    //*************************************************************************
+    inline void unpack_block_simd(const unsigned char* p, uint_least8_t width, uint8_t* out)
+    {
+      const uint8x16_t chars = vld1q_u8(p);
+
+      switch (width)
+      {
+        case 1U:
+        {
+          // Spread two chars over eight lanes each, then test one bit per lane.
+          static const uint8_t bit_values[16]   = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01,
+                                                    0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01 };
+          static const uint8_t index_values[16] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1 };
+
+          const uint8x16_t bits  = vld1q_u8(bit_values);
+          const uint8x16_t one   = vdupq_n_u8(1U);
+          uint8x16_t       index = vld1q_u8(index_values);
+
+          for (size_t i = 0U; i < (BLOCK_CHARS / 2U); ++i)
+          {
+            vst1q_u8(out, vandq_u8(vtstq_u8(vqtbl1q_u8(chars, index), bits), one));
+            index = vaddq_u8(index, vdupq_n_u8(2U));
+            out  += 16;
+          }
+          break;
+        }
+
+        case 2U:
+        {
+          const uint8x16_t mask = vdupq_n_u8(0x03U);
+
+          uint8x16x4_t fields;
+          fields.val[0] = vshrq_n_u8(chars, 6);
+          fields.val[1] = vandq_u8(vshrq_n_u8(chars, 4), mask);
+          fields.val[2] = vandq_u8(vshrq_n_u8(chars, 2), mask);
+          fields.val[3] = vandq_u8(chars, mask);
+
+          vst4q_u8(out, fields);
+          break;
+        }
+
+        case 4U:
+        {
+          uint8x16x2_t fields;
+          fields.val[0] = vshrq_n_u8(chars, 4);
+          fields.val[1] = vandq_u8(chars, vdupq_n_u8(0x0FU));
+
+          vst2q_u8(out, fields);
+          break;
+        }
+
+        default:
+        {
+          vst1q_u8(out, chars);
+          break;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into 16 bit fields, in network order. NEON.
+    //*************************************************************************
+    inline void unpack_block_16_simd(const unsigned char* p, uint16_t* out)
+    {
+      vst1q_u8(reinterpret_cast<uint8_t*>(out), vrev16q_u8(vld1q_u8(p)));
+    }
+#endif
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into fields of 1, 2, 4 or 8 bits.
+    //*************************************************************************
+    inline void unpack_block(const unsigned char* p, uint_least8_t width, uint8_t* out)
+    {
+#if ETL_BIT_STREAM_SSE2_SUPPORTED || ETL_BIT_STREAM_NEON_SUPPORTED
+      unpack_block_simd(p, width, out);
+#else
+      unpack_block_scalar(p, width, out);
+#endif
+    }
+
+    //*************************************************************************
+    /// Unpacks BLOCK_CHARS chars into 16 bit fields, in network order.
+    //*************************************************************************
+    inline void unpack_block_16(const unsigned char* p, uint16_t* out)
+    {
+#if ETL_BIT_STREAM_SSE2_SUPPORTED || ETL_BIT_STREAM_NEON_SUPPORTED
+      unpack_block_16_simd(p, out);
+#else
+      unpack_block_16_scalar(p, out);
+#endif
+    }
+  }
+}
+
+#endif
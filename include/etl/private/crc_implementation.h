@@ -0,0 +1,614 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_CRC_IMPLEMENTATION_INCLUDED
+#define ETL_CRC_IMPLEMENTATION_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../static_assert.h"
+
+//*****************************************************************************
+// The default lookup table size for etl::crc_policy.
+// 8 uses 256 entry tables, with the slicing engine for contiguous blocks.
+// 4 uses a single 16 entry table, for cache or flash starved targets.
+//*****************************************************************************
+#if !defined(ETL_CRC_TABLE_BITS)
+  #define ETL_CRC_TABLE_BITS 8
+#endif
+
+//*****************************************************************************
+// The number of bytes processed per step by the table driven block engine.
+// 8 uses eight 256 entry tables (slicing-by-8).
+// 4 uses four tables, for targets where cache or flash is at a premium.
+// 1 processes one byte at a time using a single table.
+//*****************************************************************************
+#if !defined(ETL_CRC_SLICES)
+  #define ETL_CRC_SLICES 8
+#endif
+
+//*****************************************************************************
+// Hardware assisted CRC.
+// Enabled when the profile targets x86, the compiler is GCC or Clang, and the
+// instruction set is enabled for the build (i.e. -msse4.2 -mpclmul).
+// Define ETL_CRC_NO_HARDWARE to always use the table driven engine.
+//*****************************************************************************
+#if defined(ETL_TARGET_DEVICE_X86) && (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_CRC_NO_HARDWARE)
+  #if defined(__SSE4_2__)
+    #define ETL_CRC_SSE42_SUPPORTED 1
+  #endif
+
+  #if defined(__PCLMUL__) && defined(__SSE4_1__)
+    #define ETL_CRC_PCLMUL_SUPPORTED 1
+  #endif
+#endif
+
+#if !defined(ETL_CRC_SSE42_SUPPORTED)
+  #define ETL_CRC_SSE42_SUPPORTED 0
+#endif
+
+#if !defined(ETL_CRC_PCLMUL_SUPPORTED)
+  #define ETL_CRC_PCLMUL_SUPPORTED 0
+#endif
+
+#if ETL_CRC_SSE42_SUPPORTED
+  #include <nmmintrin.h>
+#endif
+
+#if ETL_CRC_PCLMUL_SUPPORTED
+  #include <smmintrin.h>
+  #include <wmmintrin.h>
+#endif
+
+#if ETL_CRC_SSE42_SUPPORTED || ETL_CRC_PCLMUL_SUPPORTED
+  #include <string.h>
+#endif
+
+namespace etl
+{
+  namespace private_crc
+  {
+    //*************************************************************************
+    /// A mask of the lower WIDTH bits.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH>
+    struct crc_mask
+    {
+      static const TValue value = TValue(TValue(~TValue(0)) >> ((sizeof(TValue) * CHAR_BIT) - WIDTH));
+    };
+
+    //*************************************************************************
+    /// Reflects the lower BITS bits of VALUE.
+    //*************************************************************************
+    template <typename TValue, TValue VALUE, size_t BITS>
+    struct crc_reflect
+    {
+      static const TValue value = TValue(TValue(TValue(VALUE & 1U) << (BITS - 1U)) | crc_reflect<TValue, TValue(VALUE >> 1U), BITS - 1U>::value);
+    };
+
+    template <typename TValue, TValue VALUE>
+    struct crc_reflect<TValue, VALUE, 0U>
+    {
+      static const TValue value = 0U;
+    };
+
+    //*************************************************************************
+    /// Shifts VALUE through the polynomial BITS times.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, TValue VALUE, size_t BITS>
+    struct crc_shift;
+
+    // Reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, TValue VALUE, size_t BITS>
+    struct crc_shift<TValue, WIDTH, POLYNOMIAL, true, VALUE, BITS>
+    {
+      static const TValue reflected_polynomial = crc_reflect<TValue, POLYNOMIAL, WIDTH>::value;
+      static const TValue next  = TValue((VALUE & 1U) ? TValue(VALUE >> 1U) ^ reflected_polynomial : TValue(VALUE >> 1U));
+      static const TValue value = crc_shift<TValue, WIDTH, POLYNOMIAL, true, next, BITS - 1U>::value;
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, TValue VALUE>
+    struct crc_shift<TValue, WIDTH, POLYNOMIAL, true, VALUE, 0U>
+    {
+      static const TValue value = VALUE;
+    };
+
+    // Not reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, TValue VALUE, size_t BITS>
+    struct crc_shift<TValue, WIDTH, POLYNOMIAL, false, VALUE, BITS>
+    {
+      static const TValue shifted = TValue(TValue(VALUE << 1U) & crc_mask<TValue, WIDTH>::value);
+      static const TValue next    = TValue(((VALUE >> (WIDTH - 1U)) & 1U) ? TValue(shifted ^ POLYNOMIAL) : shifted);
+      static const TValue value   = crc_shift<TValue, WIDTH, POLYNOMIAL, false, next, BITS - 1U>::value;
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, TValue VALUE>
+    struct crc_shift<TValue, WIDTH, POLYNOMIAL, false, VALUE, 0U>
+    {
+      static const TValue value = VALUE;
+    };
+
+    //*************************************************************************
+    /// An entry in the slicing table for SLICE.
+    /// Slice 0 is the classic byte table.
+    /// Slice N is the CRC of byte INDEX followed by N zero bytes.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICE, size_t INDEX>
+    struct crc_table_entry;
+
+    // Reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, size_t SLICE, size_t INDEX>
+    struct crc_table_entry<TValue, WIDTH, POLYNOMIAL, true, SLICE, INDEX>
+    {
+      static const TValue previous = crc_table_entry<TValue, WIDTH, POLYNOMIAL, true, SLICE - 1U, INDEX>::value;
+      static const TValue value    = TValue(TValue(previous >> 8U) ^ crc_table_entry<TValue, WIDTH, POLYNOMIAL, true, 0U, size_t(previous & 0xFFU)>::value);
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, size_t INDEX>
+    struct crc_table_entry<TValue, WIDTH, POLYNOMIAL, true, 0U, INDEX>
+    {
+      static const TValue value = crc_shift<TValue, WIDTH, POLYNOMIAL, true, static_cast<TValue>(INDEX), 8U>::value;
+    };
+
+    // Not reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, size_t SLICE, size_t INDEX>
+    struct crc_table_entry<TValue, WIDTH, POLYNOMIAL, false, SLICE, INDEX>
+    {
+      static const TValue previous = crc_table_entry<TValue, WIDTH, POLYNOMIAL, false, SLICE - 1U, INDEX>::value;
+      static const TValue value    = TValue(TValue(TValue(previous << 8U) & crc_mask<TValue, WIDTH>::value) ^
+                                            crc_table_entry<TValue, WIDTH, POLYNOMIAL, false, 0U, size_t((previous >> (WIDTH - 8U)) & 0xFFU)>::value);
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, size_t INDEX>
+    struct crc_table_entry<TValue, WIDTH, POLYNOMIAL, false, 0U, INDEX>
+    {
+      static const TValue value = crc_shift<TValue, WIDTH, POLYNOMIAL, false, static_cast<TValue>(static_cast<TValue>(INDEX) << (WIDTH - 8U)), 8U>::value;
+    };
+
+    //*************************************************************************
+    /// The 256 entry table for SLICE.
+    /// Generated at compile time. Only instantiated if used.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICE>
+    struct crc_table
+    {
+      static const TValue table[256];
+    };
+
+#define ETL_CRC_ENTRY(N)     crc_table_entry<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICE, (N)>::value
+#define ETL_CRC_ENTRIES_4(N) ETL_CRC_ENTRY((N)), ETL_CRC_ENTRY((N) + 1U), ETL_CRC_ENTRY((N) + 2U), ETL_CRC_ENTRY((N) + 3U)
+#define ETL_CRC_ENTRIES_16(N) ETL_CRC_ENTRIES_4((N)), ETL_CRC_ENTRIES_4((N) + 4U), ETL_CRC_ENTRIES_4((N) + 8U), ETL_CRC_ENTRIES_4((N) + 12U)
+#define ETL_CRC_ENTRIES_64(N) ETL_CRC_ENTRIES_16((N)), ETL_CRC_ENTRIES_16((N) + 16U), ETL_CRC_ENTRIES_16((N) + 32U), ETL_CRC_ENTRIES_16((N) + 48U)
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICE>
+    const TValue crc_table<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICE>::table[256] =
+    {
+      ETL_CRC_ENTRIES_64(0U), ETL_CRC_ENTRIES_64(64U), ETL_CRC_ENTRIES_64(128U), ETL_CRC_ENTRIES_64(192U)
+    };
+
+#undef ETL_CRC_ENTRY
+#undef ETL_CRC_ENTRIES_4
+#undef ETL_CRC_ENTRIES_16
+#undef ETL_CRC_ENTRIES_64
+
+    //*************************************************************************
+    /// Gets the register byte that is combined with data byte INDEX of a slice.
+    /// Zero if the register has already been shifted out.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, bool REFLECT, size_t INDEX, bool IN_REGISTER = (INDEX < (WIDTH / 8U))>
+    struct crc_register_byte
+    {
+      static uint8_t get(TValue)
+      {
+        return 0U;
+      }
+    };
+
+    template <typename TValue, size_t WIDTH, size_t INDEX>
+    struct crc_register_byte<TValue, WIDTH, true, INDEX, true>
+    {
+      static uint8_t get(TValue crc)
+      {
+        return uint8_t(crc >> (INDEX * 8U));
+      }
+    };
+
+    template <typename TValue, size_t WIDTH, size_t INDEX>
+    struct crc_register_byte<TValue, WIDTH, false, INDEX, true>
+    {
+      static uint8_t get(TValue crc)
+      {
+        return uint8_t(crc >> (WIDTH - 8U - (INDEX * 8U)));
+      }
+    };
+
+    //*************************************************************************
+    /// The part of the register that survives a slice of SLICES bytes.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, bool REFLECT, size_t SLICES, bool REMAINS = ((SLICES * 8U) < WIDTH)>
+    struct crc_register_remainder
+    {
+      static TValue get(TValue)
+      {
+        return 0U;
+      }
+    };
+
+    template <typename TValue, size_t WIDTH, size_t SLICES>
+    struct crc_register_remainder<TValue, WIDTH, true, SLICES, true>
+    {
+      static TValue get(TValue crc)
+      {
+        return TValue(crc >> (SLICES * 8U));
+      }
+    };
+
+    template <typename TValue, size_t WIDTH, size_t SLICES>
+    struct crc_register_remainder<TValue, WIDTH, false, SLICES, true>
+    {
+      static TValue get(TValue crc)
+      {
+        return TValue(TValue(crc << (SLICES * 8U)) & crc_mask<TValue, WIDTH>::value);
+      }
+    };
+
+    //*************************************************************************
+    /// Combines the table lookups for bytes INDEX to SLICES - 1 of a slice.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICES, size_t INDEX>
+    struct crc_slice
+    {
+      static TValue add(TValue crc, const uint8_t* p)
+      {
+        typedef crc_table<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICES - 1U - INDEX> table_t;
+        typedef crc_register_byte<TValue, WIDTH, REFLECT, INDEX>                  register_byte_t;
+
+        return TValue(table_t::table[uint8_t(p[INDEX] ^ register_byte_t::get(crc))] ^
+                      crc_slice<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICES, INDEX + 1U>::add(crc, p));
+      }
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICES>
+    struct crc_slice<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICES, SLICES>
+    {
+      static TValue add(TValue crc, const uint8_t*)
+      {
+        return crc_register_remainder<TValue, WIDTH, REFLECT, SLICES>::get(crc);
+      }
+    };
+
+    //*************************************************************************
+    /// Table driven block CRC engine.
+    /// Processes SLICES bytes per step, then the remainder one byte at a time.
+    /// Works on the raw register; the caller applies any initial and final values.
+    ///\tparam TValue     The register type.
+    ///\tparam WIDTH      The width of the CRC in bits. Must be a multiple of 8.
+    ///\tparam POLYNOMIAL The polynomial in normal (unreflected) form.
+    ///\tparam REFLECT    true if the input and register are reflected.
+    ///\tparam SLICES     The number of bytes processed per step.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t SLICES = ETL_CRC_SLICES>
+    struct crc_engine
+    {
+      ETL_STATIC_ASSERT((WIDTH % 8U) == 0U, "CRC width must be a multiple of 8");
+      ETL_STATIC_ASSERT(WIDTH <= (sizeof(TValue) * CHAR_BIT), "CRC width too large for the value type");
+      ETL_STATIC_ASSERT(SLICES > 0U, "Slice count must be at least 1");
+
+      //***********************************************************************
+      /// Adds a single byte.
+      //***********************************************************************
+      static TValue add(TValue crc, uint8_t value)
+      {
+        return crc_slice<TValue, WIDTH, POLYNOMIAL, REFLECT, 1U, 0U>::add(crc, &value);
+      }
+
+      //***********************************************************************
+      /// Adds a contiguous block of bytes.
+      //***********************************************************************
+      static TValue add(TValue crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (size_t(end - begin) >= SLICES)
+        {
+          crc = crc_slice<TValue, WIDTH, POLYNOMIAL, REFLECT, SLICES, 0U>::add(crc, begin);
+          begin += SLICES;
+        }
+
+        while (begin != end)
+        {
+          crc = add(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+
+#if ETL_CRC_SSE42_SUPPORTED
+    //*************************************************************************
+    /// CRC32-C using the SSE4.2 crc32 instruction.
+    /// Works on the raw register.
+    //*************************************************************************
+    inline uint32_t crc32_c_sse42(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+    {
+#if ETL_PLATFORM_64BIT
+      uint64_t crc64 = crc;
+
+      while (size_t(end - begin) >= sizeof(uint64_t))
+      {
+        uint64_t block;
+        memcpy(&block, begin, sizeof(block));
+        crc64  = _mm_crc32_u64(crc64, block);
+        begin += sizeof(uint64_t);
+      }
+
+      crc = uint32_t(crc64);
+#else
+      while (size_t(end - begin) >= sizeof(uint32_t))
+      {
+        uint32_t block;
+        memcpy(&block, begin, sizeof(block));
+        crc    = _mm_crc32_u32(crc, block);
+        begin += sizeof(uint32_t);
+      }
+#endif
+
+      while (begin != end)
+      {
+        crc = _mm_crc32_u8(crc, *begin++);
+      }
+
+      return crc;
+    }
+#endif
+
+#if ETL_CRC_PCLMUL_SUPPORTED
+    //*************************************************************************
+    /// Folds a 128 bit value forward by the distance encoded in 'k'.
+    //*************************************************************************
+    inline __m128i crc_fold_128(__m128i value, __m128i k)
+    {
+      return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+    }
+
+    //*************************************************************************
+    /// Reflected 32 bit CRC using carry-less multiply folding.
+    /// Folds the input down to a single 128 bit value, which is reduced using
+    /// the table engine. Processes whole 16 byte blocks only; 'begin' is
+    /// advanced past the bytes consumed and the remainder is left to the caller.
+    /// Works on the raw register.
+    ///\param k1 (x^(4*128+32) mod P)' << 1
+    ///\param k2 (x^(4*128-32) mod P)' << 1
+    ///\param k3 (x^(128+32) mod P)' << 1
+    ///\param k4 (x^(128-32) mod P)' << 1
+    //*************************************************************************
+    template <typename TEngine>
+    uint32_t crc32_pclmul(uint32_t crc, const uint8_t*& begin, const uint8_t* end,
+                          uint64_t k1, uint64_t k2, uint64_t k3, uint64_t k4)
+    {
+      if (size_t(end - begin) < 64U)
+      {
+        return crc;
+      }
+
+      const __m128i k12 = _mm_set_epi64x(int64_t(k2), int64_t(k1));
+      const __m128i k34 = _mm_set_epi64x(int64_t(k4), int64_t(k3));
+
+      __m128i x0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+      __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 16));
+      __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 32));
+      __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 48));
+
+      x0 = _mm_xor_si128(x0, _mm_cvtsi32_si128(int(crc)));
+      begin += 64;
+
+      // Fold by four.
+      while (size_t(end - begin) >= 64U)
+      {
+        x0 = _mm_xor_si128(crc_fold_128(x0, k12), _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)));
+        x1 = _mm_xor_si128(crc_fold_128(x1, k12), _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 16)));
+        x2 = _mm_xor_si128(crc_fold_128(x2, k12), _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 32)));
+        x3 = _mm_xor_si128(crc_fold_128(x3, k12), _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + 48)));
+        begin += 64;
+      }
+
+      // Fold four to one.
+      x0 = _mm_xor_si128(crc_fold_128(x0, k34), x1);
+      x0 = _mm_xor_si128(crc_fold_128(x0, k34), x2);
+      x0 = _mm_xor_si128(crc_fold_128(x0, k34), x3);
+
+      // Fold the remaining whole blocks.
+      while (size_t(end - begin) >= 16U)
+      {
+        x0 = _mm_xor_si128(crc_fold_128(x0, k34), _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin)));
+        begin += 16;
+      }
+
+      // The folded value has the same CRC as the data it replaced.
+      uint8_t folded[16];
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(folded), x0);
+
+      return TEngine::add(uint32_t(0U), folded, folded + 16);
+    }
+#endif
+
+    //*************************************************************************
+    /// The 16 entry nibble table.
+    /// Generated at compile time. Only instantiated if used.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    struct crc_nibble_table
+    {
+      static const TValue table[16];
+    };
+
+#define ETL_CRC_ENTRY(N) crc_shift<TValue, WIDTH, POLYNOMIAL, REFLECT, (REFLECT ? static_cast<TValue>(N) : static_cast<TValue>(static_cast<TValue>(N) << (WIDTH - 4U))), 4U>::value
+#define ETL_CRC_ENTRIES_4(N) ETL_CRC_ENTRY((N)), ETL_CRC_ENTRY((N) + 1U), ETL_CRC_ENTRY((N) + 2U), ETL_CRC_ENTRY((N) + 3U)
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    const TValue crc_nibble_table<TValue, WIDTH, POLYNOMIAL, REFLECT>::table[16] =
+    {
+      ETL_CRC_ENTRIES_4(0U), ETL_CRC_ENTRIES_4(4U), ETL_CRC_ENTRIES_4(8U), ETL_CRC_ENTRIES_4(12U)
+    };
+
+#undef ETL_CRC_ENTRY
+#undef ETL_CRC_ENTRIES_4
+
+    //*************************************************************************
+    /// Nibble table CRC engine.
+    /// Processes four bits per lookup.
+    /// Works on the raw register; the caller applies any initial and final values.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    struct crc_nibble_engine;
+
+    // Reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL>
+    struct crc_nibble_engine<TValue, WIDTH, POLYNOMIAL, true>
+    {
+      typedef crc_nibble_table<TValue, WIDTH, POLYNOMIAL, true> table_t;
+
+      static TValue add(TValue crc, uint8_t value)
+      {
+        crc = TValue(TValue(crc >> 4U) ^ table_t::table[(crc ^ value) & 0x0FU]);
+        crc = TValue(TValue(crc >> 4U) ^ table_t::table[(crc ^ (value >> 4U)) & 0x0FU]);
+
+        return crc;
+      }
+
+      static TValue add(TValue crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (begin != end)
+        {
+          crc = add(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+
+    // Not reflected.
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL>
+    struct crc_nibble_engine<TValue, WIDTH, POLYNOMIAL, false>
+    {
+      typedef crc_nibble_table<TValue, WIDTH, POLYNOMIAL, false> table_t;
+
+      static TValue add(TValue crc, uint8_t value)
+      {
+        crc = TValue(TValue(TValue(crc << 4U) & crc_mask<TValue, WIDTH>::value) ^ table_t::table[((crc >> (WIDTH - 4U)) ^ (value >> 4U)) & 0x0FU]);
+        crc = TValue(TValue(TValue(crc << 4U) & crc_mask<TValue, WIDTH>::value) ^ table_t::table[((crc >> (WIDTH - 4U)) ^ value) & 0x0FU]);
+
+        return crc;
+      }
+
+      static TValue add(TValue crc, const uint8_t* begin, const uint8_t* end)
+      {
+        while (begin != end)
+        {
+          crc = add(crc, *begin++);
+        }
+
+        return crc;
+      }
+    };
+
+    //*************************************************************************
+    /// Byte table CRC engine.
+    /// Uses the slicing engine for blocks, or the hardware where there is
+    /// support for the polynomial.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    struct crc_byte_engine : public crc_engine<TValue, WIDTH, POLYNOMIAL, REFLECT>
+    {
+    };
+
+#if ETL_CRC_PCLMUL_SUPPORTED || ETL_CRC_SSE42_SUPPORTED
+    // CRC32, reflected.
+    template <>
+    struct crc_byte_engine<uint32_t, 32U, 0x04C11DB7UL, true> : public crc_engine<uint32_t, 32U, 0x04C11DB7UL, true>
+    {
+      typedef crc_engine<uint32_t, 32U, 0x04C11DB7UL, true> engine_t;
+
+      using engine_t::add;
+
+      static uint32_t add(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+#if ETL_CRC_PCLMUL_SUPPORTED
+        crc = crc32_pclmul<engine_t>(crc, begin, end, 0x154442BD4ULL, 0x1C6E41596ULL, 0x1751997D0ULL, 0x0CCAA009EULL);
+#endif
+
+        return engine_t::add(crc, begin, end);
+      }
+    };
+
+    // CRC32-C, reflected.
+    template <>
+    struct crc_byte_engine<uint32_t, 32U, 0x1EDC6F41UL, true> : public crc_engine<uint32_t, 32U, 0x1EDC6F41UL, true>
+    {
+      typedef crc_engine<uint32_t, 32U, 0x1EDC6F41UL, true> engine_t;
+
+      using engine_t::add;
+
+      static uint32_t add(uint32_t crc, const uint8_t* begin, const uint8_t* end)
+      {
+#if ETL_CRC_PCLMUL_SUPPORTED
+        crc = crc32_pclmul<engine_t>(crc, begin, end, 0x0740EEF02ULL, 0x09E4ADDF8ULL, 0x0F20C0DFEULL, 0x14CD00BD6ULL);
+#endif
+
+#if ETL_CRC_SSE42_SUPPORTED
+        return crc32_c_sse42(crc, begin, end);
+#else
+        return engine_t::add(crc, begin, end);
+#endif
+      }
+    };
+#endif
+
+    //*************************************************************************
+    /// Selects the engine for the table size.
+    //*************************************************************************
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT, size_t TABLE_BITS>
+    struct crc_table_engine;
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    struct crc_table_engine<TValue, WIDTH, POLYNOMIAL, REFLECT, 4U> : public crc_nibble_engine<TValue, WIDTH, POLYNOMIAL, REFLECT>
+    {
+    };
+
+    template <typename TValue, size_t WIDTH, TValue POLYNOMIAL, bool REFLECT>
+    struct crc_table_engine<TValue, WIDTH, POLYNOMIAL, REFLECT, 8U> : public crc_byte_engine<TValue, WIDTH, POLYNOMIAL, REFLECT>
+    {
+    };
+  }
+}
+
+#endif
@@ -0,0 +1,329 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#ifndef ETL_EYTZINGER_INDEX_INCLUDED
+#define ETL_EYTZINGER_INDEX_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+#include <new>
+
+#include "../platform.h"
+#include "../binary.h"
+#include "../log.h"
+#include "../memory.h"
+#include "../nullptr.h"
+#include "../type_traits.h"
+#include "../parameter_type.h"
+#include "padding.h"
+
+#include "../stl/iterator.h"
+
+// Lookups prefetch the keys a cache line's worth of levels down, where the
+// compiler supports it. That is log2(ETL_CACHE_LINE_SIZE / sizeof(key)) levels,
+// so four for 4 byte keys and 64 byte lines.
+
+#if defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)
+  #define ETL_EYTZINGER_PREFETCH(p) __builtin_prefetch(p)
+#else
+  #define ETL_EYTZINGER_PREFETCH(p)
+#endif
+
+///\ingroup private
+
+namespace etl
+{
+  namespace private_eytzinger
+  {
+    //*************************************************************************
+    /// A read only index of a sorted range of unique elements.
+    /// The keys are copied to an array in Eytzinger order; the implicit
+    /// binary search tree stored breadth first, with the children of
+    /// element k at 2k and 2k + 1. A search reads the keys from the top of
+    /// the tree down, so the first levels stay in the cache, and the keys
+    /// of the next levels of the path are all in one or two cache lines,
+    /// which are prefetched while the current level is compared.
+    /// Each key has a pointer to the element it was copied from. The index
+    /// must be rebuilt if the elements are modified or moved.
+    ///\tparam TKey        The key type.
+    ///\tparam TValue      The element type.
+    ///\tparam TKeyOf      Has a static 'key' function that returns the key of an element.
+    ///\tparam TKeyCompare The key comparison type.
+    //*************************************************************************
+    template <typename TKey, typename TValue, typename TKeyOf, typename TKeyCompare>
+    class ieytzinger_index
+    {
+    public:
+
+      typedef TKey          key_type;
+      typedef TValue        value_type;
+      typedef TKeyCompare   key_compare;
+      typedef const TValue* const_pointer;
+      typedef size_t        size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      //***********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A pointer to the element, or nullptr if not found.
+      //***********************************************************************
+      const_pointer find(key_parameter_t key) const
+      {
+        const size_t k = lower_bound_index(key);
+
+        if ((k != 0) && !compare(key, pkeys[k]))
+        {
+          return pelements[k];
+        }
+
+        return nullptr;
+      }
+
+      //***********************************************************************
+      /// Finds the first element with a key not less than 'key'.
+      ///\param key The key to search for.
+      ///\return A pointer to the element, or nullptr if there is none.
+      //***********************************************************************
+      const_pointer lower_bound(key_parameter_t key) const
+      {
+        const size_t k = lower_bound_index(key);
+
+        return (k != 0) ? pelements[k] : nullptr;
+      }
+
+      //***********************************************************************
+      /// Finds the first element with a key greater than 'key'.
+      ///\param key The key to search for.
+      ///\return A pointer to the element, or nullptr if there is none.
+      //***********************************************************************
+      const_pointer upper_bound(key_parameter_t key) const
+      {
+        size_t k = 1;
+
+        while (k <= current_size)
+        {
+          prefetch(k);
+          k = (2 * k) + (compare(key, pkeys[k]) ? 0 : 1);
+        }
+
+        k = first_left_turn(k);
+
+        return (k != 0) ? pelements[k] : nullptr;
+      }
+
+      //***********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //***********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find(key) == nullptr) ? 0 : 1;
+      }
+
+      //***********************************************************************
+      /// Clears the index.
+      //***********************************************************************
+      void clear()
+      {
+        if ETL_IF_CONSTEXPR(!etl::is_trivially_destructible<TKey>::value)
+        {
+          for (size_t k = 1; k <= current_size; ++k)
+          {
+            etl::destroy_at(pkeys + k);
+          }
+        }
+
+        current_size = 0;
+      }
+
+      //***********************************************************************
+      /// Gets the number of elements in the index.
+      //***********************************************************************
+      size_type size() const
+      {
+        return current_size;
+      }
+
+      //***********************************************************************
+      /// Checks the 'empty' state of the index.
+      //***********************************************************************
+      bool empty() const
+      {
+        return current_size == 0;
+      }
+
+      //***********************************************************************
+      /// Returns the maximum number of elements in the index.
+      //***********************************************************************
+      size_type max_size() const
+      {
+        return MAX_SIZE;
+      }
+
+      //***********************************************************************
+      /// Returns the maximum number of elements in the index.
+      //***********************************************************************
+      size_type capacity() const
+      {
+        return MAX_SIZE;
+      }
+
+    protected:
+
+      //***********************************************************************
+      /// Constructor.
+      ///\param pkeys_     The key array. MAX_SIZE_ + 1 keys. The first is not used.
+      ///\param pelements_ The element pointer array. MAX_SIZE_ + 1 pointers.
+      ///\param MAX_SIZE_  The maximum number of elements.
+      //***********************************************************************
+      ieytzinger_index(TKey* pkeys_, const_pointer* pelements_, size_t MAX_SIZE_)
+        : pkeys(pkeys_),
+          pelements(pelements_),
+          current_size(0),
+          MAX_SIZE(MAX_SIZE_)
+      {
+      }
+
+      //***********************************************************************
+      /// Destructor.
+      //***********************************************************************
+      ~ieytzinger_index()
+      {
+      }
+
+      //***********************************************************************
+      /// Builds the index from a sorted range of unique elements. O(N).
+      /// The keys are placed by an in order walk of the implicit tree.
+      ///\param first The first element.
+      ///\param n     The number of elements. Must not be more than max_size().
+      //***********************************************************************
+      template <typename TIterator>
+      void assign(TIterator first, size_t n)
+      {
+        clear();
+
+        current_size = n;
+
+        if (n == 0)
+        {
+          return;
+        }
+
+        size_t k = leftmost(1);
+
+        for (size_t i = 0; i < n; ++i)
+        {
+          ::new (pkeys + k) TKey(TKeyOf::key(*first));
+          pelements[k] = etl::addressof(*first);
+          ++first;
+
+          // Move to the next element in order.
+          if (((2 * k) + 1) <= n)
+          {
+            k = leftmost((2 * k) + 1);
+          }
+          else
+          {
+            k = first_left_turn(k);
+          }
+        }
+      }
+
+    private:
+
+      /// The number of keys in a cache line, rounded down to a power of 2. At least 1.
+      static const size_t PREFETCH_STRIDE = size_t(1U) << etl::log2<ETL_CACHE_LINE_SIZE / sizeof(TKey)>::value;
+
+      //***********************************************************************
+      /// Finds the slot of the first key not less than 'key'. 0 if none.
+      //***********************************************************************
+      size_t lower_bound_index(key_parameter_t key) const
+      {
+        size_t k = 1;
+
+        while (k <= current_size)
+        {
+          prefetch(k);
+          k = (2 * k) + (compare(pkeys[k], key) ? 1 : 0);
+        }
+
+        return first_left_turn(k);
+      }
+
+      //***********************************************************************
+      /// Prefetches the descendants of 'k' a cache line down the tree.
+      //***********************************************************************
+      void prefetch(size_t k) const
+      {
+        if ((k * PREFETCH_STRIDE) <= current_size)
+        {
+          ETL_EYTZINGER_PREFETCH(pkeys + (k * PREFETCH_STRIDE));
+        }
+      }
+
+      //***********************************************************************
+      /// Follows left children down from 'k'.
+      //***********************************************************************
+      size_t leftmost(size_t k) const
+      {
+        while ((2 * k) <= current_size)
+        {
+          k *= 2;
+        }
+
+        return k;
+      }
+
+      //***********************************************************************
+      /// Goes back up from 'k' past the right turns, and then one more.
+      /// The result is the last node that the path went left from, or 0.
+      //***********************************************************************
+      static size_t first_left_turn(size_t k)
+      {
+        return size_t(uint64_t(k) >> (etl::count_trailing_zeros(uint64_t(~uint64_t(k))) + 1));
+      }
+
+      // Disable copy construction and assignment.
+      ieytzinger_index(const ieytzinger_index&);
+      ieytzinger_index& operator =(const ieytzinger_index&);
+
+      TKey*          pkeys;
+      const_pointer* pelements;
+      size_t         current_size;
+      const size_t   MAX_SIZE;
+      key_compare    compare;
+    };
+  }
+}
+
+#endif
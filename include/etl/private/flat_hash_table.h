@@ -0,0 +1,968 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_HASH_TABLE_INCLUDED
+#define ETL_FLAT_HASH_TABLE_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <limits.h>
+
+#include <new>
+
+#include "../platform.h"
+#include "../stl/iterator.h"
+#include "../stl/utility.h"
+#include "../alignment.h"
+#include "../parameter_type.h"
+#include "../power.h"
+#include "../nullptr.h"
+
+//*****************************************************************************
+// Control bytes are scanned 16 at a time where the target supports it.
+// Define ETL_FLAT_HASH_NO_SIMD to always use the scalar scan.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_FLAT_HASH_NO_SIMD)
+  #if defined(__SSE2__)
+    #define ETL_FLAT_HASH_SSE2_SUPPORTED 1
+    #include <emmintrin.h>
+  #elif defined(__ARM_NEON) && defined(__aarch64__)
+    #define ETL_FLAT_HASH_NEON_SUPPORTED 1
+    #include <arm_neon.h>
+  #endif
+#endif
+
+#if !defined(ETL_FLAT_HASH_SSE2_SUPPORTED)
+  #define ETL_FLAT_HASH_SSE2_SUPPORTED 0
+#endif
+
+#if !defined(ETL_FLAT_HASH_NEON_SUPPORTED)
+  #define ETL_FLAT_HASH_NEON_SUPPORTED 0
+#endif
+
+namespace etl
+{
+  namespace private_flat_hash
+  {
+    //*************************************************************************
+    /// The control bytes.
+    /// Each slot has a byte that is zero if the slot is empty, otherwise
+    /// one more than the distance of its element from the element's home slot.
+    //*************************************************************************
+    struct control
+    {
+      static const uint8_t EMPTY = 0U;
+      static const uint8_t HOME  = 1U;
+      static const uint8_t MAX   = 255U;
+
+      /// Control bytes scanned at once. Copies of the first bytes follow the
+      /// last slot, so that a group may be loaded from any slot.
+      static const size_t GROUP_SIZE = 16U;
+    };
+
+    //*************************************************************************
+    /// The number of slots for a maximum number of elements.
+    /// A power of 2, so that the load factor is no more than 0.8.
+    //*************************************************************************
+    template <const size_t MAX_SIZE>
+    struct slot_count
+    {
+    private:
+
+      static const size_t ROUNDED = etl::power_of_2_round_up<MAX_SIZE + (MAX_SIZE / 4U) + 1U>::value;
+
+    public:
+
+      static const size_t value = (ROUNDED < control::GROUP_SIZE) ? control::GROUP_SIZE : ROUNDED;
+    };
+
+    //*************************************************************************
+    /// The Fibonacci hashing multiplier for the size of size_t.
+    //*************************************************************************
+    template <const size_t SIZE = sizeof(size_t)>
+    struct fibonacci_multiplier;
+
+    template <>
+    struct fibonacci_multiplier<2U>
+    {
+      static const size_t value = 0x9E37U;
+    };
+
+    template <>
+    struct fibonacci_multiplier<4U>
+    {
+      static const size_t value = 0x9E3779B9UL;
+    };
+
+    template <>
+    struct fibonacci_multiplier<8U>
+    {
+      static const size_t value = size_t(0x9E3779B97F4A7C15ULL);
+    };
+
+    //*************************************************************************
+    /// An open addressing hash table with linear probing.
+    /// Elements are kept in the order of their home slot, Robin Hood style,
+    /// so a lookup stops at the first slot holding an element that is nearer
+    /// its home than the key would be.
+    /// Erasing shifts the following elements back, so there are no tombstones.
+    ///\tparam TValue    The stored type.
+    ///\tparam TKey      The key type.
+    ///\tparam TKeyOf    Has a static 'key(const TValue&)' that returns the key.
+    ///\tparam THash     The hash function.
+    ///\tparam TKeyEqual The key equality function.
+    //*************************************************************************
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    class iflat_hash_table
+    {
+    public:
+
+      typedef TValue            value_type;
+      typedef TKey              key_type;
+      typedef THash             hasher;
+      typedef TKeyEqual         key_equal;
+      typedef value_type&       reference;
+      typedef const value_type& const_reference;
+      typedef value_type*       pointer;
+      typedef const value_type* const_pointer;
+      typedef size_t            size_type;
+
+      typedef typename etl::parameter_type<TKey>::type key_parameter_t;
+
+      typedef typename etl::aligned_storage<sizeof(TValue), etl::alignment_of<TValue>::value>::type storage_t;
+
+      class const_iterator;
+
+      //*********************************************************************
+      class iterator : public ETLSTD::iterator<ETLSTD::forward_iterator_tag, TValue>
+      {
+      public:
+
+        friend class iflat_hash_table;
+        friend class const_iterator;
+
+        //*********************************
+        iterator()
+          : ptable(nullptr),
+            index(0U)
+        {
+        }
+
+        //*********************************
+        iterator& operator ++()
+        {
+          index = ptable->next_index(index + 1U);
+          return *this;
+        }
+
+        //*********************************
+        iterator operator ++(int)
+        {
+          iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        reference operator *() const
+        {
+          return ptable->value_at(ptable->slot_of(index));
+        }
+
+        //*********************************
+        pointer operator ->() const
+        {
+          return &ptable->value_at(ptable->slot_of(index));
+        }
+
+        //*********************************
+        friend bool operator == (const iterator& lhs, const iterator& rhs)
+        {
+          return lhs.index == rhs.index;
+        }
+
+        //*********************************
+        friend bool operator != (const iterator& lhs, const iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        iterator(iflat_hash_table* ptable_, size_t index_)
+          : ptable(ptable_),
+            index(index_)
+        {
+        }
+
+        iflat_hash_table* ptable;
+        size_t            index; ///< The position in iteration order. bucket_count() is the end.
+      };
+
+      //*********************************************************************
+      class const_iterator : public ETLSTD::iterator<ETLSTD::forward_iterator_tag, const TValue>
+      {
+      public:
+
+        friend class iflat_hash_table;
+
+        //*********************************
+        const_iterator()
+          : ptable(nullptr),
+            index(0U)
+        {
+        }
+
+        //*********************************
+        const_iterator(const typename iflat_hash_table::iterator& other)
+          : ptable(other.ptable),
+            index(other.index)
+        {
+        }
+
+        //*********************************
+        const_iterator& operator ++()
+        {
+          index = ptable->next_index(index + 1U);
+          return *this;
+        }
+
+        //*********************************
+        const_iterator operator ++(int)
+        {
+          const_iterator temp(*this);
+          operator++();
+          return temp;
+        }
+
+        //*********************************
+        const_reference operator *() const
+        {
+          return ptable->value_at(ptable->slot_of(index));
+        }
+
+        //*********************************
+        const_pointer operator ->() const
+        {
+          return &ptable->value_at(ptable->slot_of(index));
+        }
+
+        //*********************************
+        friend bool operator == (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return lhs.index == rhs.index;
+        }
+
+        //*********************************
+        friend bool operator != (const const_iterator& lhs, const const_iterator& rhs)
+        {
+          return !(lhs == rhs);
+        }
+
+      private:
+
+        //*********************************
+        const_iterator(const iflat_hash_table* ptable_, size_t index_)
+          : ptable(ptable_),
+            index(index_)
+        {
+        }
+
+        const iflat_hash_table* ptable;
+        size_t                  index; ///< The position in iteration order. bucket_count() is the end.
+      };
+
+      typedef typename ETLSTD::iterator_traits<iterator>::difference_type difference_type;
+
+      //*********************************************************************
+      /// Returns an iterator to the beginning of the table.
+      //*********************************************************************
+      iterator begin()
+      {
+        return iterator(this, next_index(0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator begin() const
+      {
+        return const_iterator(this, next_index(0U));
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the beginning of the table.
+      //*********************************************************************
+      const_iterator cbegin() const
+      {
+        return const_iterator(this, next_index(0U));
+      }
+
+      //*********************************************************************
+      /// Returns an iterator to the end of the table.
+      //*********************************************************************
+      iterator end()
+      {
+        return iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator end() const
+      {
+        return const_iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Returns a const_iterator to the end of the table.
+      //*********************************************************************
+      const_iterator cend() const
+      {
+        return const_iterator(this, number_of_slots);
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return An iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      iterator find(key_parameter_t key)
+      {
+        return iterator(this, index_of(find_slot(key)));
+      }
+
+      //*********************************************************************
+      /// Finds an element.
+      ///\param key The key to search for.
+      ///\return A const_iterator to the element if the key exists, otherwise end().
+      //*********************************************************************
+      const_iterator find(key_parameter_t key) const
+      {
+        return const_iterator(this, index_of(find_slot(key)));
+      }
+
+      //*********************************************************************
+      /// Counts an element.
+      ///\param key The key to search for.
+      ///\return 1 if the key exists, otherwise 0.
+      //*********************************************************************
+      size_t count(key_parameter_t key) const
+      {
+        return (find_slot(key) == NOT_FOUND) ? 0U : 1U;
+      }
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return An iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETLSTD::pair<iterator, iterator> equal_range(key_parameter_t key)
+      {
+        iterator f = find(key);
+        iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETLSTD::pair<iterator, iterator>(f, l);
+      }
+
+      //*********************************************************************
+      /// Returns a range containing the element with the key.
+      ///\param key The key to search for.
+      ///\return A const iterator pair to the range of elements if the key exists, otherwise end().
+      //*********************************************************************
+      ETLSTD::pair<const_iterator, const_iterator> equal_range(key_parameter_t key) const
+      {
+        const_iterator f = find(key);
+        const_iterator l = f;
+
+        if (l != end())
+        {
+          ++l;
+        }
+
+        return ETLSTD::pair<const_iterator, const_iterator>(f, l);
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param key The key to erase.
+      ///\return The number of elements erased. 0 or 1.
+      //*********************************************************************
+      size_t erase(key_parameter_t key)
+      {
+        const size_t slot = find_slot(key);
+
+        if (slot == NOT_FOUND)
+        {
+          return 0U;
+        }
+
+        erase_slot(slot);
+
+        return 1U;
+      }
+
+      //*********************************************************************
+      /// Erases an element.
+      ///\param ielement Iterator to the element.
+      ///\return An iterator to the next element.
+      //*********************************************************************
+      iterator erase(const_iterator ielement)
+      {
+        erase_slot(slot_of(ielement.index));
+
+        // A following element may have been moved back into this position.
+        return iterator(this, next_index(ielement.index));
+      }
+
+      //*********************************************************************
+      /// Erases a range of elements.
+      ///\param first Iterator to the first element.
+      ///\param last  Iterator to the last element.
+      ///\return An iterator to the element after the range.
+      //*********************************************************************
+      iterator erase(const_iterator first_, const_iterator last_)
+      {
+        // Elements move as others are erased, so count them first.
+        size_t n = 0U;
+
+        for (const_iterator itr = first_; itr != last_; ++itr)
+        {
+          ++n;
+        }
+
+        iterator result(this, first_.index);
+
+        while (n-- != 0U)
+        {
+          result = erase(result);
+        }
+
+        return result;
+      }
+
+      //*********************************************************************
+      /// Clears the table.
+      //*********************************************************************
+      void clear()
+      {
+        for (size_t i = 0U; i < number_of_slots; ++i)
+        {
+          if (pcontrol[i] != control::EMPTY)
+          {
+            value_at(i).~TValue();
+          }
+        }
+
+        for (size_t i = 0U; i < (number_of_slots + control::GROUP_SIZE - 1U); ++i)
+        {
+          pcontrol[i] = control::EMPTY;
+        }
+
+        element_count = 0U;
+        start_slot    = 0U;
+      }
+
+      //*********************************************************************
+      /// Gets the number of elements.
+      //*********************************************************************
+      size_type size() const
+      {
+        return element_count;
+      }
+
+      //*********************************************************************
+      /// Gets the maximum number of elements.
+      //*********************************************************************
+      size_type max_size() const
+      {
+        return maximum_size;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is empty.
+      //*********************************************************************
+      bool empty() const
+      {
+        return element_count == 0U;
+      }
+
+      //*********************************************************************
+      /// Checks to see if the table is full.
+      //*********************************************************************
+      bool full() const
+      {
+        return element_count == maximum_size;
+      }
+
+      //*********************************************************************
+      /// Returns the remaining capacity.
+      //*********************************************************************
+      size_t available() const
+      {
+        return maximum_size - element_count;
+      }
+
+      //*********************************************************************
+      /// The number of slots.
+      //*********************************************************************
+      size_type bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// The number of slots.
+      //*********************************************************************
+      size_type max_bucket_count() const
+      {
+        return number_of_slots;
+      }
+
+      //*********************************************************************
+      /// Returns the load factor = size / bucket_count.
+      //*********************************************************************
+      float load_factor() const
+      {
+        return static_cast<float>(size()) / static_cast<float>(bucket_count());
+      }
+
+      //*********************************************************************
+      /// Returns the function that hashes the keys.
+      //*********************************************************************
+      hasher hash_function() const
+      {
+        return key_hash_function;
+      }
+
+      //*********************************************************************
+      /// Returns the function that compares the keys.
+      //*********************************************************************
+      key_equal key_eq() const
+      {
+        return key_equal_function;
+      }
+
+    protected:
+
+      static const size_t NOT_FOUND = ~size_t(0U);
+
+      //*********************************************************************
+      /// Constructor.
+      ///\param pcontrol_        number_of_slots_ + control::GROUP_SIZE - 1 control bytes.
+      ///\param pslots_          The element slots.
+      ///\param number_of_slots_ The number of slots. A power of 2, at least control::GROUP_SIZE.
+      ///\param maximum_size_    The maximum number of elements. Less than number_of_slots_.
+      //*********************************************************************
+      iflat_hash_table(uint8_t* pcontrol_, storage_t* pslots_, size_t number_of_slots_, size_t maximum_size_)
+        : pcontrol(pcontrol_),
+          pslots(pslots_),
+          number_of_slots(number_of_slots_),
+          mask(number_of_slots_ - 1U),
+          hash_shift(0U),
+          maximum_size(maximum_size_),
+          element_count(0U),
+          start_slot(0U)
+      {
+        // Home slots are taken from the top bits of the mixed hash.
+        size_t bits = 0U;
+
+        while ((size_t(1U) << bits) < number_of_slots)
+        {
+          ++bits;
+        }
+
+        hash_shift = (sizeof(size_t) * CHAR_BIT) - bits;
+      }
+
+      //*********************************************************************
+      /// Sets all of the slots empty. Called from the derived constructor.
+      //*********************************************************************
+      void initialise()
+      {
+        for (size_t i = 0U; i < (number_of_slots + control::GROUP_SIZE - 1U); ++i)
+        {
+          pcontrol[i] = control::EMPTY;
+        }
+
+        element_count = 0U;
+        start_slot    = 0U;
+      }
+
+      //*********************************************************************
+      /// Inserts a value if its key is not already in the table.
+      /// Returns the slot of the element with the key and whether it was inserted.
+      /// The slot is NOT_FOUND if there was no room.
+      //*********************************************************************
+      ETLSTD::pair<size_t, bool> insert_value(const_reference value)
+      {
+        const TKey& key = TKeyOf::key(value);
+
+        size_t  slot     = home_of(key);
+        uint8_t distance = control::HOME;
+
+        // Find the key, or the place where it belongs.
+        while (pcontrol[slot] >= distance)
+        {
+          if ((pcontrol[slot] == distance) && key_equal_function(key, TKeyOf::key(value_at(slot))))
+          {
+            return ETLSTD::pair<size_t, bool>(slot, false);
+          }
+
+          if (distance == control::MAX)
+          {
+            // Too far from home.
+            return ETLSTD::pair<size_t, bool>(NOT_FOUND, false);
+          }
+
+          ++distance;
+          slot = (slot + 1U) & mask;
+        }
+
+        if (full())
+        {
+          return ETLSTD::pair<size_t, bool>(NOT_FOUND, false);
+        }
+
+        // Find the empty slot at the end of the run, checking that
+        // each element can move one further from home.
+        size_t free_slot = slot;
+
+        while (pcontrol[free_slot] != control::EMPTY)
+        {
+          if (pcontrol[free_slot] == control::MAX)
+          {
+            return ETLSTD::pair<size_t, bool>(NOT_FOUND, false);
+          }
+
+          free_slot = (free_slot + 1U) & mask;
+        }
+
+        // Move the rest of the run up by one.
+        size_t to = free_slot;
+
+        while (to != slot)
+        {
+          const size_t from = (to - 1U) & mask;
+
+          move_slot(from, to);
+          set_control(to, uint8_t(pcontrol[from] + 1U));
+
+          to = from;
+        }
+
+        ::new (&pslots[slot]) TValue(value);
+        set_control(slot, distance);
+        ++element_count;
+
+        // Iteration starts at an empty slot, so choose another if it has been filled.
+        if (free_slot == start_slot)
+        {
+          do
+          {
+            start_slot = (start_slot + 1U) & mask;
+          } while (pcontrol[start_slot] != control::EMPTY);
+        }
+
+        return ETLSTD::pair<size_t, bool>(slot, true);
+      }
+
+      //*********************************************************************
+      /// Erases the element in the slot.
+      //*********************************************************************
+      void erase_slot(size_t slot)
+      {
+        value_at(slot).~TValue();
+
+        // Move back the following elements that are not in their home slot.
+        size_t next = (slot + 1U) & mask;
+
+        while (pcontrol[next] > control::HOME)
+        {
+          move_slot(next, slot);
+          set_control(slot, uint8_t(pcontrol[next] - 1U));
+
+          slot = next;
+          next = (next + 1U) & mask;
+        }
+
+        set_control(slot, control::EMPTY);
+        --element_count;
+      }
+
+      //*********************************************************************
+      /// Finds the slot holding the key.
+      /// Returns NOT_FOUND if the key is not in the table.
+      //*********************************************************************
+      size_t find_slot(key_parameter_t key) const
+      {
+#if ETL_FLAT_HASH_SSE2_SUPPORTED || ETL_FLAT_HASH_NEON_SUPPORTED
+        const size_t home = home_of(key);
+
+        // The element is usually at or near its home slot, so fetch it while the control bytes are read.
+        __builtin_prefetch(&pslots[home]);
+
+        for (uint32_t base = control::HOME; base <= control::MAX; base += control::GROUP_SIZE)
+        {
+          const size_t position = (home + (base - control::HOME)) & mask;
+
+          uint64_t match;
+          uint64_t stop;
+
+          match_group(pcontrol + position, uint8_t(base), match, stop);
+
+          // Only the matches before the first stop are candidates.
+          if (stop != 0U)
+          {
+            match &= (uint64_t(1U) << (__builtin_ctzll(stop) & ~(LANE_BITS - 1U))) - 1U;
+          }
+
+          while (match != 0U)
+          {
+            const uint32_t lane = uint32_t(__builtin_ctzll(match)) / LANE_BITS;
+            const size_t   slot = (position + lane) & mask;
+
+            if (key_equal_function(key, TKeyOf::key(value_at(slot))))
+            {
+              return slot;
+            }
+
+            match &= ~(LANE_MASK << (lane * LANE_BITS));
+          }
+
+          if (stop != 0U)
+          {
+            return NOT_FOUND;
+          }
+        }
+
+        return NOT_FOUND;
+#else
+        size_t  slot     = home_of(key);
+        uint8_t distance = control::HOME;
+
+        while (pcontrol[slot] >= distance)
+        {
+          if ((pcontrol[slot] == distance) && key_equal_function(key, TKeyOf::key(value_at(slot))))
+          {
+            return slot;
+          }
+
+          if (distance == control::MAX)
+          {
+            break;
+          }
+
+          ++distance;
+          slot = (slot + 1U) & mask;
+        }
+
+        return NOT_FOUND;
+#endif
+      }
+
+      //*********************************************************************
+      /// Gets the value in a slot.
+      //*********************************************************************
+      reference value_at(size_t slot)
+      {
+        return *reinterpret_cast<TValue*>(&pslots[slot]);
+      }
+
+      //*********************************************************************
+      /// Gets the value in a slot.
+      //*********************************************************************
+      const_reference value_at(size_t slot) const
+      {
+        return *reinterpret_cast<const TValue*>(&pslots[slot]);
+      }
+
+      //*********************************************************************
+      /// Converts a slot to an iterator index.
+      //*********************************************************************
+      size_t index_of(size_t slot) const
+      {
+        return (slot == NOT_FOUND) ? number_of_slots : ((slot - start_slot) & mask);
+      }
+
+      //*********************************************************************
+      /// Makes an iterator from a slot.
+      //*********************************************************************
+      iterator iterator_at(size_t slot)
+      {
+        return iterator(this, index_of(slot));
+      }
+
+      /// The function that creates the hashes.
+      hasher key_hash_function;
+
+      /// The function that compares the keys for equality.
+      key_equal key_equal_function;
+
+    private:
+
+#if ETL_FLAT_HASH_SSE2_SUPPORTED
+      static const uint32_t LANE_BITS = 1U;
+#elif ETL_FLAT_HASH_NEON_SUPPORTED
+      static const uint32_t LANE_BITS = 4U;
+#endif
+
+#if ETL_FLAT_HASH_SSE2_SUPPORTED || ETL_FLAT_HASH_NEON_SUPPORTED
+      static const uint64_t LANE_MASK = (uint64_t(1U) << LANE_BITS) - 1U;
+
+      //*********************************************************************
+      /// Compares a group of control bytes with the distances that an
+      /// element with the key would have, starting with 'base'.
+      /// 'match' has the lanes that are equal. Those elements have the same home slot as the key.
+      /// 'stop'  has the lanes that are less. The key cannot be at or after them.
+      //*********************************************************************
+      static void match_group(const uint8_t* pgroup, uint8_t base, uint64_t& match, uint64_t& stop)
+      {
+  #if ETL_FLAT_HASH_SSE2_SUPPORTED
+        const __m128i lanes    = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+        const __m128i group    = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pgroup));
+        const __m128i expected = _mm_adds_epu8(_mm_set1_epi8(char(base)), lanes);
+
+        // group >= expected, where max(group, expected) == group.
+        const __m128i not_less = _mm_cmpeq_epi8(_mm_max_epu8(group, expected), group);
+
+        match = uint32_t(_mm_movemask_epi8(_mm_cmpeq_epi8(group, expected)));
+        stop  = uint32_t(~_mm_movemask_epi8(not_less)) & 0xFFFFU;
+  #else
+        static const uint8_t lane_values[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+
+        const uint8x16_t lanes    = vld1q_u8(lane_values);
+        const uint8x16_t group    = vld1q_u8(pgroup);
+        const uint8x16_t expected = vqaddq_u8(vdupq_n_u8(base), lanes);
+
+        // Narrow each lane's comparison result to 4 bits.
+        match = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vceqq_u8(group, expected)), 4)), 0);
+        stop  = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(vcltq_u8(group, expected)), 4)), 0);
+  #endif
+      }
+#endif
+
+      //*********************************************************************
+      /// Gets the home slot for a key.
+      /// The hash is mixed so that weak hashes, such as the identity hash
+      /// for integers, still spread over the slots.
+      //*********************************************************************
+      size_t home_of(key_parameter_t key) const
+      {
+        return size_t(key_hash_function(key) * fibonacci_multiplier<>::value) >> hash_shift;
+      }
+
+      //*********************************************************************
+      /// Sets a control byte, and its copy after the last slot.
+      //*********************************************************************
+      void set_control(size_t slot, uint8_t value)
+      {
+        pcontrol[slot] = value;
+
+        if (slot < (control::GROUP_SIZE - 1U))
+        {
+          pcontrol[number_of_slots + slot] = value;
+        }
+      }
+
+      //*********************************************************************
+      /// Moves an element to an empty slot.
+      //*********************************************************************
+      void move_slot(size_t from, size_t to)
+      {
+        TValue& value = value_at(from);
+
+#if ETL_CPP11_SUPPORTED
+        ::new (&pslots[to]) TValue(static_cast<TValue&&>(value));
+#else
+        ::new (&pslots[to]) TValue(value);
+#endif
+        value.~TValue();
+      }
+
+      //*********************************************************************
+      /// Converts an iterator index to a slot.
+      /// Iteration starts from an empty slot, so that elements moved back
+      /// by an erase are never moved behind the iterator.
+      //*********************************************************************
+      size_t slot_of(size_t index) const
+      {
+        return (start_slot + index) & mask;
+      }
+
+      //*********************************************************************
+      /// Finds the first iterator index, from 'index', that holds an element.
+      //*********************************************************************
+      size_t next_index(size_t index) const
+      {
+        while ((index < number_of_slots) && (pcontrol[slot_of(index)] == control::EMPTY))
+        {
+          ++index;
+        }
+
+        return index;
+      }
+
+      // Disable copy construction.
+      iflat_hash_table(const iflat_hash_table&);
+
+      uint8_t* const   pcontrol;        ///< The control bytes.
+      storage_t* const pslots;          ///< The element slots.
+      const size_t     number_of_slots; ///< A power of 2.
+      const size_t     mask;            ///< Converts a position to a slot.
+      size_t           hash_shift;      ///< Takes the top bits of the mixed hash.
+      const size_t     maximum_size;    ///< The maximum number of elements.
+      size_t           element_count;   ///< The number of elements.
+      size_t           start_slot;      ///< An empty slot, where iteration starts.
+
+    protected:
+
+      //*********************************************************************
+      /// Destructor.
+      //*********************************************************************
+      ~iflat_hash_table()
+      {
+      }
+    };
+
+    template <typename TValue, typename TKey, typename TKeyOf, typename THash, typename TKeyEqual>
+    const size_t iflat_hash_table<TValue, TKey, TKeyOf, THash, TKeyEqual>::NOT_FOUND;
+  }
+}
+
+#endif
@@ -0,0 +1,207 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_FLAT_MERGE_INCLUDED
+#define ETL_FLAT_MERGE_INCLUDED
+
+#include <stddef.h>
+
+#include "../platform.h"
+#include "../algorithm.h"
+#include "../vector.h"
+
+#include "../stl/algorithm.h"
+#include "../stl/utility.h"
+
+///\ingroup private
+
+namespace etl
+{
+  namespace private_flat
+  {
+    //*************************************************************************
+    /// Compares pointers by the elements that they point to.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    class indirect_compare
+    {
+    public:
+
+      indirect_compare(TCompare compare_)
+        : compare(compare_)
+      {
+      }
+
+      bool operator ()(const T* lhs, const T* rhs) const
+      {
+        return compare(*lhs, *rhs);
+      }
+
+    private:
+
+      TCompare compare;
+    };
+
+    //*************************************************************************
+    /// Merges the sorted ranges [first, middle) and [middle, last) by copying
+    /// the second range to 'buffer' and merging backwards. Stable.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_backward(TIterator first, TIterator middle, TIterator last, TIterator buffer, TCompare compare)
+    {
+      TIterator buffer_last = ETLSTD::copy(middle, last, buffer);
+
+      while ((buffer != buffer_last) && (first != middle))
+      {
+        if (compare(*(buffer_last - 1), *(middle - 1)))
+        {
+          *--last = *--middle;
+        }
+        else
+        {
+          *--last = *--buffer_last;
+        }
+      }
+
+      ETLSTD::copy(buffer, buffer_last, last - (buffer_last - buffer));
+    }
+
+    //*************************************************************************
+    /// Merge sort, using 'buffer' for the merges. Stable.
+    /// The buffer must hold at least half of the range, rounded up.
+    //*************************************************************************
+    template <typename TIterator, typename TCompare>
+    void merge_sort(TIterator first, TIterator last, TIterator buffer, TCompare compare)
+    {
+      if ((last - first) <= etl::private_algorithm::SORT_THRESHOLD)
+      {
+        etl::private_algorithm::insertion_sort(first, last, compare);
+        return;
+      }
+
+      TIterator middle = first + ((last - first) / 2);
+
+      merge_sort(first,  middle, buffer, compare);
+      merge_sort(middle, last,   buffer, compare);
+
+      if (compare(*middle, *(middle - 1)))
+      {
+        merge_backward(first, middle, last, buffer, compare);
+      }
+    }
+
+    //*************************************************************************
+    /// Merges the pointers appended to a lookup into its sorted part.
+    /// The appended pointers are sorted and then merged in a single pass.
+    /// Free space at the end of the lookup is used as a merge buffer. If there
+    /// is not enough, the sort and merge are done in place, in O(N log N log N).
+    /// Equal elements keep their order; existing ones first, then the new ones
+    /// in the order that they were appended.
+    /// If 'unique' is set, any element equal to an earlier one is moved to the
+    /// end of the lookup, after the merged elements.
+    ///\param lookup   The lookup. The first 'n_sorted' pointers are sorted.
+    ///\param n_sorted The number of sorted pointers.
+    ///\param compare  Compares two elements.
+    ///\param unique   Whether to reject elements that are already present.
+    ///\return The number of merged elements. Any after these were rejected.
+    //*************************************************************************
+    template <typename T, typename TCompare>
+    size_t merge_appended(etl::ivector<T*>& lookup, size_t n_sorted, TCompare compare, bool unique)
+    {
+      typedef typename etl::ivector<T*>::iterator iterator;
+
+      etl::private_flat::indirect_compare<T, TCompare> less(compare);
+
+      const size_t size  = lookup.size();
+      const size_t n_new = size - n_sorted;
+
+      // Any free space at the end of the lookup is used as a buffer.
+      const size_t n_buffer = ETLSTD::min(lookup.available(), n_new);
+      lookup.resize(size + n_buffer);
+
+      iterator first  = lookup.begin();
+      iterator middle = first + n_sorted;
+      iterator last   = first + size;
+      iterator buffer = last;
+
+      // Sort the new elements, unless they were already in order.
+      if (etl::is_sorted_until(middle, last, less) != last)
+      {
+        if (n_buffer >= (n_new - (n_new / 2)))
+        {
+          etl::private_flat::merge_sort(middle, last, buffer, less);
+        }
+        else
+        {
+          etl::stable_sort(middle, last, less);
+        }
+      }
+
+      // Only the parts of the ranges that overlap need to be merged.
+      if ((first != middle) && (middle != last) && less(*middle, *(middle - 1)))
+      {
+        iterator merge_first = ETLSTD::upper_bound(first, middle, *middle, less);
+        iterator merge_last  = ETLSTD::lower_bound(middle, last, *(middle - 1), less);
+
+        if (n_buffer >= size_t(merge_last - middle))
+        {
+          etl::private_flat::merge_backward(merge_first, middle, merge_last, buffer, less);
+        }
+        else
+        {
+          etl::private_algorithm::merge_without_buffer(merge_first, middle, merge_last, middle - merge_first, merge_last - middle, less);
+        }
+      }
+
+      lookup.resize(size);
+
+      if (!unique || (lookup.size() < 2))
+      {
+        return lookup.size();
+      }
+
+      // Move the duplicates to the end. The first of each key stays.
+      size_t n_kept = 1;
+
+      for (size_t i = 1; i < lookup.size(); ++i)
+      {
+        if (less(lookup[n_kept - 1], lookup[i]))
+        {
+          ETLSTD::swap(lookup[n_kept], lookup[i]);
+          ++n_kept;
+        }
+      }
+
+      return n_kept;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,153 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_IEEE754_INCLUDED
+#define ETL_IEEE754_INCLUDED
+
+///\ingroup private
+
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+
+// Define ETL_NO_INT128 to avoid the compiler's 128 bit integer type.
+#if defined(__SIZEOF_INT128__) && !defined(ETL_NO_INT128)
+  #define ETL_IEEE754_USE_INT128 1
+#else
+  #define ETL_IEEE754_USE_INT128 0
+#endif
+
+namespace etl
+{
+  namespace private_ieee754
+  {
+    //*************************************************************************
+    /// The IEEE 754 binary layout of a floating point type.
+    //*************************************************************************
+    template <typename T>
+    struct traits;
+
+    template <>
+    struct traits<float>
+    {
+      typedef uint32_t bits_type;
+
+      static const int32_t MANTISSA_BITS = 23;
+      static const int32_t EXPONENT_BITS = 8;
+      static const int32_t BIAS          = 127;
+    };
+
+    template <>
+    struct traits<double>
+    {
+      typedef uint64_t bits_type;
+
+      static const int32_t MANTISSA_BITS = 52;
+      static const int32_t EXPONENT_BITS = 11;
+      static const int32_t BIAS          = 1023;
+    };
+
+    //*************************************************************************
+    /// The bits of 'value'.
+    //*************************************************************************
+    template <typename T>
+    typename traits<T>::bits_type to_bits(const T value)
+    {
+      typename traits<T>::bits_type bits;
+      memcpy(&bits, &value, sizeof(bits));
+
+      return bits;
+    }
+
+    //*************************************************************************
+    /// The value with the bits 'bits'.
+    //*************************************************************************
+    template <typename T>
+    T from_bits(const typename traits<T>::bits_type bits)
+    {
+      T value;
+      memcpy(&value, &bits, sizeof(value));
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// true if the sign bit of 'value' is set. Includes negative zero.
+    //*************************************************************************
+    template <typename T>
+    bool sign_bit(const T value)
+    {
+      typedef typename traits<T>::bits_type bits_type;
+
+      return (etl::private_ieee754::to_bits(value) >> (sizeof(bits_type) * 8U - 1U)) != 0U;
+    }
+
+    inline bool sign_bit(const long double value)
+    {
+      return etl::private_ieee754::sign_bit(double(value));
+    }
+
+    //*************************************************************************
+    /// The 128 bit product a * b.
+    /// \return The low 64 bits. The high 64 bits are written to 'high'.
+    //*************************************************************************
+    inline uint64_t multiply_64(const uint64_t a, const uint64_t b, uint64_t& high)
+    {
+#if ETL_IEEE754_USE_INT128
+      const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+
+      high = uint64_t(product >> 64);
+
+      return uint64_t(product);
+#else
+      // From 32 bit halves.
+      const uint64_t a_lo = uint32_t(a);
+      const uint64_t a_hi = a >> 32;
+      const uint64_t b_lo = uint32_t(b);
+      const uint64_t b_hi = b >> 32;
+
+      const uint64_t b00 = a_lo * b_lo;
+      const uint64_t b01 = a_lo * b_hi;
+      const uint64_t b10 = a_hi * b_lo;
+      const uint64_t b11 = a_hi * b_hi;
+
+      const uint64_t mid1 = b10 + (b00 >> 32);
+      const uint64_t mid2 = b01 + uint32_t(mid1);
+
+      high = b11 + (mid1 >> 32) + (mid2 >> 32);
+
+      return (mid2 << 32) | uint32_t(b00);
+#endif
+    }
+  }
+}
+
+#endif
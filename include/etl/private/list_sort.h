@@ -0,0 +1,137 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_LIST_SORT_INCLUDED
+#define ETL_LIST_SORT_INCLUDED
+
+#include <stddef.h>
+#include <limits.h>
+
+#include "../platform.h"
+#include "../nullptr.h"
+
+///\ingroup private
+
+namespace etl
+{
+  namespace private_list_sort
+  {
+    //*************************************************************************
+    /// Merges two null terminated chains of nodes. Stable; on equal elements
+    /// the node from 'left' comes first.
+    ///\return The head of the merged chain.
+    //*************************************************************************
+    template <typename TNode, typename TCompare>
+    TNode* merge(TNode* left, TNode* right, TNode* TNode::* next, TCompare& compare)
+    {
+      TNode*  head;
+      TNode** p_tail = &head;
+
+      while ((left != nullptr) && (right != nullptr))
+      {
+        if (compare(*right, *left))
+        {
+          *p_tail = right;
+          p_tail  = &(right->*next);
+          right   = *p_tail;
+        }
+        else
+        {
+          *p_tail = left;
+          p_tail  = &(left->*next);
+          left    = *p_tail;
+        }
+      }
+
+      *p_tail = (left != nullptr) ? left : right;
+
+      return head;
+    }
+
+    //*************************************************************************
+    /// Sorts a null terminated chain of nodes by relinking them. Stable.
+    /// Nodes are taken one at a time from the front of the chain and carried
+    /// up through an array of sorted runs, where run 'i' is either empty or
+    /// holds 2^i nodes, so the chain is only walked once.
+    /// The array holds one pointer per bit of size_t.
+    ///\param head    The first node of the chain.
+    ///\param next    The member that points to the next node.
+    ///\param compare Compares two nodes.
+    ///\return The head of the sorted chain.
+    //*************************************************************************
+    template <typename TNode, typename TCompare>
+    TNode* sort(TNode* head, TNode* TNode::* next, TCompare compare)
+    {
+      const size_t MAX_RUNS = sizeof(size_t) * CHAR_BIT;
+
+      TNode* runs[MAX_RUNS];
+      size_t n_runs = 0;
+
+      while (head != nullptr)
+      {
+        TNode* carry = head;
+        head = head->*next;
+        carry->*next = nullptr;
+
+        // Earlier runs hold earlier nodes, so they go on the left.
+        size_t i = 0;
+
+        while ((i < n_runs) && (runs[i] != nullptr))
+        {
+          carry   = etl::private_list_sort::merge(runs[i], carry, next, compare);
+          runs[i] = nullptr;
+          ++i;
+        }
+
+        runs[i] = carry;
+
+        if (i == n_runs)
+        {
+          ++n_runs;
+        }
+      }
+
+      // Gather the runs, latest first.
+      TNode* result = nullptr;
+
+      for (size_t i = 0; i < n_runs; ++i)
+      {
+        if (runs[i] != nullptr)
+        {
+          result = (result == nullptr) ? runs[i] : etl::private_list_sort::merge(runs[i], result, next, compare);
+        }
+      }
+
+      return result;
+    }
+  }
+}
+
+#endif
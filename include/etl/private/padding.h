@@ -0,0 +1,66 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_PADDING_INCLUDED
+#define ETL_PADDING_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+
+// The size of a cache line, in bytes.
+// Define ETL_CACHE_LINE_SIZE in the profile if the cache line is not 64 bytes.
+#if !defined(ETL_CACHE_LINE_SIZE)
+  #define ETL_CACHE_LINE_SIZE 64
+#endif
+
+namespace etl
+{
+  namespace private_padding
+  {
+    //*************************************************************************
+    /// Padding used to keep data that is written by different threads on
+    /// separate cache lines.
+    /// A size of zero adds no padding data.
+    //*************************************************************************
+    template <const size_t SIZE>
+    struct padding
+    {
+      char data[SIZE];
+    };
+
+    template <>
+    struct padding<0U>
+    {
+    };
+  }
+}
+
+#endif
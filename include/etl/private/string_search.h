@@ -0,0 +1,837 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_STRING_SEARCH_INCLUDED
+#define ETL_STRING_SEARCH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../platform.h"
+#include "../nullptr.h"
+#include "../stl/iterator.h"
+
+//*****************************************************************************
+// Search routines shared by etl::ibasic_string and etl::basic_string_view.
+//
+// Single characters are found with memchr for byte sized characters.
+// Substrings are found by scanning for the first and last characters of the
+// needle, and checking the rest only where both match. If the checks cost more
+// than the scan then the search switches to the Two-Way algorithm, which is
+// linear in the worst case.
+// Sets of characters are held in a 256 bit map indexed by the low byte.
+//
+// For byte sized characters, the first and last character scan, and the
+// search for small sets of characters, test 16 characters at a time using SSE2
+// or NEON where the target supports it. Otherwise the scan is a machine word at
+// a time. Define ETL_STRING_SEARCH_NO_SIMD to always use the portable versions.
+//*****************************************************************************
+#if (defined(ETL_COMPILER_GCC) || defined(ETL_COMPILER_CLANG)) && !defined(ETL_STRING_SEARCH_NO_SIMD)
+  #if defined(__SSE2__)
+    #define ETL_STRING_SEARCH_SSE2_SUPPORTED 1
+    #include <emmintrin.h>
+  #elif defined(__ARM_NEON) && defined(__aarch64__) && !defined(__ARM_BIG_ENDIAN)
+    #define ETL_STRING_SEARCH_NEON_SUPPORTED 1
+    #include <arm_neon.h>
+  #endif
+#endif
+
+#if !defined(ETL_STRING_SEARCH_SSE2_SUPPORTED)
+  #define ETL_STRING_SEARCH_SSE2_SUPPORTED 0
+#endif
+
+#if !defined(ETL_STRING_SEARCH_NEON_SUPPORTED)
+  #define ETL_STRING_SEARCH_NEON_SUPPORTED 0
+#endif
+
+namespace etl
+{
+  namespace private_string_search
+  {
+    static const size_t npos = size_t(-1);
+
+    //*************************************************************************
+    /// Finds the first 'c' in [first, last).
+    /// \return A pointer to the character, or 'last'.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char(const T* first, const T* last, T c)
+    {
+      if (sizeof(T) == 1U)
+      {
+        const void* p = (first == last) ? nullptr : memchr(first, static_cast<unsigned char>(c), size_t(last - first));
+
+        return (p == nullptr) ? last : static_cast<const T*>(p);
+      }
+
+      while ((last - first) >= 4)
+      {
+        if (first[0] == c) return first;
+        if (first[1] == c) return first + 1;
+        if (first[2] == c) return first + 2;
+        if (first[3] == c) return first + 3;
+        first += 4;
+      }
+
+      while ((first != last) && (*first != c))
+      {
+        ++first;
+      }
+
+      return first;
+    }
+
+    //*************************************************************************
+    /// Finds the last 'c' in [first, last).
+    /// \return A pointer to the character, or 'last'.
+    //*************************************************************************
+    template <typename T>
+    const T* find_char_last(const T* first, const T* last, T c)
+    {
+      const T* p = last;
+
+      while (p != first)
+      {
+        --p;
+
+        if (*p == c)
+        {
+          return p;
+        }
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Do the 'n' characters at 'a' and 'b' match?
+    //*************************************************************************
+    template <typename T>
+    bool equal(const T* a, const T* b, size_t n)
+    {
+      if (sizeof(T) == 1U)
+      {
+        return memcmp(a, b, n) == 0;
+      }
+
+      for (size_t i = 0U; i < n; ++i)
+      {
+        if (a[i] != b[i])
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Computes the maximal suffix of the needle, for Two-Way.
+    /// 'reversed' selects the reversed alphabetical order.
+    /// \return The position before the suffix. 'period' is its period.
+    //*************************************************************************
+    template <typename TIterator>
+    ptrdiff_t maximal_suffix(TIterator needle, ptrdiff_t m, bool reversed, ptrdiff_t& period)
+    {
+      ptrdiff_t ms = -1;
+      ptrdiff_t j  = 0;
+      ptrdiff_t k  = 1;
+      ptrdiff_t p  = 1;
+
+      while ((j + k) < m)
+      {
+        const bool a_is_less    = needle[j + k] < needle[ms + k];
+        const bool a_is_greater = needle[ms + k] < needle[j + k];
+
+        if (reversed ? a_is_greater : a_is_less)
+        {
+          j += k;
+          k  = 1;
+          p  = j - ms;
+        }
+        else if (!a_is_less && !a_is_greater)
+        {
+          if (k != p)
+          {
+            ++k;
+          }
+          else
+          {
+            j += p;
+            k  = 1;
+          }
+        }
+        else
+        {
+          ms = j;
+          j  = ms + 1;
+          k  = 1;
+          p  = 1;
+        }
+      }
+
+      period = p;
+
+      return ms;
+    }
+
+    //*************************************************************************
+    /// The Two-Way string matching algorithm of Crochemore and Perrin.
+    /// Linear time and constant space.
+    /// Works on reverse iterators too, to find the last match.
+    /// \return The offset of the first match, or -1.
+    //*************************************************************************
+    template <typename TIterator>
+    ptrdiff_t two_way(TIterator text, ptrdiff_t n, TIterator needle, ptrdiff_t m)
+    {
+      // Critical factorisation.
+      ptrdiff_t period1;
+      ptrdiff_t period2;
+      ptrdiff_t ms1 = maximal_suffix(needle, m, false, period1);
+      ptrdiff_t ms2 = maximal_suffix(needle, m, true,  period2);
+
+      ptrdiff_t ell    = (ms1 > ms2) ? ms1 : ms2;
+      ptrdiff_t period = (ms1 > ms2) ? period1 : period2;
+
+      // Is the needle periodic?
+      bool periodic = (period + ell + 1) <= m;
+
+      for (ptrdiff_t i = 0; periodic && (i <= ell); ++i)
+      {
+        periodic = (needle[i] == needle[i + period]);
+      }
+
+      ptrdiff_t j = 0;
+
+      if (periodic)
+      {
+        ptrdiff_t memory = -1;
+
+        while (j <= (n - m))
+        {
+          ptrdiff_t i = ((ell > memory) ? ell : memory) + 1;
+
+          while ((i < m) && (needle[i] == text[i + j]))
+          {
+            ++i;
+          }
+
+          if (i >= m)
+          {
+            i = ell;
+
+            while ((i > memory) && (needle[i] == text[i + j]))
+            {
+              --i;
+            }
+
+            if (i <= memory)
+            {
+              return j;
+            }
+
+            j += period;
+            memory = m - period - 1;
+          }
+          else
+          {
+            j += i - ell;
+            memory = -1;
+          }
+        }
+      }
+      else
+      {
+        period = (((ell + 1) > (m - ell - 1)) ? (ell + 1) : (m - ell - 1)) + 1;
+
+        while (j <= (n - m))
+        {
+          ptrdiff_t i = ell + 1;
+
+          while ((i < m) && (needle[i] == text[i + j]))
+          {
+            ++i;
+          }
+
+          if (i >= m)
+          {
+            i = ell;
+
+            while ((i >= 0) && (needle[i] == text[i + j]))
+            {
+              --i;
+            }
+
+            if (i < 0)
+            {
+              return j;
+            }
+
+            j += period;
+          }
+          else
+          {
+            j += i - ell;
+          }
+        }
+      }
+
+      return -1;
+    }
+
+#if ETL_STRING_SEARCH_SSE2_SUPPORTED || ETL_STRING_SEARCH_NEON_SUPPORTED
+    /// The number of characters tested at a time.
+    static const size_t BLOCK_CHARS = 16U;
+
+    /// The largest set searched for a block at a time.
+    static const size_t BLOCK_SET_SIZE = 8U;
+
+  #if ETL_STRING_SEARCH_SSE2_SUPPORTED
+    static const uint32_t LANE_BITS  = 1U;
+    static const uint64_t BLOCK_MASK = 0xFFFFU;
+
+    typedef __m128i block_t;
+
+    //*************************************************************************
+    /// Loads BLOCK_CHARS characters from an unaligned address.
+    //*************************************************************************
+    inline block_t load_block(const unsigned char* p)
+    {
+      return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    }
+
+    //*************************************************************************
+    /// A block of 'c'.
+    //*************************************************************************
+    inline block_t splat_block(unsigned char c)
+    {
+      return _mm_set1_epi8(char(c));
+    }
+
+    //*************************************************************************
+    /// The lanes of 'a' and 'b' that are equal are all ones.
+    //*************************************************************************
+    inline block_t equal_lanes(block_t a, block_t b)
+    {
+      return _mm_cmpeq_epi8(a, b);
+    }
+
+    inline block_t and_lanes(block_t a, block_t b)
+    {
+      return _mm_and_si128(a, b);
+    }
+
+    inline block_t or_lanes(block_t a, block_t b)
+    {
+      return _mm_or_si128(a, b);
+    }
+
+    //*************************************************************************
+    /// LANE_BITS bits for each lane that is all ones.
+    //*************************************************************************
+    inline uint64_t lane_mask(block_t lanes)
+    {
+      return uint32_t(_mm_movemask_epi8(lanes));
+    }
+  #else
+    static const uint32_t LANE_BITS  = 4U;
+    static const uint64_t BLOCK_MASK = 0xFFFFFFFFFFFFFFFFULL;
+
+    typedef uint8x16_t block_t;
+
+    //*************************************************************************
+    /// Loads BLOCK_CHARS characters from an unaligned address.
+    //*************************************************************************
+    inline block_t load_block(const unsigned char* p)
+    {
+      return vld1q_u8(p);
+    }
+
+    //*************************************************************************
+    /// A block of 'c'.
+    //*************************************************************************
+    inline block_t splat_block(unsigned char c)
+    {
+      return vdupq_n_u8(c);
+    }
+
+    //*************************************************************************
+    /// The lanes of 'a' and 'b' that are equal are all ones.
+    //*************************************************************************
+    inline block_t equal_lanes(block_t a, block_t b)
+    {
+      return vceqq_u8(a, b);
+    }
+
+    inline block_t and_lanes(block_t a, block_t b)
+    {
+      return vandq_u8(a, b);
+    }
+
+    inline block_t or_lanes(block_t a, block_t b)
+    {
+      return vorrq_u8(a, b);
+    }
+
+    //*************************************************************************
+    /// LANE_BITS bits for each lane that is all ones.
+    /// Each lane's result is narrowed to 4 bits.
+    //*************************************************************************
+    inline uint64_t lane_mask(block_t lanes)
+    {
+      return vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(lanes), 4)), 0);
+    }
+  #endif
+
+    static const uint64_t LANE_MASK = (uint64_t(1U) << LANE_BITS) - 1U;
+
+    //*************************************************************************
+    /// The first lane set in a non-zero mask.
+    //*************************************************************************
+    inline size_t first_lane(uint64_t mask)
+    {
+      return size_t(__builtin_ctzll(mask)) / LANE_BITS;
+    }
+#else
+    //*************************************************************************
+    /// Loads a machine word from an unaligned address.
+    //*************************************************************************
+    inline uintptr_t load_word(const void* p)
+    {
+      uintptr_t word;
+      memcpy(&word, p, sizeof(word));
+      return word;
+    }
+#endif
+
+    //*************************************************************************
+    /// Finds the first match of the 'm' character needle in [first, last).
+    /// \return A pointer to the match, or 'last'.
+    //*************************************************************************
+    template <typename T>
+    const T* search(const T* first, const T* last, const T* needle, size_t m)
+    {
+      const size_t n = size_t(last - first);
+
+      if (m == 0U)
+      {
+        return first;
+      }
+
+      if (m > n)
+      {
+        return last;
+      }
+
+      if (m == 1U)
+      {
+        return find_char(first, last, needle[0]);
+      }
+
+      const T      head  = needle[0];
+      const T      tail  = needle[m - 1U];
+      const size_t limit = n - m; // The last possible start.
+
+      size_t i       = 0U;
+      size_t checked = 0U; // Characters compared by the checks.
+
+#if ETL_STRING_SEARCH_SSE2_SUPPORTED || ETL_STRING_SEARCH_NEON_SUPPORTED
+      // Scan a block at a time for byte sized characters.
+      if (sizeof(T) == 1U)
+      {
+        const unsigned char* const text = reinterpret_cast<const unsigned char*>(first);
+
+        const block_t heads = splat_block(static_cast<unsigned char>(head));
+        const block_t tails = splat_block(static_cast<unsigned char>(tail));
+
+        while ((i + BLOCK_CHARS) <= (limit + 1U))
+        {
+          // The lanes where both the first and the last character match.
+          uint64_t match = lane_mask(and_lanes(equal_lanes(load_block(text + i), heads),
+                                               equal_lanes(load_block(text + i + m - 1U), tails)));
+
+          while (match != 0U)
+          {
+            const size_t lane = first_lane(match);
+
+            if (equal(first + i + lane + 1U, needle + 1U, m - 2U))
+            {
+              return first + i + lane;
+            }
+
+            checked += m;
+            match &= ~(LANE_MASK << (lane * LANE_BITS));
+          }
+
+          // Too much checking. Switch to the linear algorithm.
+          if (checked > (2U * i) + 256U)
+          {
+            break;
+          }
+
+          i += BLOCK_CHARS;
+        }
+      }
+#else
+      // Scan a word at a time for byte sized characters.
+      if (sizeof(T) == 1U)
+      {
+        const uintptr_t ones  = uintptr_t(-1) / 0xFFU;
+        const uintptr_t highs = ones * 0x80U;
+        const uintptr_t heads = ones * static_cast<unsigned char>(head);
+        const uintptr_t tails = ones * static_cast<unsigned char>(tail);
+
+        while ((i + sizeof(uintptr_t)) <= (limit + 1U))
+        {
+          // A zero byte where both the first and the last character match.
+          const uintptr_t x = (load_word(first + i) ^ heads) | (load_word(first + i + m - 1U) ^ tails);
+
+          if (((x - ones) & ~x & highs) != 0U)
+          {
+            for (size_t k = i; k < (i + sizeof(uintptr_t)); ++k)
+            {
+              if ((first[k] == head) && (first[k + m - 1U] == tail))
+              {
+                if (equal(first + k + 1U, needle + 1U, m - 2U))
+                {
+                  return first + k;
+                }
+
+                checked += m;
+              }
+            }
+
+            // Too much checking. Switch to the linear algorithm.
+            if (checked > (2U * i) + 256U)
+            {
+              break;
+            }
+          }
+
+          i += sizeof(uintptr_t);
+        }
+      }
+#endif
+
+      while (i <= limit)
+      {
+        if ((first[i] == head) && (first[i + m - 1U] == tail))
+        {
+          if (equal(first + i + 1U, needle + 1U, m - 2U))
+          {
+            return first + i;
+          }
+
+          checked += m;
+
+          // Too much checking. Switch to the linear algorithm.
+          if (checked > (2U * i) + 256U)
+          {
+            ptrdiff_t offset = two_way(first + i, ptrdiff_t(n - i), needle, ptrdiff_t(m));
+
+            return (offset < 0) ? last : first + i + offset;
+          }
+        }
+
+        ++i;
+      }
+
+      return last;
+    }
+
+    //*************************************************************************
+    /// Finds the last match of the 'm' character needle in [first, last).
+    /// \return A pointer to the match, or 'last'.
+    //*************************************************************************
+    template <typename T>
+    const T* search_last(const T* first, const T* last, const T* needle, size_t m)
+    {
+      const size_t n = size_t(last - first);
+
+      if (m > n)
+      {
+        return last;
+      }
+
+      if (m == 0U)
+      {
+        return last;
+      }
+
+      if (m == 1U)
+      {
+        return find_char_last(first, last, needle[0]);
+      }
+
+      const T head = needle[0];
+      const T tail = needle[m - 1U];
+
+      size_t i       = n - m; // The start being tried.
+      size_t checked = 0U;
+
+      while (true)
+      {
+        if ((first[i] == head) && (first[i + m - 1U] == tail))
+        {
+          if (equal(first + i + 1U, needle + 1U, m - 2U))
+          {
+            return first + i;
+          }
+
+          checked += m;
+
+          // Too much checking. Switch to the linear algorithm, searching backwards.
+          if (checked > (2U * (n - m - i)) + 256U)
+          {
+            typedef ETLSTD::reverse_iterator<const T*> reverse_t;
+
+            ptrdiff_t offset = two_way(reverse_t(first + i + m), ptrdiff_t(i + m), reverse_t(needle + m), ptrdiff_t(m));
+
+            return (offset < 0) ? last : first + i - offset;
+          }
+        }
+
+        if (i == 0U)
+        {
+          return last;
+        }
+
+        --i;
+      }
+    }
+
+    //*************************************************************************
+    /// A set of characters, as a bit map indexed by the low byte.
+    /// The map is exact if every character in the set is less than 256.
+    /// Otherwise characters that hit the map are checked against the set.
+    //*************************************************************************
+    template <typename T>
+    class character_set
+    {
+    public:
+
+      character_set(const T* set_, size_t n_)
+        : set(set_),
+          n(n_),
+          exact(true)
+      {
+        for (size_t i = 0U; i < 8U; ++i)
+        {
+          bits[i] = 0U;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          const uint32_t c = to_uint(set[i]);
+
+          bits[(c & 0xFFU) >> 5] |= uint32_t(1U) << (c & 0x1FU);
+          exact = exact && (c < 256U);
+        }
+      }
+
+      //*******************************************
+      bool contains(T value) const
+      {
+        const uint32_t c = to_uint(value);
+
+        if (((bits[(c & 0xFFU) >> 5] >> (c & 0x1FU)) & 1U) == 0U)
+        {
+          return false;
+        }
+
+        if (exact)
+        {
+          return c < 256U;
+        }
+
+        for (size_t i = 0U; i < n; ++i)
+        {
+          if (set[i] == value)
+          {
+            return true;
+          }
+        }
+
+        return false;
+      }
+
+    private:
+
+      //*******************************************
+      static uint32_t to_uint(T value)
+      {
+        // Byte sized characters are always exact.
+        return (sizeof(T) == 1U) ? uint32_t(static_cast<unsigned char>(value)) : uint32_t(value);
+      }
+
+      const T* set;
+      size_t   n;
+      bool     exact;
+      uint32_t bits[8];
+    };
+
+    //*************************************************************************
+    /// Finds the first character at or after 'position' that is (or is not) in the set.
+    //*************************************************************************
+    template <typename T>
+    size_t find_first_of(const T* text, size_t size, size_t position, const T* s, size_t n, bool in_set)
+    {
+      if (position >= size)
+      {
+        return npos;
+      }
+
+      if ((n == 1U) && in_set)
+      {
+        const T* p = find_char(text + position, text + size, s[0]);
+
+        return (p == (text + size)) ? npos : size_t(p - text);
+      }
+
+#if ETL_STRING_SEARCH_SSE2_SUPPORTED || ETL_STRING_SEARCH_NEON_SUPPORTED
+      // Compare a block at a time against each character of a small set.
+      if ((sizeof(T) == 1U) && (n != 0U) && (n <= BLOCK_SET_SIZE))
+      {
+        const unsigned char* const characters = reinterpret_cast<const unsigned char*>(text);
+
+        block_t sets[BLOCK_SET_SIZE];
+
+        for (size_t k = 0U; k < n; ++k)
+        {
+          sets[k] = splat_block(static_cast<unsigned char>(s[k]));
+        }
+
+        while ((position + BLOCK_CHARS) <= size)
+        {
+          const block_t block = load_block(characters + position);
+
+          block_t hits = equal_lanes(block, sets[0]);
+
+          for (size_t k = 1U; k < n; ++k)
+          {
+            hits = or_lanes(hits, equal_lanes(block, sets[k]));
+          }
+
+          const uint64_t match = in_set ? lane_mask(hits) : (~lane_mask(hits) & BLOCK_MASK);
+
+          if (match != 0U)
+          {
+            return position + first_lane(match);
+          }
+
+          position += BLOCK_CHARS;
+        }
+      }
+#endif
+
+      const character_set<T> set(s, n);
+
+      for (size_t i = position; i < size; ++i)
+      {
+        if (set.contains(text[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the last character at or before 'position' that is (or is not) in the set.
+    //*************************************************************************
+    template <typename T>
+    size_t find_last_of(const T* text, size_t size, size_t position, const T* s, size_t n, bool in_set)
+    {
+      if (size == 0U)
+      {
+        return npos;
+      }
+
+      position = (position < size) ? position : size - 1U;
+
+      const character_set<T> set(s, n);
+
+      for (size_t i = position + 1U; i-- != 0U;)
+      {
+        if (set.contains(text[i]) == in_set)
+        {
+          return i;
+        }
+      }
+
+      return npos;
+    }
+
+    //*************************************************************************
+    /// Finds the needle at or after 'position'.
+    //*************************************************************************
+    template <typename T>
+    size_t find(const T* text, size_t size, size_t position, const T* s, size_t n)
+    {
+      if ((position > size) || (n > (size - position)))
+      {
+        return npos;
+      }
+
+      const T* p = search(text + position, text + size, s, n);
+
+      return ((p == (text + size)) && (n != 0U)) ? npos : size_t(p - text);
+    }
+
+    //*************************************************************************
+    /// Finds the last needle that lies within the first 'position' characters.
+    //*************************************************************************
+    template <typename T>
+    size_t rfind(const T* text, size_t size, size_t position, const T* s, size_t n)
+    {
+      position = (position < size) ? position : size;
+
+      if (n > position)
+      {
+        return npos;
+      }
+
+      if (n == 0U)
+      {
+        return position;
+      }
+
+      const T* p = search_last(text, text + position, s, n);
+
+      return (p == (text + position)) ? npos : size_t(p - text);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,375 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TIMER_WHEEL_INCLUDED
+#define ETL_TIMER_WHEEL_INCLUDED
+
+#include <stdint.h>
+
+#include "../platform.h"
+#include "../timer.h"
+
+///\ingroup private
+
+namespace etl
+{
+  namespace private_timer
+  {
+    //*************************************************************************
+    /// A hierarchical timing wheel for the timer framework.
+    /// Starting, stopping and expiring a timer are O(1).
+    ///
+    /// Time is a 32 bit tick count, split into LEVELS digits of LEVEL_BITS.
+    /// A timer is kept at the level of the highest digit in which its expiry
+    /// time differs from the current time, in the slot for that digit of its
+    /// expiry time. When the lower digits of the current time roll over to
+    /// zero, the slot at the next level up is moved down to lower levels.
+    /// Level 0 holds the timers that expire within the current rotation.
+    ///
+    /// The timer's 'delta' member holds its expiry time.
+    /// The clock skips the value etl::timer::state::INACTIVE, so that an
+    /// expiry time is never mistaken for an inactive timer.
+    ///\tparam TTimerData The timer data type. Must have 'delta', 'previous' and 'next' members.
+    //*************************************************************************
+    template <typename TTimerData>
+    class timer_wheel
+    {
+    public:
+
+      static const uint32_t LEVEL_BITS = 6U;
+      static const uint32_t LEVELS     = 6U; // 36 bits; covers all 32 bit periods.
+      static const uint32_t SLOTS      = 1U << LEVEL_BITS;
+
+      //***********************************************************************
+      /// Constructor.
+      ///\param ptimers_   The array of timers.
+      ///\param pslot_ids_ The slot of each timer. One per timer.
+      //***********************************************************************
+      timer_wheel(TTimerData* ptimers_, uint_least16_t* pslot_ids_)
+        : ptimers(ptimers_),
+          pslot_ids(pslot_ids_),
+          now(0U),
+          active_count(0U)
+      {
+        for (uint32_t i = 0U; i < (LEVELS * SLOTS); ++i)
+        {
+          heads[i] = etl::timer::id::NO_TIMER;
+        }
+
+        for (uint32_t i = 0U; i < LEVELS; ++i)
+        {
+          level_count[i] = 0U;
+        }
+      }
+
+      //***********************************************************************
+      /// Removes all of the timers.
+      //***********************************************************************
+      void clear()
+      {
+        for (uint32_t i = 0U; i < (LEVELS * SLOTS); ++i)
+        {
+          etl::timer::id::type id = heads[i];
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            TTimerData& timer = ptimers[id];
+            id = timer.next;
+            timer.previous = etl::timer::id::NO_TIMER;
+            timer.next     = etl::timer::id::NO_TIMER;
+          }
+
+          heads[i] = etl::timer::id::NO_TIMER;
+        }
+
+        for (uint32_t i = 0U; i < LEVELS; ++i)
+        {
+          level_count[i] = 0U;
+        }
+
+        active_count = 0U;
+      }
+
+      //***********************************************************************
+      /// Adds a timer that expires after 'delay' ticks.
+      /// A delay of zero expires at the next call to tick.
+      //***********************************************************************
+      void insert(etl::timer::id::type id_, uint32_t delay)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        timer.delta = add(now, delay);
+        link(id_);
+        ++active_count;
+      }
+
+      //***********************************************************************
+      /// Removes an active timer.
+      //***********************************************************************
+      void remove(etl::timer::id::type id_)
+      {
+        unlink(id_);
+        --active_count;
+
+        ptimers[id_].delta = etl::timer::state::INACTIVE;
+      }
+
+      //***********************************************************************
+      /// The first timer that expires at the current time.
+      /// Returns etl::timer::id::NO_TIMER if there are none.
+      //***********************************************************************
+      etl::timer::id::type front() const
+      {
+        return heads[digit(now, 0U)];
+      }
+
+      //***********************************************************************
+      /// Advances the time by up to 'count' ticks.
+      /// Stops early at a time when timers expire.
+      /// Returns the number of ticks advanced.
+      //***********************************************************************
+      uint32_t advance(uint32_t count)
+      {
+        uint32_t steps = 0U;
+
+        while (steps < count)
+        {
+          if (active_count == 0U)
+          {
+            now = add(now, count - steps);
+            return count;
+          }
+
+          // Nothing happens until the lowest occupied level comes round,
+          // so jump to just before it.
+          uint32_t level = 0U;
+
+          while (level_count[level] == 0U)
+          {
+            ++level;
+          }
+
+          uint32_t jump = ticks_to_rollover(level) - 1U;
+          uint32_t left = count - steps;
+
+          if (jump >= left)
+          {
+            now = add(now, left);
+            return count;
+          }
+
+          now    = add(now, jump + 1U);
+          steps += jump + 1U;
+
+          cascade();
+
+          if (front() != etl::timer::id::NO_TIMER)
+          {
+            break;
+          }
+        }
+
+        return steps;
+      }
+
+    private:
+
+      //***********************************************************************
+      /// Adds ticks to a time, skipping etl::timer::state::INACTIVE.
+      //***********************************************************************
+      static uint32_t add(uint32_t time, uint32_t ticks)
+      {
+        const uint32_t room = uint32_t(etl::timer::state::INACTIVE) - 1U - time;
+
+        return (ticks <= room) ? time + ticks : ticks - room - 1U;
+      }
+
+      //***********************************************************************
+      /// The digit of a time for a level.
+      //***********************************************************************
+      static uint32_t digit(uint32_t time, uint32_t level)
+      {
+        return (time >> (level * LEVEL_BITS)) & (SLOTS - 1U);
+      }
+
+      //***********************************************************************
+      /// The number of ticks until the digits below 'level' are next all zero.
+      /// This is when the timers at 'level' may be moved or expired.
+      //***********************************************************************
+      uint32_t ticks_to_rollover(uint32_t level) const
+      {
+        const uint32_t to_wrap   = uint32_t(etl::timer::state::INACTIVE) - now;
+        const uint32_t span      = uint32_t(1UL << (level * LEVEL_BITS));
+        const uint32_t to_period = span - (now & (span - 1U));
+
+        return (to_period < to_wrap) ? to_period : to_wrap;
+      }
+
+      //***********************************************************************
+      /// Moves timers down from the levels whose slot has just come round.
+      /// Higher levels first, so that their timers can move down again.
+      //***********************************************************************
+      void cascade()
+      {
+        if (digit(now, 0U) != 0U)
+        {
+          return;
+        }
+
+        uint32_t top = 1U;
+
+        while ((top < (LEVELS - 1U)) && (digit(now, top) == 0U))
+        {
+          ++top;
+        }
+
+        for (uint32_t level = top; level > 0U; --level)
+        {
+          const uint32_t slot = (level * SLOTS) + digit(now, level);
+
+          etl::timer::id::type id = heads[slot];
+
+          heads[slot] = etl::timer::id::NO_TIMER;
+
+          while (id != etl::timer::id::NO_TIMER)
+          {
+            etl::timer::id::type next = ptimers[id].next;
+
+            --level_count[level];
+            link(id);
+
+            id = next;
+          }
+        }
+      }
+
+      //***********************************************************************
+      /// Puts a timer in the slot for its expiry time.
+      //***********************************************************************
+      void link(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        uint32_t level = LEVELS - 1U;
+        uint32_t slot  = level * SLOTS;
+
+        // Expiry times that have wrapped round wait in the top level's first slot,
+        // which only comes round when the clock wraps.
+        if (timer.delta >= now)
+        {
+          const uint32_t differences = timer.delta ^ now;
+
+          level = 0U;
+
+          while ((level < (LEVELS - 1U)) && ((differences >> ((level + 1U) * LEVEL_BITS)) != 0U))
+          {
+            ++level;
+          }
+
+          slot = (level * SLOTS) + digit(timer.delta, level);
+        }
+
+        // Add to the back of the slot.
+        etl::timer::id::type tail = heads[slot];
+
+        timer.next = etl::timer::id::NO_TIMER;
+
+        if (tail == etl::timer::id::NO_TIMER)
+        {
+          heads[slot]    = id_;
+          timer.previous = id_;
+        }
+        else
+        {
+          // The head's 'previous' is the tail.
+          TTimerData& head = ptimers[tail];
+          tail = head.previous;
+
+          ptimers[tail].next = id_;
+          timer.previous     = tail;
+          head.previous      = id_;
+        }
+
+        pslot_ids[id_] = uint_least16_t(slot);
+        ++level_count[level];
+      }
+
+      //***********************************************************************
+      /// Takes a timer out of its slot.
+      //***********************************************************************
+      void unlink(etl::timer::id::type id_)
+      {
+        TTimerData& timer = ptimers[id_];
+
+        const uint32_t       slot = pslot_ids[id_];
+        etl::timer::id::type head = heads[slot];
+
+        if (head == id_)
+        {
+          heads[slot] = timer.next;
+
+          if (timer.next != etl::timer::id::NO_TIMER)
+          {
+            ptimers[timer.next].previous = timer.previous;
+          }
+        }
+        else
+        {
+          ptimers[timer.previous].next = timer.next;
+
+          if (timer.next != etl::timer::id::NO_TIMER)
+          {
+            ptimers[timer.next].previous = timer.previous;
+          }
+          else
+          {
+            // Removing the tail.
+            ptimers[head].previous = timer.previous;
+          }
+        }
+
+        timer.previous = etl::timer::id::NO_TIMER;
+        timer.next     = etl::timer::id::NO_TIMER;
+
+        --level_count[slot / SLOTS];
+      }
+
+      TTimerData* const     ptimers;
+      uint_least16_t* const pslot_ids;
+
+      uint32_t      now;                          ///< The current time.
+      uint_least8_t active_count;                 ///< The number of timers in the wheel.
+      uint_least8_t level_count[LEVELS];          ///< The number of timers at each level.
+      uint_least8_t heads[LEVELS * SLOTS];        ///< The first timer in each slot.
+    };
+  }
+}
+
+#endif
@@ -41,12 +41,14 @@ SOFTWARE.
 #include "../basic_format_spec.h"
 #include "../type_traits.h"
 #include "../container.h"
-#include "../absolute.h"
 
 #include "../stl/algorithm.h"
 #include "../stl/iterator.h"
 #include "../stl/limits.h"
 
+#include "ieee754.h"
+#include "ryu.h"
+
 namespace etl
 {
   namespace private_to_string
@@ -125,51 +127,233 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Helper function for integrals.
+    /// Digit tables.
     //***************************************************************************
-    template <typename T, typename TIString>
-    void add_integral(T value,
-                      TIString& str,
-                      const etl::basic_format_spec<TIString>& format,
-                      const bool append)
+    template <typename T = void>
+    struct digits
     {
-      typedef typename TIString::value_type type;
-      typedef typename TIString::iterator   iterator;
+      static const char pairs[201];
+      static const char lower[17];
+      static const char upper[17];
+    };
 
-      const bool negative = etl::is_negative(value);
+    template <typename T>
+    const char digits<T>::pairs[201] = "00010203040506070809101112131415161718192021222324252627282930313233343536373839404142434445464748495051525354555657585960616263646566676869707172737475767778798081828384858687888990919293949596979899";
 
-      if (!append)
+    template <typename T>
+    const char digits<T>::lower[17] = "0123456789abcdef";
+
+    template <typename T>
+    const char digits<T>::upper[17] = "0123456789ABCDEF";
+
+    //***************************************************************************
+    /// Large enough for 64 binary digits and a sign, or a formatted floating
+    /// point value.
+    //***************************************************************************
+    static const size_t BUFFER_SIZE = 72U;
+
+    //***************************************************************************
+    /// Writes the decimal digits of 'value', two at a time, to the characters
+    /// before 'p'.
+    /// \return The position of the first digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal(uint32_t value, TChar* p)
+    {
+      const char* const pairs = etl::private_to_string::digits<>::pairs;
+
+      while (value >= 100U)
       {
-        str.clear();
-      }
+        const uint32_t index = (value % 100U) * 2U;
+        value /= 100U;
 
-      iterator start = str.end();
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
 
-      if (value == 0)
+      if (value >= 10U)
       {
-        str.push_back(type('0'));
+        const uint32_t index = value * 2U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
       }
       else
       {
-        // Extract the digits, in reverse order.
-        while (value != 0)
+        *--p = TChar('0' + value);
+      }
+
+      return p;
+    }
+
+    //***************************************************************************
+    /// Writes the decimal digits of 'value' to the characters before 'p'.
+    /// 64 bit division is only used while the value needs it.
+    /// \return The position of the first digit.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_decimal(uint64_t value, TChar* p)
+    {
+      const char* const pairs = etl::private_to_string::digits<>::pairs;
+
+      while (value > 0xFFFFFFFFU)
+      {
+        const uint32_t index = uint32_t(value % 100U) * 2U;
+        value /= 100U;
+
+        *--p = TChar(pairs[index + 1U]);
+        *--p = TChar(pairs[index]);
+      }
+
+      return etl::private_to_string::write_decimal(uint32_t(value), p);
+    }
+
+    //***************************************************************************
+    /// Writes the digits of 'value' in base 2^'shift' to the characters before 'p'.
+    /// \return The position of the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUInt>
+    TChar* write_power_of_2(TUInt value, const uint32_t shift, const char* table, TChar* p)
+    {
+      const TUInt mask = TUInt((1U << shift) - 1U);
+
+      do
+      {
+        *--p = TChar(table[value & mask]);
+        value >>= shift;
+      } while (value != 0U);
+
+      return p;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of 'value' in any other base to the characters before 'p'.
+    /// \return The position of the first digit.
+    //***************************************************************************
+    template <typename TChar, typename TUInt>
+    TChar* write_any_base(TUInt value, const uint32_t base, const bool upper_case, TChar* p)
+    {
+      do
+      {
+        const uint32_t remainder = uint32_t(value % base);
+        value /= base;
+
+        *--p = (remainder > 9U) ? (upper_case ? TChar('A' + (remainder - 10U)) : TChar('a' + (remainder - 10U))) : TChar('0' + remainder);
+      } while (value != 0U);
+
+      return p;
+    }
+
+    //***************************************************************************
+    /// Writes the digits of 'value' in the base of the format to the characters
+    /// before 'p'.
+    /// \return The position of the first digit.
+    //***************************************************************************
+    template <typename TUInt, typename TIString>
+    typename TIString::value_type* write_unsigned(const TUInt value,
+                                                  const etl::basic_format_spec<TIString>& format,
+                                                  typename TIString::value_type* p)
+    {
+      const char* table = format.is_upper_case() ? etl::private_to_string::digits<>::upper : etl::private_to_string::digits<>::lower;
+
+      switch (format.get_base())
+      {
+        case 10U:
         {
-          T remainder = etl::absolute(value % T(format.get_base()));
-          str.push_back((remainder > 9) ? (format.is_upper_case() ? type('A' + (remainder - 10)) : type('a' + (remainder - 10))) : type('0' + remainder));
-          value = value / T(format.get_base());
+          if (sizeof(TUInt) > sizeof(uint32_t))
+          {
+            return etl::private_to_string::write_decimal(uint64_t(value), p);
+          }
+          else
+          {
+            return etl::private_to_string::write_decimal(uint32_t(value), p);
+          }
         }
 
-        // If number is negative, append '-'
-        if ((format.get_base() == 10) && negative)
+        case 16U:
         {
-          str.push_back(type('-'));
+          return etl::private_to_string::write_power_of_2(value, 4U, table, p);
+        }
+
+        case 8U:
+        {
+          return etl::private_to_string::write_power_of_2(value, 3U, table, p);
+        }
+
+        case 2U:
+        {
+          return etl::private_to_string::write_power_of_2(value, 1U, table, p);
         }
 
-        // Reverse the string we appended.
-        ETLSTD::reverse(start, str.end());
+        default:
+        {
+          return etl::private_to_string::write_any_base(value, format.get_base(), format.is_upper_case(), p);
+        }
       }
+    }
 
-      etl::private_to_string::add_alignment(str, start, format);
+    //***************************************************************************
+    /// Adds the fill characters for a field of 'length' characters, if the
+    /// alignment puts them before (or after) the field.
+    //***************************************************************************
+    template <typename TIString>
+    void add_fill(TIString& str, const size_t length, const etl::basic_format_spec<TIString>& format, const bool before)
+    {
+      if ((length < format.get_width()) && (format.is_right() == before))
+      {
+        str.append(format.get_width() - length, format.get_fill());
+      }
+    }
+
+    //***************************************************************************
+    /// Adds the characters in [first, last) with their fill.
+    //***************************************************************************
+    template <typename TIString>
+    void add_field(TIString& str,
+                   const typename TIString::value_type* first,
+                   const typename TIString::value_type* last,
+                   const etl::basic_format_spec<TIString>& format)
+    {
+      const size_t length = size_t(last - first);
+
+      etl::private_to_string::add_fill(str, length, format, true);
+      str.append(first, length);
+      etl::private_to_string::add_fill(str, length, format, false);
+    }
+
+    //***************************************************************************
+    /// Helper function for integrals.
+    /// Only decimal values are signed. Other bases show the magnitude.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_integral(T value,
+                      TIString& str,
+                      const etl::basic_format_spec<TIString>& format,
+                      const bool append)
+    {
+      typedef typename TIString::value_type        type;
+      typedef typename etl::make_unsigned<T>::type utype;
+
+      if (!append)
+      {
+        str.clear();
+      }
+
+      const bool negative = etl::is_negative(value);
+
+      // Negated as unsigned, so that the most negative value does not overflow.
+      const utype magnitude = negative ? utype(utype(0) - utype(value)) : utype(value);
+
+      type buffer[BUFFER_SIZE];
+      type* const last  = buffer + BUFFER_SIZE;
+      type*       first = etl::private_to_string::write_unsigned(magnitude, format, last);
+
+      if ((format.get_base() == 10U) && negative)
+      {
+        *--first = type('-');
+      }
+
+      etl::private_to_string::add_field(str, first, last, format);
     }
 
     //***************************************************************************
@@ -196,85 +380,315 @@ namespace etl
     }
 
     //***************************************************************************
-    /// Helper function for floating point integral and fractional.
+    /// The decimal for a finite, non-zero long double magnitude that is outside
+    /// the normal range of double, to digits10 significant digits, at most 18.
     //***************************************************************************
-    template <typename TIString>
-    void add_integral_fractional(const int64_t integral,
-                                 const int64_t fractional,
-                                 TIString& str,
-                                 const etl::basic_format_spec<TIString>& integral_format,
-                                 const etl::basic_format_spec<TIString>& fractional_format)
+    inline etl::private_ryu::decimal long_double_decimal(const long double magnitude)
+    {
+      const int32_t digits10 = ETLSTD::numeric_limits<long double>::digits10;
+      const int32_t digits   = (digits10 < 18) ? digits10 : 18;
+
+      uint64_t limit = 1U;
+
+      for (int32_t i = 0; i < digits; ++i)
+      {
+        limit *= 10U;
+      }
+
+      // Scale to 'digits' integral digits.
+      // Small magnitudes are scaled up in two steps, as the power of ten may not be representable.
+      int32_t     exponent = int32_t(std::floor(std::log10(magnitude))) - (digits - 1);
+      long double scaled;
+
+      if (exponent < 0)
+      {
+        const int32_t half = -exponent / 2;
+
+        scaled = (magnitude * std::pow(10.0L, half)) * std::pow(10.0L, -exponent - half);
+      }
+      else
+      {
+        scaled = magnitude / std::pow(10.0L, exponent);
+      }
+
+      // Correct for any rounding in the log.
+      if (scaled >= (long double)(limit))
+      {
+        scaled /= 10.0L;
+        ++exponent;
+      }
+      else if (scaled < (long double)(limit / 10U))
+      {
+        scaled *= 10.0L;
+        --exponent;
+      }
+
+      uint64_t mantissa = uint64_t(std::floor(scaled + 0.5L));
+
+      if (mantissa >= limit)
+      {
+        mantissa /= 10U;
+        ++exponent;
+      }
+
+      while ((mantissa % 10U) == 0U)
+      {
+        mantissa /= 10U;
+        ++exponent;
+      }
+
+      const etl::private_ryu::decimal d = { mantissa, exponent };
+
+      return d;
+    }
+
+    //***************************************************************************
+    /// The shortest decimal for a floating point magnitude.
+    /// long double is converted to double, unless it is outside double's normal range.
+    //***************************************************************************
+    inline etl::private_ryu::decimal shortest_decimal(const float value)
+    {
+      return etl::private_ryu::to_decimal(value);
+    }
+
+    inline etl::private_ryu::decimal shortest_decimal(const double value)
+    {
+      return etl::private_ryu::to_decimal(value);
+    }
+
+    inline etl::private_ryu::decimal shortest_decimal(const long double value)
+    {
+      const long double magnitude = (value < 0.0L) ? -value : value;
+
+      const bool is_wider = (ETLSTD::numeric_limits<long double>::max_exponent > ETLSTD::numeric_limits<double>::max_exponent) ||
+                            (ETLSTD::numeric_limits<long double>::min_exponent < ETLSTD::numeric_limits<double>::min_exponent);
+
+      if (is_wider &&
+          ((magnitude > (long double)(ETLSTD::numeric_limits<double>::max())) ||
+           ((magnitude != 0.0L) && (magnitude < (long double)(ETLSTD::numeric_limits<double>::min())))))
+      {
+        return etl::private_to_string::long_double_decimal(magnitude);
+      }
+
+      return etl::private_ryu::to_decimal(double(value));
+    }
+
+    //***************************************************************************
+    /// Writes the shortest decimal 'd' from 'p' onwards.
+    /// Values from 1e-6 to below 1e21 are written in positional notation, others
+    /// as a mantissa and exponent, as ECMAScript's Number.prototype.toString does.
+    /// \return The position after the last character.
+    //***************************************************************************
+    template <typename TChar>
+    TChar* write_shortest(const etl::private_ryu::decimal& d, TChar* p)
+    {
+      TChar  digit_buffer[20];
+      TChar* const digits_last  = digit_buffer + 20;
+      TChar* const digits_first = etl::private_to_string::write_decimal(d.mantissa, digits_last);
+
+      const int32_t length = int32_t(digits_last - digits_first);
+
+      // The position of the decimal point, relative to the first digit.
+      const int32_t point = d.exponent + length;
+
+      if ((length <= point) && (point <= 21))
+      {
+        // ddd000
+        p = ETLSTD::copy(digits_first, digits_last, p);
+        p = ETLSTD::fill_n(p, point - length, TChar('0'));
+      }
+      else if ((0 < point) && (point <= 21))
+      {
+        // ddd.ddd
+        p = ETLSTD::copy(digits_first, digits_first + point, p);
+        *p++ = TChar('.');
+        p = ETLSTD::copy(digits_first + point, digits_last, p);
+      }
+      else if ((-6 < point) && (point <= 0))
+      {
+        // 0.000ddd
+        *p++ = TChar('0');
+        *p++ = TChar('.');
+        p = ETLSTD::fill_n(p, -point, TChar('0'));
+        p = ETLSTD::copy(digits_first, digits_last, p);
+      }
+      else
+      {
+        // d.ddde+dd
+        *p++ = *digits_first;
+
+        if (length > 1)
+        {
+          *p++ = TChar('.');
+          p = ETLSTD::copy(digits_first + 1, digits_last, p);
+        }
+
+        const int32_t exponent = point - 1;
+
+        *p++ = TChar('e');
+        *p++ = (exponent < 0) ? TChar('-') : TChar('+');
+
+        TChar* const exponent_first = etl::private_to_string::write_decimal(uint32_t((exponent < 0) ? -exponent : exponent), digits_last);
+        p = ETLSTD::copy(exponent_first, digits_last, p);
+      }
+
+      return p;
+    }
+
+    //***************************************************************************
+    /// Helper function for floating point, shortest round trip format.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_shortest(const T value,
+                      TIString& str,
+                      const etl::basic_format_spec<TIString>& format)
     {
       typedef typename TIString::value_type type;
 
-      etl::private_to_string::add_integral(integral, str, integral_format, true);
+      type buffer[BUFFER_SIZE];
+      type* p = buffer;
 
-      if (fractional_format.get_precision() > 0)
+      // Includes negative zero.
+      if (etl::private_ieee754::sign_bit(value))
       {
-        str.push_back(type('.'));
-        etl::private_to_string::add_integral(fractional, str, fractional_format, true);
+        *p++ = type('-');
       }
+
+      p = etl::private_to_string::write_shortest(etl::private_to_string::shortest_decimal(value), p);
+
+      etl::private_to_string::add_field(str, buffer, p, format);
     }
 
     //***************************************************************************
-    /// Helper function for floating point.
+    /// Helper function for floating point, fixed precision format.
+    /// The precision is limited to the type's digits10.
     //***************************************************************************
     template <typename T, typename TIString>
-    void add_floating_point(T value,
-                            TIString& str,
-                            const etl::basic_format_spec<TIString>& format,
-                            const bool append)
+    void add_fixed(const T value,
+                   TIString& str,
+                   const etl::basic_format_spec<TIString>& format)
     {
-      typedef typename TIString::iterator   iterator;
       typedef typename TIString::value_type type;
 
-      if (!append)
+      const uint32_t max_precision = ETLSTD::numeric_limits<T>::digits10;
+      const uint32_t precision     = (format.get_precision() > max_precision) ? max_precision : format.get_precision();
+
+      uint64_t multiplier = 1U;
+
+      for (uint32_t i = 0U; i < precision; ++i)
       {
-        str.clear();
+        multiplier *= 10U;
       }
 
-      iterator start = str.end();
+      const bool negative  = (value < T(0.0));
+      const T    magnitude = negative ? -value : value;
 
-      if (ETLSTD::isnan(value) || ETLSTD::isinf(value))
+      type buffer[BUFFER_SIZE];
+      type* const last  = buffer + BUFFER_SIZE;
+      type*       first = last;
+
+      if (magnitude < T(18446744073709551616.0))
       {
-        etl::private_to_string::add_nan_inf(ETLSTD::isnan(value), ETLSTD::isinf(value), str);
+        // The integral and fractional parts fit in 64 bits.
+        const T  f_integral = floor(magnitude);
+        uint64_t integral   = static_cast<uint64_t>(f_integral);
+        uint64_t fractional = static_cast<uint64_t>(round((magnitude - f_integral) * T(multiplier)));
+
+        // Check for a rounding carry to the integral.
+        if (fractional == multiplier)
+        {
+          ++integral;
+          fractional = 0U;
+        }
+
+        if (precision > 0U)
+        {
+          first = etl::private_to_string::write_decimal(fractional, first);
+
+          while (uint32_t(last - first) < precision)
+          {
+            *--first = type('0');
+          }
+
+          *--first = type('.');
+        }
+
+        first = etl::private_to_string::write_decimal(integral, first);
+
+        if (negative)
+        {
+          *--first = type('-');
+        }
+
+        etl::private_to_string::add_field(str, first, last, format);
       }
       else
       {
-        // Make sure we format the two halves correctly.
-        uint32_t max_precision = ETLSTD::numeric_limits<T>::digits10;
+        // Too large for 64 bits, so there is no fractional part.
+        // The shortest digits are followed by zeros.
+        const etl::private_ryu::decimal d = etl::private_to_string::shortest_decimal(magnitude);
 
-        etl::basic_format_spec<TIString> integral_format = format;
-        integral_format.decimal().width(0).precision(format.get_precision() > max_precision ? max_precision : format.get_precision());
+        first = etl::private_to_string::write_decimal(d.mantissa, first);
 
-        etl::basic_format_spec<TIString> fractional_format = integral_format;
-        fractional_format.width(integral_format.get_precision()).fill(type('0')).right();
+        if (negative)
+        {
+          *--first = type('-');
+        }
 
-        int64_t multiplier = 1;
+        const size_t zeros  = size_t(d.exponent);
+        const size_t length = size_t(last - first) + zeros + ((precision > 0U) ? precision + 1U : 0U);
 
-        for (uint32_t i = 0; i < fractional_format.get_precision(); ++i)
+        etl::private_to_string::add_fill(str, length, format, true);
+        str.append(first, size_t(last - first));
+        str.append(zeros, type('0'));
+
+        if (precision > 0U)
         {
-          multiplier *= 10U;
+          str.push_back(type('.'));
+          str.append(precision, type('0'));
         }
 
-        // Find the integral part of the floating point
-        T f_integral = (value < T(0.0) ? ceil(value) : floor(value));
-        int64_t integral   = static_cast<int64_t>(f_integral);
+        etl::private_to_string::add_fill(str, length, format, false);
+      }
+    }
+
+    //***************************************************************************
+    /// Helper function for floating point.
+    //***************************************************************************
+    template <typename T, typename TIString>
+    void add_floating_point(T value,
+                            TIString& str,
+                            const etl::basic_format_spec<TIString>& format,
+                            const bool append)
+    {
+      typedef typename TIString::iterator   iterator;
+      typedef typename TIString::value_type type;
 
-        // Find the fractional part of the floating point.
-        int64_t fractional = etl::absolute(static_cast<int64_t>(round((value - f_integral) * multiplier)));
+      if (!append)
+      {
+        str.clear();
+      }
 
-        // Check for a rounding carry to the integral.
-        if (fractional == multiplier)
+      if (ETLSTD::isnan(value) || ETLSTD::isinf(value))
+      {
+        iterator start = str.end();
+
+        if (value < T(0.0))
         {
-          ++integral;
-          fractional = 0;
+          str.push_back(type('-'));
         }
 
-        etl::private_to_string::add_integral_fractional(integral, fractional, str, integral_format, fractional_format);
+        etl::private_to_string::add_nan_inf(ETLSTD::isnan(value), ETLSTD::isinf(value), str);
+        etl::private_to_string::add_alignment(str, start, format);
+      }
+      else if (format.is_shortest())
+      {
+        etl::private_to_string::add_shortest(value, str, format);
+      }
+      else
+      {
+        etl::private_to_string::add_fixed(value, str, format);
       }
-
-      etl::private_to_string::add_alignment(str, start, format);
     }
 
     //***************************************************************************
@@ -0,0 +1,193 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_WYHASH_INCLUDED
+#define ETL_WYHASH_INCLUDED
+
+///\ingroup private
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../platform.h"
+
+#include "ieee754.h"
+
+//*****************************************************************************
+// A word at a time hash for strings and byte ranges, after wyhash by Wang Yi
+// (public domain). Reads 4 to 48 bytes per step and mixes with 64 x 64 to
+// 128 bit multiplies, so it is much faster than FNV-1a for all but the
+// shortest keys, with full avalanche.
+//*****************************************************************************
+
+namespace etl
+{
+  namespace private_wyhash
+  {
+    //*************************************************************************
+    /// The secret constants.
+    //*************************************************************************
+    template <typename T = void>
+    struct constants
+    {
+      static const uint64_t secret[4];
+
+      // The seed 0 after mixing, which the compiler does not fold.
+      static const uint64_t ZERO_SEED = 0xCA813BF4C7ABF0A9ULL;
+    };
+
+    template <typename T>
+    const uint64_t constants<T>::secret[4] =
+    {
+      0x2D358DCCAA6C78A5ULL, 0x8BB84B93962EACC9ULL, 0x4B33A62ED433D4A3ULL, 0x4D5A2DA51DE1AA47ULL
+    };
+
+    //*************************************************************************
+    /// Reads 8 bytes, little endian, at any alignment.
+    //*************************************************************************
+    inline uint64_t read_64(const uint8_t* p)
+    {
+      return uint64_t(p[0])         | (uint64_t(p[1]) << 8)  |
+             (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24) |
+             (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) |
+             (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+    }
+
+    //*************************************************************************
+    /// Reads 4 bytes, little endian, at any alignment.
+    //*************************************************************************
+    inline uint64_t read_32(const uint8_t* p)
+    {
+      return uint64_t(p[0])         | (uint64_t(p[1]) << 8) |
+             (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24);
+    }
+
+    //*************************************************************************
+    /// Reads 1 to 3 bytes.
+    //*************************************************************************
+    inline uint64_t read_3(const uint8_t* p, size_t length)
+    {
+      return (uint64_t(p[0]) << 16) | (uint64_t(p[length >> 1]) << 8) | uint64_t(p[length - 1]);
+    }
+
+    //*************************************************************************
+    /// Multiplies a and b, and combines the halves of the product.
+    //*************************************************************************
+    inline uint64_t mix(uint64_t a, uint64_t b)
+    {
+      uint64_t high;
+      const uint64_t low = etl::private_ieee754::multiply_64(a, b, high);
+
+      return low ^ high;
+    }
+
+    //*************************************************************************
+    /// The 64 bit hash of [begin, end).
+    //*************************************************************************
+    inline uint64_t hash(const uint8_t* begin, const uint8_t* end, uint64_t seed = 0U)
+    {
+      const uint64_t* const secret = constants<>::secret;
+
+      const uint8_t* p      = begin;
+      const size_t   length = size_t(end - begin);
+
+      seed = (seed == 0U) ? uint64_t(constants<>::ZERO_SEED) : (seed ^ mix(seed ^ secret[0], secret[1]));
+
+      uint64_t a;
+      uint64_t b;
+
+      if (length <= 16U)
+      {
+        if (length >= 4U)
+        {
+          // Two overlapping pairs of 4 byte reads cover 4 to 16 bytes.
+          const size_t offset = (length >> 3) << 2;
+
+          a = (read_32(p) << 32) | read_32(p + offset);
+          b = (read_32(p + length - 4U) << 32) | read_32(p + length - 4U - offset);
+        }
+        else if (length > 0U)
+        {
+          a = read_3(p, length);
+          b = 0U;
+        }
+        else
+        {
+          a = 0U;
+          b = 0U;
+        }
+      }
+      else
+      {
+        size_t remaining = length;
+
+        // Three independent lanes of 16 bytes.
+        if (remaining >= 48U)
+        {
+          uint64_t seed1 = seed;
+          uint64_t seed2 = seed;
+
+          do
+          {
+            seed  = mix(read_64(p)      ^ secret[1], read_64(p + 8)  ^ seed);
+            seed1 = mix(read_64(p + 16) ^ secret[2], read_64(p + 24) ^ seed1);
+            seed2 = mix(read_64(p + 32) ^ secret[3], read_64(p + 40) ^ seed2);
+            p         += 48;
+            remaining -= 48U;
+          } while (remaining >= 48U);
+
+          seed ^= seed1 ^ seed2;
+        }
+
+        while (remaining > 16U)
+        {
+          seed = mix(read_64(p) ^ secret[1], read_64(p + 8) ^ seed);
+          p         += 16;
+          remaining -= 16U;
+        }
+
+        // The last 16 bytes, which may overlap the ones already mixed.
+        a = read_64(p + remaining - 16U);
+        b = read_64(p + remaining - 8U);
+      }
+
+      a ^= secret[1];
+      b ^= seed;
+
+      uint64_t high;
+      a = etl::private_ieee754::multiply_64(a, b, high);
+      b = high;
+
+      return mix(a ^ secret[0] ^ uint64_t(length), b ^ secret[1]);
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,613 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+#define ETL_MPMC_QUEUE_ATOMIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <new>
+
+#include "platform.h"
+#include "alignment.h"
+#include "parameter_type.h"
+#include "atomic.h"
+#include "memory_model.h"
+#include "integral_limits.h"
+#include "type_traits.h"
+#include "power.h"
+#include "static_assert.h"
+#include "private/padding.h"
+
+#undef ETL_FILE
+#define ETL_FILE "53"
+
+///\defgroup queue_mpmc_atomic Lock free bounded multi-producer, multi-consumer queue
+/// Each slot carries a sequence number that tells producers and consumers
+/// whether it is free to write, ready to read, or still owned by another thread.
+/// Producers and consumers claim slots with a compare-and-swap on their own
+/// position counter and never wait for each other.
+///\ingroup containers
+
+namespace etl
+{
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// The base for all queue_mpmc_atomic types.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, the producer and consumer positions are
+  ///                         separated by this many bytes, so that producers and
+  ///                         consumers do not contend for the same cache line. Typically 64.
+  //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
+  class queue_mpmc_atomic_base
+  {
+  public:
+
+    /// The type used for determining the size of queue.
+    typedef typename etl::size_type_lookup<MEMORY_MODEL>::type size_type;
+
+    //*************************************************************************
+    /// Is the queue empty?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool empty() const
+    {
+      return size() == 0;
+    }
+
+    //*************************************************************************
+    /// Is the queue full?
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    bool full() const
+    {
+      return size() == MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items in the queue?
+    /// Due to concurrency, this is a guess.
+    /// Includes items that are in the process of being pushed or popped.
+    //*************************************************************************
+    size_type size() const
+    {
+      // Load the consumer position first so that the difference can never be negative.
+      size_type dequeue = dequeue_position.load(etl::memory_order_acquire);
+      size_type enqueue = enqueue_position.load(etl::memory_order_acquire);
+
+      size_type used = size_type(enqueue - dequeue);
+
+      return (used > MAX_SIZE) ? MAX_SIZE : used;
+    }
+
+    //*************************************************************************
+    /// How much free space available in the queue.
+    /// Due to concurrency, this is a guess.
+    //*************************************************************************
+    size_type available() const
+    {
+      return MAX_SIZE - size();
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type capacity() const
+    {
+      return MAX_SIZE;
+    }
+
+    //*************************************************************************
+    /// How many items can the queue hold.
+    //*************************************************************************
+    size_type max_size() const
+    {
+      return MAX_SIZE;
+    }
+
+  protected:
+
+    queue_mpmc_atomic_base(size_type max_size_)
+      : MAX_SIZE(max_size_),
+        MASK(max_size_ - 1),
+        enqueue_position(0),
+        dequeue_position(0)
+    {
+    }
+
+    const size_type MAX_SIZE; ///< The maximum number of items in the queue. A power of 2.
+    const size_type MASK;     ///< Converts a position to a slot index.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding1;
+
+    etl::atomic<size_type> enqueue_position; ///< The next position to push to. Shared by the producers.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding2;
+
+    etl::atomic<size_type> dequeue_position; ///< The next position to pop from. Shared by the consumers.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding3;
+
+  private:
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+#if defined(ETL_POLYMORPHIC_MPMC_QUEUE_ATOMIC) || defined(ETL_POLYMORPHIC_CONTAINERS)
+  public:
+    virtual ~queue_mpmc_atomic_base()
+    {
+    }
+#else
+  protected:
+    ~queue_mpmc_atomic_base()
+    {
+    }
+#endif
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  ///\brief This is the base for all queue_mpmc_atomics that contain a particular type.
+  ///\details Normally a reference to this type will be taken from a derived queue_mpmc_atomic.
+  ///\code
+  /// etl::queue_mpmc_atomic<int, 16> myQueue;
+  /// etl::iqueue_mpmc_atomic<int>& iQueue = myQueue;
+  ///\endcode
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// 'push', 'emplace' and 'pop' never block; they return false if the queue is full or empty.
+  /// \tparam T               The type of value that the queue_mpmc_atomic holds.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, separates the producer and consumer positions by this many bytes.
+  //***************************************************************************
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
+  class iqueue_mpmc_atomic : public queue_mpmc_atomic_base<MEMORY_MODEL, CACHE_LINE_SIZE>
+  {
+  private:
+
+    typedef typename etl::parameter_type<T>::type                               parameter_t;
+    typedef typename etl::queue_mpmc_atomic_base<MEMORY_MODEL, CACHE_LINE_SIZE> base_t;
+
+  public:
+
+    typedef T                          value_type;      ///< The type stored in the queue.
+    typedef T&                         reference;       ///< A reference to the type used in the queue.
+    typedef const T&                   const_reference; ///< A const reference to the type used in the queue.
+    typedef typename base_t::size_type size_type;       ///< The type used for determining the size of the queue.
+
+    using base_t::MASK;
+    using base_t::enqueue_position;
+    using base_t::dequeue_position;
+
+    //*************************************************************************
+    /// Push a value to the queue.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    bool push(parameter_t value)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(value);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename ... Args>
+    bool emplace(Args&&... args)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(std::forward<Args>(args)...);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#else
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename T1>
+    bool emplace(const T1& value1)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(value1);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2>
+    bool emplace(const T1& value1, const T2& value2)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(value1, value2);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Constructs a value in the queue 'in place'.
+    /// Returns false if the queue is full.
+    //*************************************************************************
+    template <typename T1, typename T2, typename T3, typename T4>
+    bool emplace(const T1& value1, const T2& value2, const T3& value3, const T4& value4)
+    {
+      cell_t* p_cell = claim_for_push();
+
+      if (p_cell != 0)
+      {
+        ::new (&p_cell->value) T(value1, value2, value3, value4);
+        publish_push(p_cell);
+
+        return true;
+      }
+
+      // Queue is full.
+      return false;
+    }
+#endif
+
+    //*************************************************************************
+    /// Pop a value from the queue.
+    /// Returns false if the queue is empty.
+    //*************************************************************************
+    bool pop(reference value)
+    {
+      cell_t* p_cell = claim_for_pop();
+
+      if (p_cell != 0)
+      {
+        T& item = *reinterpret_cast<T*>(&p_cell->value);
+
+        value = item;
+        item.~T();
+        publish_pop(p_cell);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pop a value from the queue and discard.
+    /// Returns false if the queue is empty.
+    //*************************************************************************
+    bool pop()
+    {
+      cell_t* p_cell = claim_for_pop();
+
+      if (p_cell != 0)
+      {
+        reinterpret_cast<T*>(&p_cell->value)->~T();
+        publish_pop(p_cell);
+
+        return true;
+      }
+
+      // Queue is empty.
+      return false;
+    }
+
+    //*************************************************************************
+    /// Pops up to 'max_count' values, passing each one to 'functor' before it
+    /// is destroyed, so that the value is not copied out of the queue.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    template <typename TFunctor>
+    size_type consume(TFunctor& functor, size_type max_count)
+    {
+      size_type count = 0;
+
+      while (count < max_count)
+      {
+        cell_t* p_cell = claim_for_pop();
+
+        if (p_cell == 0)
+        {
+          // Queue is empty.
+          break;
+        }
+
+        T& item = *reinterpret_cast<T*>(&p_cell->value);
+
+        functor(item);
+        item.~T();
+        publish_pop(p_cell);
+
+        ++count;
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Clear the queue.
+    /// Items pushed concurrently with the call may remain.
+    //*************************************************************************
+    void clear()
+    {
+      while (pop())
+      {
+        // Do nothing.
+      }
+    }
+
+  protected:
+
+    //*************************************************************************
+    /// A slot in the queue.
+    /// 'sequence' == position           : Free to push to for 'position'.
+    /// 'sequence' == position + 1       : Holds the item pushed at 'position'.
+    /// 'sequence' == position + MAX_SIZE: Free to push to for the next lap.
+    //*************************************************************************
+    struct cell_t
+    {
+      etl::atomic<size_type> sequence;
+      typename etl::aligned_storage<sizeof(T), etl::alignment_of<T>::value>::type value;
+    };
+
+    //*************************************************************************
+    /// The constructor that is called from derived classes.
+    //*************************************************************************
+    iqueue_mpmc_atomic(cell_t* p_cells_, size_type max_size_)
+      : base_t(max_size_),
+        p_cells(p_cells_)
+    {
+    }
+
+    //*************************************************************************
+    /// Sets each slot free for the first lap.
+    /// Called from the derived class once the slots have been constructed.
+    //*************************************************************************
+    void initialise()
+    {
+      for (size_type i = 0; i <= MASK; ++i)
+      {
+        p_cells[i].sequence.store(i, etl::memory_order_relaxed);
+      }
+    }
+
+  private:
+
+    typedef typename etl::make_signed<size_type>::type difference_t;
+
+    //*************************************************************************
+    /// Claims the slot at the current enqueue position.
+    /// Returns 0 if the queue is full.
+    //*************************************************************************
+    cell_t* claim_for_push()
+    {
+      size_type position = enqueue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_t*      p_cell     = &p_cells[position & MASK];
+        size_type    sequence   = p_cell->sequence.load(etl::memory_order_acquire);
+        difference_t difference = difference_t(size_type(sequence - position));
+
+        if (difference == 0)
+        {
+          // The slot is free. Try to claim it.
+          if (enqueue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot still holds the item from the previous lap.
+          return 0;
+        }
+        else
+        {
+          // Another producer claimed this position first.
+          position = enqueue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Claims the slot at the current dequeue position.
+    /// Returns 0 if the queue is empty.
+    //*************************************************************************
+    cell_t* claim_for_pop()
+    {
+      size_type position = dequeue_position.load(etl::memory_order_relaxed);
+
+      while (true)
+      {
+        cell_t*      p_cell     = &p_cells[position & MASK];
+        size_type    sequence   = p_cell->sequence.load(etl::memory_order_acquire);
+        difference_t difference = difference_t(size_type(sequence - size_type(position + 1)));
+
+        if (difference == 0)
+        {
+          // The slot holds an item. Try to claim it.
+          if (dequeue_position.compare_exchange_weak(position, size_type(position + 1), etl::memory_order_relaxed))
+          {
+            return p_cell;
+          }
+        }
+        else if (difference < 0)
+        {
+          // The slot has not been pushed to yet.
+          return 0;
+        }
+        else
+        {
+          // Another consumer claimed this position first.
+          position = dequeue_position.load(etl::memory_order_relaxed);
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Marks a claimed slot as ready to pop.
+    //*************************************************************************
+    static void publish_push(cell_t* p_cell)
+    {
+      size_type sequence = p_cell->sequence.load(etl::memory_order_relaxed);
+
+      p_cell->sequence.store(size_type(sequence + 1), etl::memory_order_release);
+    }
+
+    //*************************************************************************
+    /// Marks a claimed slot as free for the next lap.
+    //*************************************************************************
+    void publish_pop(cell_t* p_cell)
+    {
+      size_type sequence = p_cell->sequence.load(etl::memory_order_relaxed);
+
+      p_cell->sequence.store(size_type(sequence + MASK), etl::memory_order_release);
+    }
+
+    // Disable copy construction and assignment.
+    iqueue_mpmc_atomic(const iqueue_mpmc_atomic&);
+    iqueue_mpmc_atomic& operator =(const iqueue_mpmc_atomic&);
+
+    cell_t* p_cells; ///< The internal buffer.
+  };
+
+  //***************************************************************************
+  ///\ingroup queue_mpmc_atomic
+  /// A fixed capacity lock free mpmc queue.
+  /// This queue supports concurrent access by any number of producers and consumers.
+  /// \tparam T               The type this queue should support.
+  /// \tparam SIZE            The maximum capacity of the queue. Must be a power of 2.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, separates the producer and consumer positions by this many bytes.
+  //***************************************************************************
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
+  class queue_mpmc_atomic : public iqueue_mpmc_atomic<T, MEMORY_MODEL, CACHE_LINE_SIZE>
+  {
+  private:
+
+    typedef typename etl::iqueue_mpmc_atomic<T, MEMORY_MODEL, CACHE_LINE_SIZE> base_t;
+    typedef typename base_t::cell_t                                             cell_t;
+
+  public:
+
+    typedef typename base_t::size_type size_type;
+
+    ETL_STATIC_ASSERT(etl::is_power_of_2<SIZE>::value, "Size must be a power of 2");
+    ETL_STATIC_ASSERT((SIZE <= (etl::integral_limits<size_type>::max / 2U)), "Size too large for memory model");
+
+    static const size_type MAX_SIZE = size_type(SIZE);
+
+    //*************************************************************************
+    /// Default constructor.
+    //*************************************************************************
+    queue_mpmc_atomic()
+      : base_t(cells, MAX_SIZE)
+    {
+      base_t::initialise();
+    }
+
+    //*************************************************************************
+    /// Destructor.
+    //*************************************************************************
+    ~queue_mpmc_atomic()
+    {
+      base_t::clear();
+    }
+
+  private:
+
+    /// The slots used in the queue_mpmc_atomic.
+    cell_t cells[SIZE];
+  };
+}
+
+#undef ETL_FILE
+
+#endif
@@ -43,6 +43,12 @@ SOFTWARE.
 #include "memory_model.h"
 #include "integral_limits.h"
 
+// Define ETL_QUEUE_POP_WAIT to add a blocking 'pop_wait', where etl::event_count is available.
+// Every 'push' and 'emplace' then notifies a waiting thread.
+#if defined(ETL_QUEUE_POP_WAIT)
+  #include "event_count.h"
+#endif
+
 #undef ETL_FILE
 #define ETL_FILE "48"
 
@@ -161,6 +167,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -178,6 +186,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 #else
@@ -194,6 +204,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -210,6 +222,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -226,6 +240,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -242,6 +258,8 @@ namespace etl
 
       access.unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 #endif
@@ -274,6 +292,18 @@ namespace etl
       return result;
     }
 
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    /// Pop a value from the queue, waiting up to 'timeout_ms' milliseconds for
+    /// one to be pushed if the queue is empty.
+    /// Returns false if no value could be popped before the timeout.
+    //*************************************************************************
+    bool pop_wait(reference value, uint32_t timeout_ms)
+    {
+      return pushed_event.wait_for(pop_into(*this, value), timeout_ms);
+    }
+#endif
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
@@ -526,6 +556,43 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Wakes a thread waiting in pop_wait, if a value was pushed.
+    //*************************************************************************
+    void notify_pushed(bool pushed)
+    {
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+      if (pushed)
+      {
+        pushed_event.notify_one();
+      }
+#else
+      (void)pushed;
+#endif
+    }
+
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    /// Pops to a value when called. Used as the condition for pop_wait.
+    //*************************************************************************
+    struct pop_into
+    {
+      pop_into(iqueue_mpmc_mutex& queue_, reference value_)
+        : queue(queue_),
+          value(value_)
+      {
+      }
+
+      bool operator()() const
+      {
+        return queue.pop(value);
+      }
+
+      iqueue_mpmc_mutex& queue;
+      reference value;
+    };
+#endif
+
     // Disable copy construction and assignment.
     iqueue_mpmc_mutex(const iqueue_mpmc_mutex&);
     iqueue_mpmc_mutex& operator =(const iqueue_mpmc_mutex&);
@@ -533,6 +600,10 @@ namespace etl
     T* p_buffer; ///< The internal buffer.
 
     mutable etl::mutex access; ///< The object that locks/unlocks access.
+
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    etl::event_count pushed_event; ///< Signalled when a value is pushed.
+#endif
   };
 
   //***************************************************************************
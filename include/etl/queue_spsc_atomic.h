@@ -42,13 +42,23 @@ SOFTWARE.
 #include "atomic.h"
 #include "memory_model.h"
 #include "integral_limits.h"
+#include "nullptr.h"
+#include "private/padding.h"
 
 #undef ETL_FILE
 #define ETL_FILE "47"
 
 namespace etl
 {
-  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
+  //***************************************************************************
+  ///\ingroup queue_spsc_atomic
+  /// The base for all queue_spsc_atomic types.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, the producer and consumer indexes are
+  ///                         separated by this many bytes, so that the two threads do
+  ///                         not contend for the same cache line. Typically 64.
+  //***************************************************************************
+  template <const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
   class queue_spsc_atomic_base
   {
   public:
@@ -85,20 +95,9 @@ namespace etl
     size_type size() const
     {
       size_type write_index = write.load(etl::memory_order_acquire);
-      size_type read_index = read.load(etl::memory_order_acquire);
-
-      size_type n;
-
-      if (write_index >= read_index)
-      {
-        n = write_index - read_index;
-      }
-      else
-      {
-        n = RESERVED - read_index + write_index - 1;
-      }
+      size_type read_index  = read.load(etl::memory_order_acquire);
 
-      return n;
+      return get_used(read_index, write_index);
     }
 
     //*************************************************************************
@@ -129,9 +128,11 @@ namespace etl
   protected:
 
     queue_spsc_atomic_base(size_type reserved_)
-      : write(0),
+      : RESERVED(reserved_),
+        write(0),
+        read_cache(0),
         read(0),
-        RESERVED(reserved_)
+        write_cache(0)
     {
     }
 
@@ -150,10 +151,102 @@ namespace etl
       return index;
     }
 
-    etl::atomic<size_type> write; ///< Where to input new data.
-    etl::atomic<size_type> read;  ///< Where to get the oldest data.
+    //*************************************************************************
+    /// Calculate the number of free slots for a write index and read index.
+    //*************************************************************************
+    size_type get_free(size_type write_index, size_type read_index) const
+    {
+      return (read_index > write_index) ? read_index - write_index - 1 : RESERVED - write_index + read_index - 1;
+    }
+
+    //*************************************************************************
+    /// Calculate the number of used slots for a read index and write index.
+    //*************************************************************************
+    size_type get_used(size_type read_index, size_type write_index) const
+    {
+      return (write_index >= read_index) ? write_index - read_index : RESERVED - read_index + write_index;
+    }
+
+    //*************************************************************************
+    /// Will writing to 'next_index' overwrite unread data?
+    /// Called from the 'push' thread only.
+    /// The 'read' index is only reloaded when the cached copy says the queue is full.
+    //*************************************************************************
+    bool is_full_for_push(size_type next_index)
+    {
+      if (next_index == read_cache)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+      }
+
+      return (next_index == read_cache);
+    }
+
+    //*************************************************************************
+    /// Is there nothing to read at 'read_index'?
+    /// Called from the 'pop' thread only.
+    /// The 'write' index is only reloaded when the cached copy says the queue is empty.
+    //*************************************************************************
+    bool is_empty_for_pop(size_type read_index)
+    {
+      if (read_index == write_cache)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+      }
+
+      return (read_index == write_cache);
+    }
+
+    //*************************************************************************
+    /// The number of free slots, as seen by the 'push' thread.
+    /// The 'read' index is only reloaded when the cached copy says there are
+    /// fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_free_for_push(size_type write_index, size_type wanted)
+    {
+      size_type n = get_free(write_index, read_cache);
+
+      if (n < wanted)
+      {
+        read_cache = read.load(etl::memory_order_acquire);
+        n = get_free(write_index, read_cache);
+      }
+
+      return n;
+    }
+
+    //*************************************************************************
+    /// The number of used slots, as seen by the 'pop' thread.
+    /// The 'write' index is only reloaded when the cached copy says there are
+    /// fewer than 'wanted'.
+    //*************************************************************************
+    size_type get_used_for_pop(size_type read_index, size_type wanted)
+    {
+      size_type n = get_used(read_index, write_cache);
+
+      if (n < wanted)
+      {
+        write_cache = write.load(etl::memory_order_acquire);
+        n = get_used(read_index, write_cache);
+      }
+
+      return n;
+    }
+
     const size_type RESERVED;     ///< The maximum number of items in the queue.
 
+    private_padding::padding<CACHE_LINE_SIZE> padding1;
+
+    etl::atomic<size_type> write; ///< Where to input new data. Written by the 'push' thread.
+    size_type read_cache;         ///< The 'push' thread's copy of the 'read' index.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding2;
+
+    etl::atomic<size_type> read;  ///< Where to get the oldest data. Written by the 'pop' thread.
+    size_type write_cache;        ///< The 'pop' thread's copy of the 'write' index.
+
+    private_padding::padding<CACHE_LINE_SIZE> padding3;
+
   private:
 
     //*************************************************************************
@@ -181,15 +274,17 @@ namespace etl
   /// etl::iqueue_spsc_atomic<int>& iQueue = myQueue;
   ///\endcode
   /// This queue supports concurrent access by one producer and one consumer.
-  /// \tparam T The type of value that the queue_spsc_atomic holds.
+  /// \tparam T               The type of value that the queue_spsc_atomic holds.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, separates the producer and consumer indexes by this many bytes.
   //***************************************************************************
-  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL>
+  template <typename T, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
+  class iqueue_spsc_atomic : public queue_spsc_atomic_base<MEMORY_MODEL, CACHE_LINE_SIZE>
   {
   private:
 
-    typedef typename etl::parameter_type<T>::type              parameter_t;
-    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL> base_t;
+    typedef typename etl::parameter_type<T>::type                               parameter_t;
+    typedef typename etl::queue_spsc_atomic_base<MEMORY_MODEL, CACHE_LINE_SIZE> base_t;
 
   public:
 
@@ -202,6 +297,10 @@ namespace etl
     using base_t::read;
     using base_t::RESERVED;
     using base_t::get_next_index;
+    using base_t::is_full_for_push;
+    using base_t::is_empty_for_pop;
+    using base_t::get_free_for_push;
+    using base_t::get_used_for_pop;
 
     //*************************************************************************
     /// Push a value to the queue.
@@ -211,7 +310,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value);
 
@@ -224,6 +323,79 @@ namespace etl
       return false;
     }
 
+    //*************************************************************************
+    /// Push a range of values to the queue.
+    /// Pushes as many as will fit and publishes them with a single update.
+    /// Returns the number of values pushed.
+    //*************************************************************************
+    template <typename TIterator>
+    size_type push(TIterator first, TIterator last)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_slots  = get_free_for_push(write_index, size_type(RESERVED - 1));
+      size_type count       = 0;
+
+      while ((count < free_slots) && (first != last))
+      {
+        ::new (&p_buffer[write_index]) T(*first);
+        ++first;
+        ++count;
+
+        write_index = get_next_index(write_index, RESERVED);
+      }
+
+      if (count != 0)
+      {
+        write.store(write_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
+    //*************************************************************************
+    /// Reserves contiguous uninitialised slots for writing in place.
+    /// On entry 'n' is the number of slots wanted.
+    /// On exit 'n' is the number of slots reserved, which may be fewer.
+    /// Returns a pointer to the first slot, or nullptr if 'n' is zero.
+    /// The slots must be constructed with placement new, then published with commit().
+    /// Called from the 'push' thread only.
+    //*************************************************************************
+    T* write_reserve(size_type& n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+      size_type free_slots  = get_free_for_push(write_index, n);
+      size_type contiguous  = RESERVED - write_index;
+
+      n = (n < free_slots)  ? n : free_slots;
+      n = (n < contiguous)  ? n : contiguous;
+
+      if (n == 0)
+      {
+        return nullptr;
+      }
+
+      return &p_buffer[write_index];
+    }
+
+    //*************************************************************************
+    /// Publishes 'n' slots, constructed in place after a call to write_reserve().
+    /// 'n' must not be more than the number of slots reserved.
+    /// Called from the 'push' thread only.
+    //*************************************************************************
+    void commit(size_type n)
+    {
+      size_type write_index = write.load(etl::memory_order_relaxed);
+
+      write_index += n;
+
+      if (write_index >= RESERVED)
+      {
+        write_index -= RESERVED;
+      }
+
+      write.store(write_index, etl::memory_order_release);
+    }
+
 #if ETL_CPP11_SUPPORTED && !defined(ETL_STLPORT) && !defined(ETL_QUEUE_ATOMIC_FORCE_CPP03)
     //*************************************************************************
     /// Constructs a value in the queue 'in place'.
@@ -235,7 +407,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(std::forward<Args>(args)...);
 
@@ -258,7 +430,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1);
 
@@ -281,7 +453,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2);
 
@@ -304,7 +476,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3);
 
@@ -327,7 +499,7 @@ namespace etl
       size_type write_index = write.load(etl::memory_order_relaxed);
       size_type next_index  = get_next_index(write_index, RESERVED);
 
-      if (next_index != read.load(etl::memory_order_acquire))
+      if (!is_full_for_push(next_index))
       {
         ::new (&p_buffer[write_index]) T(value1, value2, value3, value4);
 
@@ -348,7 +520,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -364,6 +536,35 @@ namespace etl
       return true;
     }
 
+    //*************************************************************************
+    /// Pop up to 'max_count' values from the queue to an output iterator.
+    /// Frees the popped slots with a single update.
+    /// Returns the number of values popped.
+    //*************************************************************************
+    template <typename TOutputIterator>
+    size_type pop(TOutputIterator out, size_type max_count)
+    {
+      size_type read_index = read.load(etl::memory_order_relaxed);
+      size_type used_slots = get_used_for_pop(read_index, max_count);
+      size_type count      = (max_count < used_slots) ? max_count : used_slots;
+
+      for (size_type i = 0; i < count; ++i)
+      {
+        *out = p_buffer[read_index];
+        ++out;
+        p_buffer[read_index].~T();
+
+        read_index = get_next_index(read_index, RESERVED);
+      }
+
+      if (count != 0)
+      {
+        read.store(read_index, etl::memory_order_release);
+      }
+
+      return count;
+    }
+
     //*************************************************************************
     /// Pop a value from the queue and discard.
     //*************************************************************************
@@ -371,7 +572,7 @@ namespace etl
     {
       size_type read_index = read.load(etl::memory_order_relaxed);
 
-      if (read_index == write.load(etl::memory_order_acquire))
+      if (is_empty_for_pop(read_index))
       {
         // Queue is empty
         return false;
@@ -423,16 +624,18 @@ namespace etl
   ///\ingroup queue_spsc
   /// A fixed capacity spsc queue.
   /// This queue supports concurrent access by one producer and one consumer.
-  /// \tparam T            The type this queue should support.
-  /// \tparam SIZE         The maximum capacity of the queue.
-  /// \tparam MEMORY_MODEL The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam T               The type this queue should support.
+  /// \tparam SIZE            The maximum capacity of the queue.
+  /// \tparam MEMORY_MODEL    The memory model for the queue. Determines the type of the internal counter variables.
+  /// \tparam CACHE_LINE_SIZE If non-zero, separates the producer and consumer indexes by this many bytes.
+  ///                         Use for high throughput between threads on different cores.
   //***************************************************************************
-  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE>
-  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL>
+  template <typename T, size_t SIZE, const size_t MEMORY_MODEL = etl::memory_model::MEMORY_MODEL_LARGE, const size_t CACHE_LINE_SIZE = 0U>
+  class queue_spsc_atomic : public iqueue_spsc_atomic<T, MEMORY_MODEL, CACHE_LINE_SIZE>
   {
   private:
 
-    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL> base_t;
+    typedef typename etl::iqueue_spsc_atomic<T, MEMORY_MODEL, CACHE_LINE_SIZE> base_t;
 
   public:
 
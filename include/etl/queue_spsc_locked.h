@@ -43,6 +43,12 @@ SOFTWARE.
 #include "integral_limits.h"
 #include "function.h"
 
+// Define ETL_QUEUE_POP_WAIT to add a blocking 'pop_wait', where etl::event_count is available.
+// Every 'push' and 'emplace' then notifies a waiting thread.
+#if defined(ETL_QUEUE_POP_WAIT)
+  #include "event_count.h"
+#endif
+
 #undef ETL_FILE
 #define ETL_FILE "46"
 
@@ -422,6 +428,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -439,6 +447,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 #else
@@ -455,6 +465,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -471,6 +483,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -487,6 +501,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 
@@ -503,6 +519,8 @@ namespace etl
 
       unlock();
 
+      notify_pushed(result);
+
       return result;
     }
 #endif
@@ -535,6 +553,19 @@ namespace etl
       return result;
     }
 
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    /// Pop a value from the queue, waiting up to 'timeout_ms' milliseconds for
+    /// one to be pushed if the queue is empty.
+    /// Returns false if no value could be popped before the timeout.
+    /// Values pushed with 'push_from_unlocked' do not wake the waiting thread.
+    //*************************************************************************
+    bool pop_wait(reference value, uint32_t timeout_ms)
+    {
+      return pushed_event.wait_for(pop_into(*this, value), timeout_ms);
+    }
+#endif
+
     //*************************************************************************
     /// Clear the queue.
     //*************************************************************************
@@ -620,12 +651,53 @@ namespace etl
 
   private:
 
+    //*************************************************************************
+    /// Wakes a thread waiting in pop_wait, if a value was pushed.
+    //*************************************************************************
+    void notify_pushed(bool pushed)
+    {
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+      if (pushed)
+      {
+        pushed_event.notify_one();
+      }
+#else
+      (void)pushed;
+#endif
+    }
+
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    /// Pops to a value when called. Used as the condition for pop_wait.
+    //*************************************************************************
+    struct pop_into
+    {
+      pop_into(iqueue_spsc_locked& queue_, reference value_)
+        : queue(queue_),
+          value(value_)
+      {
+      }
+
+      bool operator()() const
+      {
+        return queue.pop(value);
+      }
+
+      iqueue_spsc_locked& queue;
+      reference value;
+    };
+#endif
+
     // Disable copy construction and assignment.
     iqueue_spsc_locked(const iqueue_spsc_locked&);
     iqueue_spsc_locked& operator =(const iqueue_spsc_locked&);
 
     const etl::ifunction<void>& lock;   ///< The callback that locks interrupts.
     const etl::ifunction<void>& unlock; ///< The callback that unlocks interrupts.
+
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    etl::event_count pushed_event; ///< Signalled when a value is pushed with 'push' or 'emplace'.
+#endif
   };
 
   //***************************************************************************
@@ -0,0 +1,217 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_QUEUED_MESSAGE_BUS_INCLUDED
+#define ETL_QUEUED_MESSAGE_BUS_INCLUDED
+
+#include <stdint.h>
+
+#include "platform.h"
+#include "message_bus.h"
+#include "queue_mpmc_atomic.h"
+#include "error_handler.h"
+#include "exception.h"
+
+#undef ETL_FILE
+#define ETL_FILE "54"
+
+///\defgroup queued_message_bus Queued message bus
+/// A message bus that copies each message it receives into a queue and
+/// delivers them later, when process_queue is called.
+/// Any number of threads or interrupts may send to the bus.
+/// process_queue must only be called from one thread at a time.
+
+namespace etl
+{
+  //***************************************************************************
+  /// The message queue is full.
+  //***************************************************************************
+  class queued_message_bus_full : public etl::message_bus_exception
+  {
+  public:
+
+    queued_message_bus_full(string_type file_name_, numeric_type line_number_)
+      : message_bus_exception(ETL_ERROR_TEXT("queued message bus:full", ETL_FILE"A"), file_name_, line_number_)
+    {
+    }
+  };
+
+  //***************************************************************************
+  /// A message bus that queues messages for delivery by process_queue.
+  /// Each message is copied once, into the queue's storage, and is delivered
+  /// from there. Subscribing and unsubscribing are not thread safe.
+  ///\tparam MAX_ROUTERS_         The maximum number of subscribed routers.
+  ///\tparam TPacket              Holds a copy of any message sent to the bus.
+  ///                             Must be constructible from 'const etl::imessage&' and
+  ///                             have 'etl::imessage& get()', like etl::message_router::message_packet.
+  ///\tparam QUEUE_SIZE_          The maximum number of queued messages. Must be a power of 2.
+  ///\tparam INDEXED_MESSAGE_IDS_ The number of message ids in the subscription index. See etl::message_bus.
+  ///\ingroup queued_message_bus
+  //***************************************************************************
+  template <uint_least8_t MAX_ROUTERS_, typename TPacket, size_t QUEUE_SIZE_, size_t INDEXED_MESSAGE_IDS_ = 0U>
+  class queued_message_bus : public etl::message_bus<MAX_ROUTERS_, INDEXED_MESSAGE_IDS_>
+  {
+  private:
+
+    //*******************************************
+    /// A queued message and its addressing.
+    //*******************************************
+    struct item
+    {
+      item(etl::imessage_router& source_, etl::message_router_id_t destination_, const etl::imessage& message_)
+        : p_source(&source_),
+          destination(destination_),
+          packet(message_)
+      {
+      }
+
+      etl::imessage_router*    p_source;
+      etl::message_router_id_t destination;
+      TPacket                  packet;
+    };
+
+    typedef etl::queue_mpmc_atomic<item, QUEUE_SIZE_> queue_t;
+
+  public:
+
+    typedef typename queue_t::size_type size_type;
+
+    using etl::imessage_bus::receive;
+
+    //*******************************************
+    /// Constructor.
+    //*******************************************
+    queued_message_bus()
+    {
+    }
+
+    //*******************************************
+    /// Queues the message for delivery by process_queue.
+    /// All of the other 'receive' overloads come here.
+    /// The source router must still exist when the message is delivered.
+    //*******************************************
+    void receive(etl::imessage_router&    source,
+                 etl::message_router_id_t destination_router_id,
+                 const etl::imessage&     message)
+    {
+      // The bus passes its own temporary null router when there is no source.
+      etl::imessage_router& queued_source = source.is_null_router() ? etl::null_message_router::instance() : source;
+
+      const bool ok = queue.emplace(queued_source, destination_router_id, message);
+
+      ETL_ASSERT(ok, ETL_ERROR(etl::queued_message_bus_full));
+      (void)ok;
+    }
+
+    //*******************************************
+    /// Delivers up to 'max_count' queued messages to the subscribed routers,
+    /// in the order that they were received.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_type process_queue(size_type max_count)
+    {
+      dispatcher deliver(*this);
+
+      return queue.consume(deliver, max_count);
+    }
+
+    //*******************************************
+    /// Delivers the messages that are queued at the time of the call.
+    /// Messages that are sent during the call wait for the next one.
+    /// Returns the number of messages delivered.
+    //*******************************************
+    size_type process_queue()
+    {
+      return process_queue(queue.size());
+    }
+
+    //*******************************************
+    /// The number of messages waiting to be delivered.
+    //*******************************************
+    size_type queue_size() const
+    {
+      return queue.size();
+    }
+
+    //*******************************************
+    /// Are there no messages waiting to be delivered?
+    //*******************************************
+    bool queue_empty() const
+    {
+      return queue.empty();
+    }
+
+    //*******************************************
+    /// The maximum number of messages that can wait to be delivered.
+    //*******************************************
+    size_type queue_capacity() const
+    {
+      return queue.capacity();
+    }
+
+    //*******************************************
+    /// Discards the messages waiting to be delivered.
+    //*******************************************
+    void clear_queue()
+    {
+      queue.clear();
+    }
+
+  private:
+
+    //*******************************************
+    /// Delivers a queued message through the normal bus dispatch.
+    //*******************************************
+    struct dispatcher
+    {
+      dispatcher(etl::imessage_bus& bus_)
+        : bus(bus_)
+      {
+      }
+
+      void operator ()(item& queued)
+      {
+        bus.etl::imessage_bus::receive(*queued.p_source, queued.destination, queued.packet.get());
+      }
+
+      etl::imessage_bus& bus;
+    };
+
+    // Disable copy construction and assignment.
+    queued_message_bus(const queued_message_bus&);
+    queued_message_bus& operator =(const queued_message_bus&);
+
+    queue_t queue;
+  };
+}
+
+#undef ETL_FILE
+
+#endif
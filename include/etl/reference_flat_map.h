@@ -42,6 +42,8 @@ SOFTWARE.
 #include "exception.h"
 #include "static_assert.h"
 
+#include "private/flat_merge.h"
+
 #undef ETL_FILE
 #define ETL_FILE "30"
 
@@ -343,6 +345,11 @@ namespace etl
         return comp(key, element.first);
       }
 
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return comp(lhs.first, rhs.first);
+      }
+
       key_compare comp;
     };
 
@@ -532,11 +539,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -564,14 +567,25 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_map.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Values with keys that are already present, or repeated in the range, are not inserted.
     /// If asserts or exceptions are enabled, emits flat_map_full if the reference_flat_map does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        append(*first++);
+      }
+
+      lookup.erase(merge_appended(n_sorted).ilookup, lookup.end());
+
+      // Any that did not fit go in one at a time, as they may be duplicates.
       while (first != last)
       {
         insert(*first++);
@@ -849,6 +863,31 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, without sorting.
+    /// merge_appended must be called before the reference_flat_map is used.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_map_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was 'n_sorted'.
+    /// Values with duplicate keys are moved to the end.
+    ///\param n_sorted The size before the values were appended.
+    ///\return An iterator to the first duplicate, or end().
+    //*********************************************************************
+    iterator merge_appended(size_t n_sorted)
+    {
+      size_t n_merged = etl::private_flat::merge_appended(lookup, n_sorted, compare, true);
+
+      return iterator(lookup.begin() + n_merged);
+    }
+
   private:
 
     // Disable copy construction and assignment.
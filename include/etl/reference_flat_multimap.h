@@ -39,6 +39,8 @@ SOFTWARE.
 #include "debug_count.h"
 #include "vector.h"
 
+#include "private/flat_merge.h"
+
 #undef ETL_FILE
 #define ETL_FILE "31"
 
@@ -318,6 +320,11 @@ namespace etl
         return comp(key, element.first);
       }
 
+      bool operator ()(const value_type& lhs, const value_type& rhs) const
+      {
+        return comp(lhs.first, rhs.first);
+      }
+
       key_compare comp;
     };
 
@@ -447,11 +454,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -483,14 +486,25 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multimap.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Equal values are placed after those already present, in the order of the range.
     /// If asserts or exceptions are enabled, emits reference_flat_multimap_full if the reference_flat_multimap does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        append(*first++);
+      }
+
+      merge_appended(n_sorted);
+
+      // Any that did not fit go to insert, which reports the error.
       while (first != last)
       {
         insert(*first++);
@@ -762,6 +776,27 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, without sorting.
+    /// merge_appended must be called before the reference_flat_multimap is used.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_multimap_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was 'n_sorted'.
+    ///\param n_sorted The size before the values were appended.
+    //*********************************************************************
+    void merge_appended(size_t n_sorted)
+    {
+      etl::private_flat::merge_appended(lookup, n_sorted, compare, false);
+    }
+
   private:
 
     // Disable copy construction and assignment.
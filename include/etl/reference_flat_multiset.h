@@ -46,6 +46,8 @@ SOFTWARE.
 #include "error_handler.h"
 #include "exception.h"
 
+#include "private/flat_merge.h"
+
 #undef ETL_FILE
 #define ETL_FILE "33"
 
@@ -444,11 +446,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -495,14 +493,25 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_multiset.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Equal values are placed after those already present, in the order of the range.
     /// If asserts or exceptions are enabled, emits reference_flat_multiset_full if the reference_flat_multiset does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        append(*first++);
+      }
+
+      merge_appended(n_sorted);
+
+      // Any that did not fit go to insert, which reports the error.
       while (first != last)
       {
         insert(*first++);
@@ -775,6 +784,27 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, without sorting.
+    /// merge_appended must be called before the reference_flat_multiset is used.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_multiset_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was 'n_sorted'.
+    ///\param n_sorted The size before the values were appended.
+    //*********************************************************************
+    void merge_appended(size_t n_sorted)
+    {
+      etl::private_flat::merge_appended(lookup, n_sorted, compare, false);
+    }
+
   private:
 
     // Disable copy construction.
@@ -46,6 +46,8 @@ SOFTWARE.
 #include "exception.h"
 #include "vector.h"
 
+#include "private/flat_merge.h"
+
 #undef ETL_FILE
 #define ETL_FILE "32"
 
@@ -444,11 +446,7 @@ namespace etl
 #endif
 
       clear();
-
-      while (first != last)
-      {
-        insert(*first++);
-      }
+      insert(first, last);
     }
 
     //*********************************************************************
@@ -476,14 +474,25 @@ namespace etl
 
     //*********************************************************************
     /// Inserts a range of values to the reference_flat_set.
+    /// The values are appended, sorted and merged in, rather than inserted one at a time.
+    /// Values that are already present, or repeated in the range, are not inserted.
     /// If asserts or exceptions are enabled, emits reference_flat_set_full if the reference_flat_set does not have enough free space.
-    ///\param position The position to insert at.
     ///\param first    The first element to add.
     ///\param last     The last + 1 element to add.
     //*********************************************************************
     template <class TIterator>
     void insert(TIterator first, TIterator last)
     {
+      const size_t n_sorted = size();
+
+      while ((first != last) && !full())
+      {
+        append(*first++);
+      }
+
+      lookup.erase(merge_appended(n_sorted).ilookup, lookup.end());
+
+      // Any that did not fit go in one at a time, as they may be duplicates.
       while (first != last)
       {
         insert(*first++);
@@ -757,6 +766,31 @@ namespace etl
       return result;
     }
 
+    //*********************************************************************
+    /// Appends a value to the end of the lookup, without sorting.
+    /// merge_appended must be called before the reference_flat_set is used.
+    ///\param value The value to append.
+    //*********************************************************************
+    void append(value_type& value)
+    {
+      ETL_ASSERT(!lookup.full(), ETL_ERROR(flat_set_full));
+
+      lookup.push_back(&value);
+    }
+
+    //*********************************************************************
+    /// Merges the values appended since the size was 'n_sorted'.
+    /// Values that are duplicates are moved to the end.
+    ///\param n_sorted The size before the values were appended.
+    ///\return An iterator to the first duplicate, or end().
+    //*********************************************************************
+    iterator merge_appended(size_t n_sorted)
+    {
+      size_t n_merged = etl::private_flat::merge_appended(lookup, n_sorted, compare, true);
+
+      return iterator(lookup.begin() + n_merged);
+    }
+
   private:
 
     // Disable copy construction.
@@ -35,6 +35,8 @@ SOFTWARE.
 #include "etl/nullptr.h"
 #include "etl/array.h"
 #include "etl/array_view.h"
+#include "etl/power.h"
+#include "etl/static_assert.h"
 
 namespace etl
 {
@@ -75,6 +77,106 @@ namespace etl
     state_id_t next_state_id;    ///< The next state id.
   };
 
+  //***************************************************************************
+  /// Interface for the storage of a state chart lookup index.
+  /// Holds hash tables that map (state, event) to the first matching transition
+  /// and state id to the first matching state entry.
+  //***************************************************************************
+  class istate_chart_index
+  {
+  public:
+
+    typedef uint16_t index_t;
+
+    static const index_t NONE = 0xFFFFU;
+
+    //*************************************************************************
+    /// The maximum number of transitions that can be indexed.
+    //*************************************************************************
+    size_t max_transitions() const
+    {
+      return MAX_TRANSITIONS;
+    }
+
+    //*************************************************************************
+    /// The maximum number of states that can be indexed.
+    //*************************************************************************
+    size_t max_states() const
+    {
+      return MAX_STATES;
+    }
+
+  protected:
+
+    istate_chart_index(index_t* transition_buckets_,
+                       index_t* next_transition_,
+                       size_t   max_transitions_,
+                       size_t   transition_buckets_size_,
+                       index_t* state_buckets_,
+                       size_t   max_states_,
+                       size_t   state_buckets_size_)
+      : transition_buckets(transition_buckets_),
+        next_transition(next_transition_),
+        MAX_TRANSITIONS(max_transitions_),
+        TRANSITION_MASK(transition_buckets_size_ - 1U),
+        state_buckets(state_buckets_),
+        MAX_STATES(max_states_),
+        STATE_MASK(state_buckets_size_ - 1U)
+    {
+    }
+
+  private:
+
+    template <typename TObject>
+    friend class state_chart;
+
+    // Disabled
+    istate_chart_index(const istate_chart_index&) ETL_DELETE;
+    istate_chart_index& operator =(const istate_chart_index&) ETL_DELETE;
+
+    index_t* const transition_buckets; ///< Index of the first transition for a key, or NONE.
+    index_t* const next_transition;    ///< Index of the next transition with the same key, or NONE.
+    const size_t   MAX_TRANSITIONS;
+    const size_t   TRANSITION_MASK;
+    index_t* const state_buckets;      ///< Index of the first state entry for a state id, or NONE.
+    const size_t   MAX_STATES;
+    const size_t   STATE_MASK;
+  };
+
+  //***************************************************************************
+  /// Storage for a state chart lookup index.
+  /// The index is built when the tables are set, so that processing an event
+  /// does not scan the transition table and changing state does not scan the
+  /// state table.
+  /// Must outlive the state chart that uses it.
+  ///\tparam MAX_TRANSITIONS_ The maximum number of transitions in the table.
+  ///\tparam MAX_STATES_      The maximum number of states in the table.
+  //***************************************************************************
+  template <const size_t MAX_TRANSITIONS_, const size_t MAX_STATES_>
+  class state_chart_index : public istate_chart_index
+  {
+  public:
+
+    ETL_STATIC_ASSERT(MAX_TRANSITIONS_ < istate_chart_index::NONE, "Too many transitions");
+    ETL_STATIC_ASSERT(MAX_STATES_ < istate_chart_index::NONE, "Too many states");
+
+    state_chart_index()
+      : istate_chart_index(transition_buckets_buffer, next_transition_buffer, MAX_TRANSITIONS_, TRANSITION_BUCKETS,
+                           state_buckets_buffer, MAX_STATES_, STATE_BUCKETS)
+    {
+    }
+
+  private:
+
+    // At most half full, so that probe sequences stay short.
+    static const size_t TRANSITION_BUCKETS = etl::power_of_2_round_up<2U * MAX_TRANSITIONS_>::value;
+    static const size_t STATE_BUCKETS      = etl::power_of_2_round_up<2U * MAX_STATES_>::value;
+
+    index_t transition_buckets_buffer[TRANSITION_BUCKETS];
+    index_t next_transition_buffer[MAX_TRANSITIONS_ == 0U ? 1U : MAX_TRANSITIONS_];
+    index_t state_buckets_buffer[STATE_BUCKETS];
+  };
+
   //***************************************************************************
   /// Simple Finite State Machine
   //***************************************************************************
@@ -156,6 +258,8 @@ namespace etl
       : istate_chart(state_id_),
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
+        p_index(nullptr),
+        indexed(false),
         started(false)
     {
     }
@@ -179,19 +283,23 @@ namespace etl
         object(object_),
         transition_table(transition_table_begin_, transition_table_end_),
         state_table(state_table_begin_, state_table_end_),
+        p_index(nullptr),
+        indexed(false),
         started(false)
     {
     }
 
     //*************************************************************************
     /// Sets the transition table.
-    /// \param state_table_begin_ The start of the state table.
-    /// \param state_table_end_   The end of the state table.
+    /// Rebuilds the index, if one is set.
+    /// \param transition_table_begin_ The start of the transition table.
+    /// \param transition_table_end_   The end of the transition table.
     //*************************************************************************
     void set_transition_table(const transition* transition_table_begin_,
                               const transition* transition_table_end_)
     {
       transition_table.assign(transition_table_begin_, transition_table_end_);
+      build_index();
     }
 
     //*************************************************************************
@@ -203,6 +311,38 @@ namespace etl
                          const state* state_table_end_)
     {
       state_table.assign(state_table_begin_, state_table_end_);
+      build_index();
+    }
+
+    //*************************************************************************
+    /// Sets the storage for the lookup index and builds it from the tables.
+    /// Events are then matched to transitions, and state ids to state entries,
+    /// without scanning the tables.
+    /// If the tables are larger than the index can hold then the chart falls
+    /// back to scanning them.
+    /// \param index The index storage. Must outlive the state chart.
+    //*************************************************************************
+    void set_index(etl::istate_chart_index& index)
+    {
+      p_index = &index;
+      build_index();
+    }
+
+    //*************************************************************************
+    /// Stops using the lookup index.
+    //*************************************************************************
+    void clear_index()
+    {
+      p_index = nullptr;
+      indexed = false;
+    }
+
+    //*************************************************************************
+    /// Returns <b>true</b> if the tables are currently looked up through an index.
+    //*************************************************************************
+    bool is_indexed() const
+    {
+      return indexed;
     }
 
     //*************************************************************************
@@ -224,8 +364,8 @@ namespace etl
     }
 
     //*************************************************************************
-    /// Gets the current state id.
-    /// \return The current state id.
+    /// Finds the first entry in the state table for a state id.
+    /// \return A pointer to the state entry, or the end of the state table.
     //*************************************************************************
     const state* find_state(state_id_t state_id)
     {
@@ -233,6 +373,24 @@ namespace etl
       {
         return state_table.end();
       }
+      else if (indexed)
+      {
+        size_t bucket = hash_state(state_id) & p_index->STATE_MASK;
+
+        while (p_index->state_buckets[bucket] != istate_chart_index::NONE)
+        {
+          const state* s = state_table.begin() + p_index->state_buckets[bucket];
+
+          if (s->state_id == state_id)
+          {
+            return s;
+          }
+
+          bucket = (bucket + 1U) & p_index->STATE_MASK;
+        }
+
+        return state_table.end();
+      }
       else
       {
         return ETLSTD::find_if(state_table.begin(),
@@ -274,70 +432,238 @@ namespace etl
     {
       if (started)
       {
-        const transition* t = transition_table.begin();
-
-        // Keep looping until we execute a transition or reach the end of the table.
-        while (t != transition_table.end())
+        if (indexed)
+        {
+          process_event_indexed(event_id);
+        }
+        else
         {
-          // Scan the transition table from the latest position.
-          t = ETLSTD::find_if(t,
-                           transition_table.end(),
-                           is_transition(event_id, current_state_id));
+          const transition* t = transition_table.begin();
 
-          // Found an entry?
-          if (t != transition_table.end())
+          // Keep looping until we execute a transition or reach the end of the table.
+          while (t != transition_table.end())
           {
-            // Shall we execute the transition?
-            if ((t->guard == nullptr) || ((object.*t->guard)()))
-            {
-              // Remember the next state.
-              next_state_id = t->next_state_id;
+            // Scan the transition table from the latest position.
+            t = ETLSTD::find_if(t,
+                             transition_table.end(),
+                             is_transition(event_id, current_state_id));
 
-              // Shall we execute the action?
-              if (t->action != nullptr)
+            // Found an entry?
+            if (t != transition_table.end())
+            {
+              if (execute_transition(*t))
               {
-                (object.*t->action)();
+                t = transition_table.end();
               }
-
-              // Changing state?
-              if (current_state_id != next_state_id)
+              else
               {
-                const state* s;
+                // Start the search from the next item in the table.
+                ++t;
+              }
+            }
+          }
+        }
+      }
+    }
 
-                // See if we have a state item for the current state.
-                s = find_state(current_state_id);
+  private:
 
-                // If the current state has an 'on_exit' then call it.
-                if ((s != state_table.end()) && (s->on_exit != nullptr))
-                {
-                  (object.*(s->on_exit))();
-                }
+    typedef istate_chart_index::index_t index_t;
 
-                current_state_id = next_state_id;
+    //*************************************************************************
+    /// Executes the transition if there is no guard or the guard passes.
+    /// \return <b>true</b> if the transition was executed.
+    //*************************************************************************
+    bool execute_transition(const transition& t)
+    {
+      // Shall we execute the transition?
+      if ((t.guard == nullptr) || ((object.*t.guard)()))
+      {
+        // Remember the next state.
+        next_state_id = t.next_state_id;
 
-                // See if we have a state item for the next state.
-                s = find_state(next_state_id);
+        // Shall we execute the action?
+        if (t.action != nullptr)
+        {
+          (object.*t.action)();
+        }
 
-                // If the new state has an 'on_entry' then call it.
-                if ((s != state_table.end()) && (s->on_entry != nullptr))
-                {
-                  (object.*(s->on_entry))();
-                }
-              }
+        // Changing state?
+        if (current_state_id != next_state_id)
+        {
+          const state* s;
 
-              t = transition_table.end();
-            }
-            else
-            {
-              // Start the search from the next item in the table.
-              ++t;
-            }
+          // See if we have a state item for the current state.
+          s = find_state(current_state_id);
+
+          // If the current state has an 'on_exit' then call it.
+          if ((s != state_table.end()) && (s->on_exit != nullptr))
+          {
+            (object.*(s->on_exit))();
+          }
+
+          current_state_id = next_state_id;
+
+          // See if we have a state item for the next state.
+          s = find_state(next_state_id);
+
+          // If the new state has an 'on_entry' then call it.
+          if ((s != state_table.end()) && (s->on_entry != nullptr))
+          {
+            (object.*(s->on_entry))();
           }
         }
+
+        return true;
       }
+
+      return false;
     }
 
-  private:
+    //*************************************************************************
+    /// Processes an event through the index.
+    /// The transitions for the current state and the transitions from any state
+    /// are two chains in table order. They are merged by table position so that
+    /// the first matching transition in the table is still the one executed.
+    //*************************************************************************
+    void process_event_indexed(const event_id_t event_id)
+    {
+      index_t from_state = find_transition_chain(current_state_id, event_id, false);
+      index_t from_any   = find_transition_chain(0, event_id, true);
+
+      // NONE is larger than any index, so an empty chain is never chosen first.
+      while ((from_state != istate_chart_index::NONE) || (from_any != istate_chart_index::NONE))
+      {
+        index_t i;
+
+        if (from_state < from_any)
+        {
+          i          = from_state;
+          from_state = p_index->next_transition[from_state];
+        }
+        else
+        {
+          i        = from_any;
+          from_any = p_index->next_transition[from_any];
+        }
+
+        if (execute_transition(transition_table[i]))
+        {
+          return;
+        }
+      }
+    }
+
+    //*************************************************************************
+    /// Does the transition have this key?
+    //*************************************************************************
+    static bool has_key(const transition& t, state_id_t state_id, event_id_t event_id, bool from_any_state)
+    {
+      return (t.from_any_state == from_any_state) &&
+             (t.event_id == event_id) &&
+             (from_any_state || (t.current_state_id == state_id));
+    }
+
+    //*************************************************************************
+    /// Gets the first transition in the chain for a key.
+    //*************************************************************************
+    index_t find_transition_chain(state_id_t state_id, event_id_t event_id, bool from_any_state) const
+    {
+      size_t bucket = hash_transition(state_id, event_id, from_any_state) & p_index->TRANSITION_MASK;
+
+      while (p_index->transition_buckets[bucket] != istate_chart_index::NONE)
+      {
+        index_t i = p_index->transition_buckets[bucket];
+
+        if (has_key(transition_table[i], state_id, event_id, from_any_state))
+        {
+          return i;
+        }
+
+        bucket = (bucket + 1U) & p_index->TRANSITION_MASK;
+      }
+
+      return istate_chart_index::NONE;
+    }
+
+    //*************************************************************************
+    /// Builds the index from the tables, if there is one and they fit.
+    //*************************************************************************
+    void build_index()
+    {
+      indexed = (p_index != nullptr) &&
+                (transition_table.size() <= p_index->MAX_TRANSITIONS) &&
+                (state_table.size() <= p_index->MAX_STATES);
+
+      if (!indexed)
+      {
+        return;
+      }
+
+      for (size_t bucket = 0U; bucket <= p_index->TRANSITION_MASK; ++bucket)
+      {
+        p_index->transition_buckets[bucket] = istate_chart_index::NONE;
+      }
+
+      // Walk backwards so that each transition becomes the head of its chain,
+      // leaving the chains in table order.
+      for (size_t i = transition_table.size(); i-- != 0U;)
+      {
+        const transition& t = transition_table[i];
+
+        const state_id_t state_id = t.from_any_state ? 0 : t.current_state_id;
+        size_t bucket = hash_transition(state_id, t.event_id, t.from_any_state) & p_index->TRANSITION_MASK;
+
+        while ((p_index->transition_buckets[bucket] != istate_chart_index::NONE) &&
+               !has_key(transition_table[p_index->transition_buckets[bucket]], state_id, t.event_id, t.from_any_state))
+        {
+          bucket = (bucket + 1U) & p_index->TRANSITION_MASK;
+        }
+
+        p_index->next_transition[i]         = p_index->transition_buckets[bucket];
+        p_index->transition_buckets[bucket] = index_t(i);
+      }
+
+      for (size_t bucket = 0U; bucket <= p_index->STATE_MASK; ++bucket)
+      {
+        p_index->state_buckets[bucket] = istate_chart_index::NONE;
+      }
+
+      // Walk backwards so that the first entry for a state id wins.
+      for (size_t i = state_table.size(); i-- != 0U;)
+      {
+        const state_id_t state_id = state_table[i].state_id;
+        size_t bucket = hash_state(state_id) & p_index->STATE_MASK;
+
+        while ((p_index->state_buckets[bucket] != istate_chart_index::NONE) &&
+               (state_table[p_index->state_buckets[bucket]].state_id != state_id))
+        {
+          bucket = (bucket + 1U) & p_index->STATE_MASK;
+        }
+
+        p_index->state_buckets[bucket] = index_t(i);
+      }
+    }
+
+    //*************************************************************************
+    static size_t hash_state(state_id_t state_id)
+    {
+      uint32_t h = uint32_t(state_id) * 0x9E3779B1UL;
+
+      return size_t(h ^ (h >> 16));
+    }
+
+    //*************************************************************************
+    static size_t hash_transition(state_id_t state_id, event_id_t event_id, bool from_any_state)
+    {
+      uint32_t h = (uint32_t(state_id) * 0x9E3779B1UL) ^ ((uint32_t(event_id) + (from_any_state ? 1U : 0U)) * 0x85EBCA77UL);
+
+      h ^= h >> 15;
+      h *= 0x2C1B3C6DUL;
+      h ^= h >> 13;
+
+      return size_t(h);
+    }
 
     //*************************************************************************
     struct is_transition
@@ -377,10 +703,12 @@ namespace etl
     state_chart(const state_chart&) ETL_DELETE;
     state_chart& operator =(const state_chart&) ETL_DELETE;
 
-    TObject&                                object;           ///< The object that supplies guard and action member functions.
-    const etl::array_view<const transition> transition_table; ///< The table of transitions.
-    etl::array_view<const state>            state_table;      ///< The table of states.
-    bool                                    started;          ///< Set if the state chart has been started.
+    TObject&                          object;           ///< The object that supplies guard and action member functions.
+    etl::array_view<const transition> transition_table; ///< The table of transitions.
+    etl::array_view<const state>      state_table;      ///< The table of states.
+    etl::istate_chart_index*          p_index;          ///< The lookup index, if any.
+    bool                              indexed;          ///< Set if the index matches the tables.
+    bool                              started;          ///< Set if the state chart has been started.
   };
 }
 
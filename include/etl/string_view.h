@@ -490,26 +490,19 @@ namespace etl
     //*************************************************************************
     size_type find(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      const_iterator iposition = ETLSTD::search(begin() + position, end(), view.begin(), view.end());
+      return etl::private_string_search::find(mbegin, size(), position, view.data(), view.size());
+    }
 
-      if (iposition == end())
+    size_type find(T c, size_type position = 0) const
+    {
+      if (position >= size())
       {
         return npos;
       }
-      else
-      {
-        return ETLSTD::distance(begin(), iposition);
-      }
-    }
 
-    size_type find(T c, size_type position = 0) const
-    {
-      return find(etl::basic_string_view<T, TTraits>(&c, 1), position);
+      const_pointer p = etl::private_string_search::find_char(mbegin + position, mend, c);
+
+      return (p == mend) ? npos : size_type(p - mbegin);
     }
 
     size_type find(const T* text, size_type position, size_type count) const
@@ -527,26 +520,7 @@ namespace etl
     //*************************************************************************
     size_type rfind(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if ((size() < view.size()))
-      {
-        return npos;
-      }
-
-      position = ETLSTD::min(position, size());
-
-      const_iterator iposition = ETLSTD::find_end(begin(),
-                                               begin() + position,
-                                               view.begin(),
-                                               view.end());
-
-      if (iposition == end())
-      {
-        return npos;
-      }
-      else
-      {
-        return ETLSTD::distance(begin(), iposition);
-      }
+      return etl::private_string_search::rfind(mbegin, size(), position, view.data(), view.size());
     }
 
     size_type rfind(T c, size_type position = npos) const
@@ -569,25 +543,7 @@ namespace etl
     //*************************************************************************
     size_type find_first_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          const size_t lengthview = view.size();
-
-          for (size_t j = 0; j < lengthview; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              return i;
-            }
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_first_of(mbegin, size(), position, view.data(), view.size(), true);
     }
 
     size_type find_first_of(T c, size_type position = 0) const
@@ -610,32 +566,7 @@ namespace etl
     //*************************************************************************
     size_type find_last_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = ETLSTD::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            return position;
-          }
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::find_last_of(mbegin, size(), position, view.data(), view.size(), true);
     }
 
     size_type find_last_of(T c, size_type position = npos) const
@@ -658,32 +589,7 @@ namespace etl
     //*************************************************************************
     size_type find_first_not_of(etl::basic_string_view<T, TTraits> view, size_type position = 0) const
     {
-      const size_t lengthtext = size();
-
-      if (position < lengthtext)
-      {
-        for (size_t i = position; i < lengthtext; ++i)
-        {
-          bool found = false;
-
-          const size_t viewlength = view.size();
-
-          for (size_t j = 0; j < viewlength; ++j)
-          {
-            if (mbegin[i] == view[j])
-            {
-              found = true;
-            }
-          }
-
-          if (!found)
-          {
-            return i;
-          }
-        }
-      }
-
-      return npos;
+      return etl::private_string_search::find_first_of(mbegin, size(), position, view.data(), view.size(), false);
     }
 
     size_type find_first_not_of(T c, size_type position = 0) const
@@ -706,39 +612,7 @@ namespace etl
     //*************************************************************************
     size_type find_last_not_of(etl::basic_string_view<T, TTraits> view, size_type position = npos) const
     {
-      if (empty())
-      {
-        return npos;
-      }
-
-      position = ETLSTD::min(position, size() - 1);
-
-      const_reverse_iterator it = rbegin() + size() - position - 1;
-
-      while (it != rend())
-      {
-        bool found = false;
-
-        const size_t viewlength = view.size();
-
-        for (size_t j = 0; j < viewlength; ++j)
-        {
-          if (mbegin[position] == view[j])
-          {
-            found = true;
-          }
-        }
-
-        if (!found)
-        {
-          return position;
-        }
-
-        ++it;
-        --position;
-      }
-
-      return npos;
+      return etl::private_string_search::find_last_of(mbegin, size(), position, view.data(), view.size(), false);
     }
 
     size_type find_last_not_of(T c, size_type position = npos) const
@@ -825,7 +699,7 @@ namespace etl
   {
     size_t operator()(const etl::string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -835,7 +709,7 @@ namespace etl
   {
     size_t operator()(const etl::wstring_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -845,7 +719,7 @@ namespace etl
   {
     size_t operator()(const etl::u16string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -855,7 +729,7 @@ namespace etl
   {
     size_t operator()(const etl::u32string_view& text) const
     {
-      return etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
+      return etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]),
                                                          reinterpret_cast<const uint8_t*>(&text[text.size()]));
     }
   };
@@ -95,6 +95,23 @@ namespace etl
         INACTIVE = 0xFFFFFFFF
       };
     };
+
+    // Timer schedulers.
+    struct scheduler
+    {
+      /// Active timers are kept in a list, sorted by time to expiry.
+      /// Starting a timer is O(n). The default.
+      struct delta_list
+      {
+      };
+
+      /// Active timers are kept in a hierarchical timing wheel.
+      /// Starting, stopping and expiring a timer are O(1).
+      /// Uses about 400 bytes more than a delta list.
+      struct wheel
+      {
+      };
+    };
   };
 }
 
@@ -0,0 +1,682 @@
+///\file
+
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#ifndef ETL_TO_ARITHMETIC_INCLUDED
+#define ETL_TO_ARITHMETIC_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "platform.h"
+#include "type_traits.h"
+#include "integral_limits.h"
+#include "enum_type.h"
+#include "basic_format_spec.h"
+#include "string_view.h"
+
+#include "stl/limits.h"
+
+#include "private/eisel_lemire.h"
+
+///\defgroup to_arithmetic to_arithmetic
+/// Parses integral and floating point values from characters, without
+/// exceptions, allocation or locales. The reverse of etl::to_string.
+///\ingroup string
+
+namespace etl
+{
+  //***************************************************************************
+  /// The status of a conversion.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  struct to_arithmetic_status
+  {
+    enum enum_type
+    {
+      Valid,
+      Invalid_Radix,
+      Invalid_Format,
+      Signed_To_Unsigned,
+      Overflow
+    };
+
+    ETL_DECLARE_ENUM_TYPE(to_arithmetic_status, int)
+    ETL_ENUM_TYPE(Valid,              "Valid")
+    ETL_ENUM_TYPE(Invalid_Radix,      "Invalid Radix")
+    ETL_ENUM_TYPE(Invalid_Format,     "Invalid Format")
+    ETL_ENUM_TYPE(Signed_To_Unsigned, "Signed To Unsigned")
+    ETL_ENUM_TYPE(Overflow,           "Overflow")
+    ETL_END_ENUM_TYPE
+  };
+
+  //***************************************************************************
+  /// The result of etl::from_chars.
+  /// 'ptr' points to the first character that was not part of the value.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename TChar>
+  struct from_chars_result
+  {
+    const TChar*              ptr;
+    etl::to_arithmetic_status status;
+  };
+
+  //***************************************************************************
+  /// The result of etl::to_arithmetic.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T>
+  class to_arithmetic_result
+  {
+  public:
+
+    //*************************************************************************
+    /// Constructor.
+    //*************************************************************************
+    to_arithmetic_result(const T value__, const etl::to_arithmetic_status status_)
+      : value_(value__)
+      , status(status_)
+    {
+    }
+
+    //*************************************************************************
+    /// true if the conversion succeeded.
+    //*************************************************************************
+    bool has_value() const
+    {
+      return status == etl::to_arithmetic_status::Valid;
+    }
+
+#if ETL_CPP11_SUPPORTED
+    //*************************************************************************
+    /// true if the conversion succeeded.
+    //*************************************************************************
+    explicit operator bool() const
+    {
+      return has_value();
+    }
+#endif
+
+    //*************************************************************************
+    /// The value, or T(0) if the conversion failed.
+    //*************************************************************************
+    T value() const
+    {
+      return value_;
+    }
+
+    //*************************************************************************
+    /// The status of the conversion.
+    //*************************************************************************
+    etl::to_arithmetic_status error() const
+    {
+      return status;
+    }
+
+  private:
+
+    T                         value_;
+    etl::to_arithmetic_status status;
+  };
+
+  namespace private_to_arithmetic
+  {
+    //*************************************************************************
+    /// The value of a digit in bases up to 36, or 0xFF.
+    //*************************************************************************
+    template <typename TChar>
+    uint32_t digit_value(const TChar c)
+    {
+      if ((c >= TChar('0')) && (c <= TChar('9')))
+      {
+        return uint32_t(c - TChar('0'));
+      }
+      else if ((c >= TChar('a')) && (c <= TChar('z')))
+      {
+        return uint32_t(c - TChar('a')) + 10U;
+      }
+      else if ((c >= TChar('A')) && (c <= TChar('Z')))
+      {
+        return uint32_t(c - TChar('A')) + 10U;
+      }
+      else
+      {
+        return 0xFFU;
+      }
+    }
+
+    //*************************************************************************
+    /// true if 'c' is a decimal digit.
+    //*************************************************************************
+    template <typename TChar>
+    bool is_digit(const TChar c)
+    {
+      return (c >= TChar('0')) && (c <= TChar('9'));
+    }
+
+    //*************************************************************************
+    /// Loads eight characters, the first in the low byte.
+    /// Compilers make this a single load on little endian targets.
+    //*************************************************************************
+    inline uint64_t load_eight(const char* p)
+    {
+      uint64_t value = 0U;
+
+      for (size_t i = 0U; i < 8U; ++i)
+      {
+        value |= uint64_t(static_cast<unsigned char>(p[i])) << (i * 8U);
+      }
+
+      return value;
+    }
+
+    //*************************************************************************
+    /// true if all eight characters are decimal digits.
+    //*************************************************************************
+    inline bool is_eight_digits(const uint64_t chunk)
+    {
+      return (((chunk & 0xF0F0F0F0F0F0F0F0ULL) | (((chunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+    }
+
+    //*************************************************************************
+    /// The value of eight decimal digits, combined in pairs, then fours, then eights.
+    //*************************************************************************
+    inline uint32_t parse_eight_digits(uint64_t chunk)
+    {
+      chunk = ((chunk & 0x0F0F0F0F0F0F0F0FULL) * 2561U) >> 8;
+      chunk = ((chunk & 0x00FF00FF00FF00FFULL) * 6553601U) >> 16;
+
+      return uint32_t(((chunk & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32);
+    }
+
+    //*************************************************************************
+    /// Adds decimal digits to 'value', eight at a time for byte sized characters.
+    /// Sets 'overflow' if the value would pass 'limit', and skips the rest.
+    /// \return A pointer to the first character that is not a digit.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* add_decimal_digits(const TChar* p, const TChar* last, uint64_t& value, const uint64_t limit, bool& overflow)
+    {
+      if (sizeof(TChar) == 1U)
+      {
+        while ((last - p) >= 8)
+        {
+          const uint64_t chunk = load_eight(reinterpret_cast<const char*>(p));
+
+          if (!is_eight_digits(chunk))
+          {
+            break;
+          }
+
+          const uint32_t eight = parse_eight_digits(chunk);
+
+          if (overflow || (eight > limit) || (value > ((limit - eight) / 100000000U)))
+          {
+            overflow = true;
+          }
+          else
+          {
+            value = (value * 100000000U) + eight;
+          }
+
+          p += 8;
+        }
+      }
+
+      while ((p != last) && is_digit(*p))
+      {
+        const uint32_t digit = uint32_t(*p - TChar('0'));
+
+        if (overflow || (value > ((limit - digit) / 10U)))
+        {
+          overflow = true;
+        }
+        else
+        {
+          value = (value * 10U) + digit;
+        }
+
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Adds digits in any other base to 'value'.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* add_digits(const TChar* p, const TChar* last, const uint32_t base, uint64_t& value, const uint64_t limit, bool& overflow)
+    {
+      uint32_t digit;
+
+      while ((p != last) && ((digit = digit_value(*p)) < base))
+      {
+        if (overflow || (value > ((limit - digit) / base)))
+        {
+          overflow = true;
+        }
+        else
+        {
+          value = (value * base) + digit;
+        }
+
+        ++p;
+      }
+
+      return p;
+    }
+
+    //*************************************************************************
+    /// Parses an integral value.
+    /// An optional '-' for signed types, then digits in the base.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::from_chars_result<TChar> from_chars_integral(const TChar* first, const TChar* last, T& value, const uint32_t base)
+    {
+      etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Valid };
+
+      if ((base < 2U) || (base > 36U))
+      {
+        result.status = etl::to_arithmetic_status::Invalid_Radix;
+        return result;
+      }
+
+      const TChar* p        = first;
+      const bool   negative = (p != last) && (*p == TChar('-'));
+
+      if (negative)
+      {
+        if (!etl::is_signed<T>::value)
+        {
+          result.status = etl::to_arithmetic_status::Signed_To_Unsigned;
+          return result;
+        }
+
+        ++p;
+      }
+
+      // The magnitude of the most negative value is one more than the maximum.
+      const uint64_t limit = uint64_t(etl::integral_limits<T>::max) + (negative ? 1U : 0U);
+
+      const TChar* digits   = p;
+      uint64_t     unsigned_value = 0U;
+      bool         overflow = false;
+
+      if (base == 10U)
+      {
+        p = add_decimal_digits(p, last, unsigned_value, limit, overflow);
+      }
+      else
+      {
+        p = add_digits(p, last, base, unsigned_value, limit, overflow);
+      }
+
+      if (p == digits)
+      {
+        result.status = etl::to_arithmetic_status::Invalid_Format;
+        return result;
+      }
+
+      result.ptr = p;
+
+      if (overflow)
+      {
+        result.status = etl::to_arithmetic_status::Overflow;
+      }
+      else
+      {
+        value = negative ? T(0U - unsigned_value) : T(unsigned_value);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Case insensitive match of 'text' at 'p'.
+    //*************************************************************************
+    template <typename TChar>
+    bool match(const TChar* p, const TChar* last, const char* text)
+    {
+      while (*text != 0)
+      {
+        if ((p == last) || ((*p != TChar(*text)) && (*p != TChar(*text - ('a' - 'A')))))
+        {
+          return false;
+        }
+
+        ++p;
+        ++text;
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    /// Parses the exponent after 'e' or 'E'. Saturates at +/-100000.
+    /// \return A pointer after the exponent, or 'p' if there is none.
+    //*************************************************************************
+    template <typename TChar>
+    const TChar* parse_exponent(const TChar* p, const TChar* last, int32_t& exponent)
+    {
+      const TChar* q = p + 1;
+
+      const bool negative = (q != last) && (*q == TChar('-'));
+
+      if ((q != last) && ((*q == TChar('-')) || (*q == TChar('+'))))
+      {
+        ++q;
+      }
+
+      if ((q == last) || !is_digit(*q))
+      {
+        return p;
+      }
+
+      int32_t value = 0;
+
+      while ((q != last) && is_digit(*q))
+      {
+        if (value < 100000)
+        {
+          value = (value * 10) + int32_t(*q - TChar('0'));
+        }
+
+        ++q;
+      }
+
+      exponent = negative ? -value : value;
+
+      return q;
+    }
+
+    //*************************************************************************
+    /// Parses a floating point value.
+    /// An optional '-', then digits with an optional '.', then an optional
+    /// exponent. Or 'inf', 'infinity' or 'nan', in any case.
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::from_chars_result<TChar> from_chars_floating_point(const TChar* first, const TChar* last, T& value)
+    {
+      typedef typename etl::conditional<etl::is_same<T, float>::value, float, double>::type binary_t;
+
+      etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Valid };
+
+      const TChar* p        = first;
+      const bool   negative = (p != last) && (*p == TChar('-'));
+
+      if (negative)
+      {
+        ++p;
+      }
+
+      if (match(p, last, "inf"))
+      {
+        p += match(p, last, "infinity") ? 8 : 3;
+        value      = negative ? -ETLSTD::numeric_limits<T>::infinity() : ETLSTD::numeric_limits<T>::infinity();
+        result.ptr = p;
+        return result;
+      }
+
+      if (match(p, last, "nan"))
+      {
+        value      = ETLSTD::numeric_limits<T>::quiet_NaN();
+        result.ptr = p + 3;
+        return result;
+      }
+
+      etl::private_eisel_lemire::decimal<TChar> d;
+      d.exponent          = 0;
+      d.mantissa          = 0U;
+      d.mantissa_exponent = 0;
+      d.truncated         = false;
+
+      // Up to 19 significant digits fit in the mantissa.
+      int32_t significant = 0;
+
+      d.integral_first = p;
+
+      while ((p != last) && is_digit(*p))
+      {
+        const uint32_t digit = uint32_t(*p - TChar('0'));
+
+        if ((d.mantissa != 0U) || (digit != 0U))
+        {
+          if (significant < 19)
+          {
+            d.mantissa = (d.mantissa * 10U) + digit;
+            ++significant;
+          }
+          else
+          {
+            ++d.mantissa_exponent;
+            d.truncated = d.truncated || (digit != 0U);
+          }
+        }
+
+        ++p;
+      }
+
+      d.integral_last  = p;
+      d.fraction_first = p;
+      d.fraction_last  = p;
+
+      if ((p != last) && (*p == TChar('.')))
+      {
+        ++p;
+        d.fraction_first = p;
+
+        while ((p != last) && is_digit(*p))
+        {
+          const uint32_t digit = uint32_t(*p - TChar('0'));
+
+          if ((d.mantissa == 0U) && (digit == 0U))
+          {
+            --d.mantissa_exponent;
+          }
+          else if (significant < 19)
+          {
+            d.mantissa = (d.mantissa * 10U) + digit;
+            ++significant;
+            --d.mantissa_exponent;
+          }
+          else
+          {
+            d.truncated = d.truncated || (digit != 0U);
+          }
+
+          ++p;
+        }
+
+        d.fraction_last = p;
+      }
+
+      if ((d.integral_first == d.integral_last) && (d.fraction_first == d.fraction_last))
+      {
+        result.status = etl::to_arithmetic_status::Invalid_Format;
+        return result;
+      }
+
+      if ((p != last) && ((*p == TChar('e')) || (*p == TChar('E'))))
+      {
+        p = parse_exponent(p, last, d.exponent);
+        d.mantissa_exponent += d.exponent;
+      }
+
+      result.ptr = p;
+
+      const binary_t magnitude = etl::private_eisel_lemire::to_binary<binary_t>(d);
+
+      if (magnitude == etl::private_eisel_lemire::infinity<binary_t>())
+      {
+        result.status = etl::to_arithmetic_status::Overflow;
+      }
+      else
+      {
+        value = negative ? -T(magnitude) : T(magnitude);
+      }
+
+      return result;
+    }
+
+    //*************************************************************************
+    /// Removes the fill that etl::to_string adds for the format.
+    //*************************************************************************
+    template <typename TChar, typename TString>
+    void remove_fill(const TChar*& first, const TChar*& last, const etl::basic_format_spec<TString>& format)
+    {
+      const TChar fill = format.get_fill();
+
+      if (format.is_left())
+      {
+        while (((last - first) > 1) && (*(last - 1) == fill))
+        {
+          --last;
+        }
+      }
+      else
+      {
+        while (((last - first) > 1) && (*first == fill))
+        {
+          ++first;
+        }
+      }
+    }
+  }
+
+  //***************************************************************************
+  /// Parses an integral value from [first, last), in the base.
+  /// Accepts an optional '-' for signed types, followed by digits.
+  /// On success 'value' is set. Otherwise it is unchanged.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_integral<T>::value && !etl::is_same<T, bool>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value, const uint32_t base = 10U)
+  {
+    return etl::private_to_arithmetic::from_chars_integral(first, last, value, base);
+  }
+
+  //***************************************************************************
+  /// Parses a floating point value from [first, last).
+  /// Accepts fixed and exponent notation, 'inf' and 'nan'.
+  /// The result is correctly rounded. long double is parsed as double.
+  /// On success 'value' is set. Otherwise it is unchanged.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T, typename TChar>
+  typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+    from_chars(const TChar* first, const TChar* last, T& value)
+  {
+    return etl::private_to_arithmetic::from_chars_floating_point(first, last, value);
+  }
+
+  namespace private_to_arithmetic
+  {
+    //*************************************************************************
+    template <typename T, typename TChar>
+    typename etl::enable_if<etl::is_integral<T>::value, etl::from_chars_result<TChar> >::type
+      from_chars_any(const TChar* first, const TChar* last, T& value, const uint32_t base)
+    {
+      return etl::from_chars(first, last, value, base);
+    }
+
+    //*************************************************************************
+    template <typename T, typename TChar>
+    typename etl::enable_if<etl::is_floating_point<T>::value, etl::from_chars_result<TChar> >::type
+      from_chars_any(const TChar* first, const TChar* last, T& value, const uint32_t base)
+    {
+      if (base != 10U)
+      {
+        etl::from_chars_result<TChar> result = { first, etl::to_arithmetic_status::Invalid_Radix };
+        return result;
+      }
+
+      return etl::from_chars(first, last, value);
+    }
+
+    //*************************************************************************
+    template <typename T, typename TChar>
+    etl::to_arithmetic_result<T> to_arithmetic(const TChar* first, const TChar* last, const uint32_t base)
+    {
+      T value = T(0);
+
+      etl::from_chars_result<TChar> result = etl::private_to_arithmetic::from_chars_any(first, last, value, base);
+
+      if ((result.status == etl::to_arithmetic_status::Valid) && (result.ptr != last))
+      {
+        result.status = etl::to_arithmetic_status::Invalid_Format;
+      }
+
+      return etl::to_arithmetic_result<T>((result.status == etl::to_arithmetic_status::Valid) ? value : T(0), result.status);
+    }
+  }
+
+  //***************************************************************************
+  /// Converts all of [first, last) to an arithmetic value.
+  /// Floating point values must be base 10.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T, typename TChar>
+  etl::to_arithmetic_result<T> to_arithmetic(const TChar* first, const TChar* last, const uint32_t base = 10U)
+  {
+    return etl::private_to_arithmetic::to_arithmetic<T>(first, last, base);
+  }
+
+  //***************************************************************************
+  /// Converts all of a string view to an arithmetic value.
+  /// Floating point values must be base 10.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits>
+  etl::to_arithmetic_result<T> to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, const uint32_t base = 10U)
+  {
+    return etl::private_to_arithmetic::to_arithmetic<T>(view.begin(), view.end(), base);
+  }
+
+  //***************************************************************************
+  /// Converts a string view, written by etl::to_string with the format, to an
+  /// arithmetic value. The base is taken from the format, and the fill that
+  /// the width and alignment added is removed.
+  ///\ingroup to_arithmetic
+  //***************************************************************************
+  template <typename T, typename TChar, typename TTraits, typename TString>
+  etl::to_arithmetic_result<T> to_arithmetic(const etl::basic_string_view<TChar, TTraits>& view, const etl::basic_format_spec<TString>& format)
+  {
+    const TChar* first = view.begin();
+    const TChar* last  = view.end();
+
+    etl::private_to_arithmetic::remove_fill(first, last, format);
+
+    return etl::private_to_arithmetic::to_arithmetic<T>(first, last, format.get_base());
+  }
+}
+
+#endif
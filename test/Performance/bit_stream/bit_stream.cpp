@@ -0,0 +1,205 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Packing and unpacking times per field.
+// Build with -DETL_BIT_STREAM_NO_SIMD to time the scalar range get.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. bit_stream.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/bit_stream.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t FIELDS = 1000000;
+
+  std::vector<uint64_t>      values(FIELDS);
+  std::vector<uint64_t>      results(FIELDS);
+  std::vector<unsigned char> buffer((FIELDS * 10) + 8);
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function)
+  {
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    function();
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / FIELDS;
+  }
+
+  //***************************************************************************
+  void fields(uint_least8_t width)
+  {
+    const uint64_t mask = (width == 64U) ? ~uint64_t(0U) : ((uint64_t(1U) << width) - 1U);
+
+    std::mt19937_64 generator(width);
+
+    for (size_t i = 0; i < FIELDS; ++i)
+    {
+      values[i] = generator() & mask;
+    }
+
+    etl::bit_stream stream(buffer.data(), buffer.size());
+
+    double put_ns = time_ns([&]
+    {
+      stream.restart();
+
+      for (size_t i = 0; i < FIELDS; ++i)
+      {
+        stream.put(values[i], width);
+      }
+    });
+
+    double get_ns = time_ns([&]
+    {
+      stream.restart();
+
+      for (size_t i = 0; i < FIELDS; ++i)
+      {
+        stream.get(results[i], width);
+      }
+    });
+
+    bool ok = (values == results);
+
+    double put_range_ns = time_ns([&]
+    {
+      stream.restart();
+      stream.put(values.begin(), values.end(), width);
+    });
+
+    double get_range_ns = time_ns([&]
+    {
+      stream.restart();
+      stream.get(results.begin(), results.end(), width);
+    });
+
+    ok = ok && (values == results);
+
+    std::cout << int(width) << " bit fields: put " << put_ns << "ns, get " << get_ns << "ns, "
+              << "range put " << put_range_ns << "ns, range get " << get_range_ns << "ns" << (ok ? "" : " FAILED") << "\n";
+  }
+
+  //***************************************************************************
+  // Range get of narrow fields into chars, where the unpack dominates.
+  //***************************************************************************
+  void char_fields(uint_least8_t width)
+  {
+    std::mt19937 generator(width);
+
+    for (size_t i = 0; i < buffer.size(); ++i)
+    {
+      buffer[i] = static_cast<unsigned char>(generator());
+    }
+
+    std::vector<uint8_t> char_results(FIELDS);
+
+    etl::bit_stream stream(buffer.data(), buffer.size());
+
+    double get_range_ns = time_ns([&]
+    {
+      stream.restart();
+      stream.get(char_results.begin(), char_results.end(), width);
+    });
+
+    std::cout << int(width) << " bit fields to chars: range get " << get_range_ns << "ns\n";
+  }
+
+  //***************************************************************************
+  void varints()
+  {
+    std::mt19937_64 generator(1);
+
+    std::vector<int64_t> signed_values(FIELDS);
+    std::vector<int64_t> signed_results(FIELDS);
+
+    // Mostly small, as telemetry deltas are.
+    for (size_t i = 0; i < FIELDS; ++i)
+    {
+      signed_values[i] = int64_t(generator()) >> (40 + (generator() % 24));
+    }
+
+    etl::bit_stream stream(buffer.data(), buffer.size());
+
+    double put_ns = time_ns([&]
+    {
+      stream.restart();
+
+      for (size_t i = 0; i < FIELDS; ++i)
+      {
+        stream.put_varint(signed_values[i]);
+      }
+    });
+
+    size_t bytes = stream.size();
+
+    double get_ns = time_ns([&]
+    {
+      stream.restart();
+
+      for (size_t i = 0; i < FIELDS; ++i)
+      {
+        stream.get_varint(signed_results[i]);
+      }
+    });
+
+    bool ok = (signed_values == signed_results);
+
+    std::cout << "zig-zag varints: put " << put_ns << "ns, get " << get_ns << "ns, " << double(bytes) / FIELDS << " bytes each" << (ok ? "" : " FAILED") << "\n";
+  }
+}
+
+int main()
+{
+  fields(1);
+  fields(2);
+  fields(3);
+  fields(4);
+  fields(8);
+  fields(16);
+  fields(12);
+  fields(33);
+  fields(64);
+  char_fields(1);
+  char_fields(2);
+  char_fields(4);
+  char_fields(8);
+  varints();
+
+  return 0;
+}
@@ -0,0 +1,123 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// etl::bitset operations for sizes from 64 to 1M bits, with std::bitset for
+// comparison where it has an equivalent.
+// Add -DETL_BITSET_ELEMENT_TYPE=uint64_t to compare word elements with the default byte elements.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. bitset.cpp
+
+#include <bitset>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "etl/bitset.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  volatile size_t sink;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function, size_t rounds)
+  {
+    clock_t::time_point start = clock_t::now();
+
+    for (size_t i = 0; i < rounds; ++i)
+    {
+      function();
+    }
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / rounds;
+  }
+
+  //***************************************************************************
+  template <const size_t N>
+  void run()
+  {
+    static etl::bitset<N> etl_a;
+    static etl::bitset<N> etl_b;
+    static std::bitset<N> std_a;
+    static std::bitset<N> std_b;
+
+    std::mt19937 generator(N);
+
+    // An allocation map that is nearly full, with a free bit and a free run of 8 near the end.
+    etl_a.set();
+    std_a.set();
+    etl_a.reset(N - 20);
+    std_a.reset(N - 20);
+
+    for (size_t i = N - 10; i < N - 2; ++i)
+    {
+      etl_a.reset(i);
+      std_a.reset(i);
+    }
+
+    for (size_t i = 0; i < N; ++i)
+    {
+      bool state = (generator() & 1) != 0;
+      etl_b.set(i, state);
+      std_b.set(i, state);
+    }
+
+    const size_t rounds = (64 * 1024 * 1024) / N;
+
+    double find_first = time_ns([&] { sink = etl_a.find_first(false); }, rounds);
+    double find_run   = time_ns([&] { sink = etl_a.find_next_run(false, 8); }, rounds);
+    double etl_count  = time_ns([&] { sink = etl_b.count(); }, rounds);
+    double std_count  = time_ns([&] { sink = std_b.count(); }, rounds);
+    double etl_and    = time_ns([&] { etl_a &= etl_b; etl_a |= etl_b; sink = etl_a.test(0); }, rounds);
+    double std_and    = time_ns([&] { std_a &= std_b; std_a |= std_b; sink = std_a.test(0); }, rounds);
+    double etl_shift  = time_ns([&] { etl_b <<= 3; etl_b >>= 3; sink = etl_b.test(0); }, rounds);
+    double std_shift  = time_ns([&] { std_b <<= 3; std_b >>= 3; sink = std_b.test(0); }, rounds);
+
+    std::cout << "bits=" << N
+              << " find_first(false)=" << find_first << "ns"
+              << " find_next_run(false,8)=" << find_run << "ns"
+              << " count etl=" << etl_count << "ns std=" << std_count << "ns"
+              << " &=,|= etl=" << etl_and << "ns std=" << std_and << "ns"
+              << " <<=,>>= etl=" << etl_shift << "ns std=" << std_shift << "ns\n";
+  }
+}
+
+int main()
+{
+  run<64>();
+  run<1024>();
+  run<16 * 1024>();
+  run<64 * 1024>();
+  run<1024 * 1024>();
+
+  return 0;
+}
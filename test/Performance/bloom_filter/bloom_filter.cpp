@@ -0,0 +1,125 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// etl::blocked_bloom_filter against etl::bloom_filter, used as a negative cache
+// for a large key set. The filters are much larger than the cache, so lookup
+// time is dominated by cache misses.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. bloom_filter.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/bloom_filter.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t KEYS = 4 * 1024 * 1024;
+  const size_t BITS = KEYS * 10;
+
+  //***************************************************************************
+  // Three independent hashes for the classic filter, one for the blocked filter.
+  template <const uint64_t MULTIPLIER>
+  struct hash_t
+  {
+    typedef uint64_t argument_type;
+
+    size_t operator ()(uint64_t key) const
+    {
+      key *= MULTIPLIER;
+      key ^= key >> 29;
+      key *= MULTIPLIER;
+      return size_t(key ^ (key >> 32));
+    }
+  };
+
+  typedef hash_t<0x9E3779B97F4A7C15ULL> hash1_t;
+  typedef hash_t<0xC2B2AE3D27D4EB4FULL> hash2_t;
+  typedef hash_t<0x165667B19E3779F9ULL> hash3_t;
+
+  etl::bloom_filter<BITS, hash1_t, hash2_t, hash3_t> classic;
+  etl::blocked_bloom_filter<BITS, 7, hash1_t>        blocked;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function, size_t count)
+  {
+    clock_t::time_point start = clock_t::now();
+
+    function();
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / count;
+  }
+}
+
+int main()
+{
+  std::mt19937_64 generator(1);
+
+  std::vector<uint64_t> present(KEYS);
+  std::vector<uint64_t> absent(KEYS);
+
+  // Present keys are even, absent keys are odd.
+  for (size_t i = 0; i < KEYS; ++i)
+  {
+    present[i] = generator() & ~uint64_t(1U);
+    absent[i]  = generator() | 1U;
+  }
+
+  size_t hits = 0;
+  std::vector<char> results(KEYS);
+
+  double classic_add  = time_ns([&] { for (uint64_t key : present) classic.add(key); }, KEYS);
+  double blocked_add  = time_ns([&] { for (uint64_t key : present) blocked.add(key); }, KEYS);
+
+  size_t classic_fp = 0;
+  size_t blocked_fp = 0;
+
+  double classic_miss = time_ns([&] { for (uint64_t key : absent) classic_fp += classic.exists(key); }, KEYS);
+  double blocked_miss = time_ns([&] { for (uint64_t key : absent) blocked_fp += blocked.exists(key); }, KEYS);
+  double blocked_hit  = time_ns([&] { for (uint64_t key : present) hits += blocked.exists(key); }, KEYS);
+  double blocked_batch = time_ns([&] { blocked.exists(absent.begin(), absent.end(), results.begin()); }, KEYS);
+
+  std::cout << "keys=" << KEYS << " bits=" << BITS << "\n"
+            << "bloom_filter (3 hashes)  add=" << classic_add << "ns miss=" << classic_miss << "ns"
+            << " false positives=" << (100.0 * classic_fp) / KEYS << "%\n"
+            << "blocked_bloom_filter (7) add=" << blocked_add << "ns miss=" << blocked_miss << "ns"
+            << " hit=" << blocked_hit << "ns batch miss=" << blocked_batch << "ns"
+            << " false positives=" << (100.0 * blocked_fp) / KEYS << "%"
+            << " estimated=" << 100.0 * blocked.false_positive_rate() << "%"
+            << " fill=" << blocked.fill_ratio() << "\n"
+            << (hits == KEYS ? "" : "false negatives!\n");
+
+  return 0;
+}
@@ -0,0 +1,157 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Allocation and release contention for etl::pool guarded by a mutex,
+// etl::concurrent_pool with no thread caches, and etl::concurrent_pool with
+// thread caches, for 1 to 16 threads. Each thread repeatedly allocates a
+// burst of items and then releases them.
+//
+// g++ -O2 -std=c++11 -pthread -I../../../include -I../.. concurrent_pool.cpp
+
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "etl/pool.h"
+#include "etl/concurrent_pool.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  struct Item
+  {
+    char data[48];
+  };
+
+  const size_t MAX_THREADS = 16;
+  const size_t BURST       = 8;
+  const size_t ROUNDS      = 200000;
+  const size_t SIZE        = MAX_THREADS * BURST * 4;
+
+  etl::pool<Item, SIZE>                   locked_pool;
+  std::mutex                              locked_pool_mutex;
+  etl::concurrent_pool<Item, SIZE>        shared_pool;
+  etl::concurrent_pool<Item, SIZE, 32, 16> cached_pool;
+
+  //***************************************************************************
+  struct locked_policy
+  {
+    static Item* allocate()
+    {
+      std::lock_guard<std::mutex> lock(locked_pool_mutex);
+      return locked_pool.allocate<Item>();
+    }
+
+    static void release(Item* p)
+    {
+      std::lock_guard<std::mutex> lock(locked_pool_mutex);
+      locked_pool.release(p);
+    }
+  };
+
+  //***************************************************************************
+  template <typename TPool, TPool& pool>
+  struct concurrent_policy
+  {
+    static Item* allocate()
+    {
+      return pool.template allocate<Item>();
+    }
+
+    static void release(Item* p)
+    {
+      pool.release(p);
+    }
+  };
+
+  //***************************************************************************
+  template <typename TPolicy>
+  void worker()
+  {
+    Item* items[BURST];
+
+    for (size_t round = 0; round < ROUNDS; ++round)
+    {
+      for (size_t i = 0; i < BURST; ++i)
+      {
+        items[i] = TPolicy::allocate();
+        items[i]->data[0] = char(i);
+      }
+
+      for (size_t i = 0; i < BURST; ++i)
+      {
+        TPolicy::release(items[i]);
+      }
+    }
+  }
+
+  //***************************************************************************
+  // Returns the time per allocate and release pair, per thread.
+  template <typename TPolicy>
+  double run(size_t n_threads)
+  {
+    std::vector<std::thread> threads;
+
+    clock_t::time_point start = clock_t::now();
+
+    for (size_t i = 0; i < n_threads; ++i)
+    {
+      threads.push_back(std::thread(worker<TPolicy>));
+    }
+
+    for (size_t i = 0; i < n_threads; ++i)
+    {
+      threads[i].join();
+    }
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (ROUNDS * BURST * n_threads);
+  }
+}
+
+int main()
+{
+  typedef concurrent_policy<etl::concurrent_pool<Item, SIZE>, shared_pool>         shared_policy;
+  typedef concurrent_policy<etl::concurrent_pool<Item, SIZE, 32, 16>, cached_pool> cached_policy;
+
+  std::cout << "hardware threads=" << std::thread::hardware_concurrency() << "\n";
+
+  for (size_t n = 1; n <= MAX_THREADS; n *= 2)
+  {
+    std::cout << "threads=" << n
+              << " pool+mutex=" << run<locked_policy>(n) << "ns"
+              << " concurrent_pool=" << run<shared_policy>(n) << "ns"
+              << " concurrent_pool+caches=" << run<cached_policy>(n) << "ns\n";
+  }
+
+  return 0;
+}
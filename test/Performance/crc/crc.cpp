@@ -0,0 +1,120 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// CRC throughput.
+// Compares adding a 64K frame one byte at a time with adding it as a
+// contiguous block.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. crc.cpp
+// Add -msse4.2 -mpclmul to enable the hardware paths on x86.
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/crc8_ccitt.h"
+#include "etl/crc16.h"
+#include "etl/crc16_ccitt.h"
+#include "etl/crc16_kermit.h"
+#include "etl/crc16_modbus.h"
+#include "etl/crc32.h"
+#include "etl/crc32_c.h"
+#include "etl/crc64_ecma.h"
+
+namespace
+{
+  const size_t FRAME_SIZE = 65536;
+  const size_t ITERATIONS = 2000;
+
+  std::vector<uint8_t> frame(FRAME_SIZE);
+
+  //***************************************************************************
+  template <typename TCrc>
+  void run(const char* name)
+  {
+    typedef std::chrono::high_resolution_clock clock;
+
+    typename TCrc::value_type bytes_result = 0;
+    typename TCrc::value_type block_result = 0;
+
+    clock::time_point start = clock::now();
+
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+      TCrc crc;
+
+      for (size_t j = 0; j < frame.size(); ++j)
+      {
+        crc.add(frame[j]);
+      }
+
+      bytes_result ^= crc.value();
+    }
+
+    double bytes_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    start = clock::now();
+
+    for (size_t i = 0; i < ITERATIONS; ++i)
+    {
+      TCrc crc(frame.data(), frame.data() + frame.size());
+
+      block_result ^= crc.value();
+    }
+
+    double block_seconds = std::chrono::duration<double>(clock::now() - start).count();
+
+    double megabytes = double(FRAME_SIZE * ITERATIONS) / (1024.0 * 1024.0);
+
+    std::cout << name << "\t"
+              << "byte: "  << (megabytes / bytes_seconds) << " MB/s\t"
+              << "block: " << (megabytes / block_seconds) << " MB/s\t"
+              << ((bytes_result == block_result) ? "" : "MISMATCH") << "\n";
+  }
+}
+
+//*****************************************************************************
+int main()
+{
+  for (size_t i = 0; i < frame.size(); ++i)
+  {
+    frame[i] = uint8_t((i * 167) ^ (i >> 3));
+  }
+
+  run<etl::crc8_ccitt>("crc8_ccitt  ");
+  run<etl::crc16>("crc16       ");
+  run<etl::crc16_ccitt>("crc16_ccitt ");
+  run<etl::crc16_kermit>("crc16_kermit");
+  run<etl::crc16_modbus>("crc16_modbus");
+  run<etl::crc32>("crc32       ");
+  run<etl::crc32_c>("crc32_c     ");
+  run<etl::crc64_ecma>("crc64_ecma  ");
+
+  return 0;
+}
@@ -0,0 +1,119 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// flat_map::find against eytzinger_flat_map::find, for random keys that are
+// in the map, from 1K to 256K elements.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. eytzinger_flat_map.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/eytzinger_flat_map.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t MAX_SIZE = 262144;
+
+  typedef etl::flat_map<int, int, MAX_SIZE>           Map;
+  typedef etl::eytzinger_flat_map<int, int, MAX_SIZE> Index;
+
+  Map   map;
+  Index eytzinger;
+
+  //***************************************************************************
+  template <typename TContainer>
+  double time_ns(const TContainer& container, const std::vector<int>& keys, long long& sum)
+  {
+    clock_t::time_point start = clock_t::now();
+
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+      sum += container.find(keys[i])->second;
+    }
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / keys.size();
+  }
+
+  //***************************************************************************
+  // Calls the index through the same interface as the map.
+  struct index_finder
+  {
+    const Index::value_type* find(int key) const
+    {
+      return eytzinger.find(key);
+    }
+  };
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+  long long sum = 0;
+
+  for (size_t size = 1024; size <= MAX_SIZE; size *= 4)
+  {
+    std::vector<int> keys;
+
+    map.clear();
+
+    while (map.size() < size)
+    {
+      int key = int(generator());
+
+      if (map.insert(Map::value_type(key, int(map.size()))).second)
+      {
+        keys.push_back(key);
+      }
+    }
+
+    eytzinger.assign(map);
+
+    std::vector<int> lookups(2000000);
+
+    for (size_t i = 0; i < lookups.size(); ++i)
+    {
+      lookups[i] = keys[generator() % keys.size()];
+    }
+
+    double map_find   = time_ns(map, lookups, sum);
+    double index_find = time_ns(index_finder(), lookups, sum);
+
+    std::cout << "size=" << size
+              << " find flat_map=" << map_find << "ns eytzinger_flat_map=" << index_find << "ns\n";
+  }
+
+  return (sum == 0) ? 1 : 0;
+}
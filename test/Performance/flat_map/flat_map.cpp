@@ -0,0 +1,121 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// etl::flat_map loaded by inserting one element at a time, against a range
+// insert, into an empty map and into a map already half full.
+// At the largest size there is no free space for a merge buffer.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. flat_map.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <utility>
+#include <vector>
+
+#include "etl/flat_map.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t MAX_SIZE = 32000;
+
+  typedef etl::flat_map<int, int, MAX_SIZE> Map;
+  typedef std::vector<std::pair<int, int> > Source;
+
+  Map map;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ms(const Source& initial, const Source& source, TFunction function, int rounds)
+  {
+    double total = 0.0;
+
+    for (int i = 0; i < rounds; ++i)
+    {
+      map.assign(initial.begin(), initial.end());
+
+      clock_t::time_point start = clock_t::now();
+      function(source);
+      clock_t::time_point stop = clock_t::now();
+
+      total += std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    return total / rounds;
+  }
+
+  //***************************************************************************
+  void insert_each(const Source& source)
+  {
+    for (size_t i = 0; i < source.size(); ++i)
+    {
+      map.insert(source[i]);
+    }
+  }
+
+  //***************************************************************************
+  void insert_range(const Source& source)
+  {
+    map.insert(source.begin(), source.end());
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  for (size_t size = 1000; size <= MAX_SIZE; size *= 2)
+  {
+    Source source(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      source[i] = std::make_pair(int(generator()), int(i));
+    }
+
+    const Source empty;
+    const Source half_source(source.begin(), source.begin() + (size / 2));
+    const Source half_initial(source.begin() + (size / 2), source.end());
+
+    const int rounds = int(200000 / size) + 1;
+
+    double each_empty  = time_ms(empty,        source,      insert_each,  rounds);
+    double range_empty = time_ms(empty,        source,      insert_range, rounds);
+    double each_half   = time_ms(half_initial, half_source, insert_each,  rounds);
+    double range_half  = time_ms(half_initial, half_source, insert_range, rounds);
+
+    std::cout << "size=" << size
+              << " empty each=" << each_empty << "ms range=" << range_empty << "ms"
+              << " half full each=" << each_half << "ms range=" << range_half << "ms\n";
+  }
+
+  return 0;
+}
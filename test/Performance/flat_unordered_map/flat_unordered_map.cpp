@@ -0,0 +1,141 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// etl::flat_unordered_map against etl::unordered_map, for insert, lookup
+// hits, lookup misses and erase, at a load of 80% of the maximum size.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. flat_unordered_map.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/unordered_map.h"
+#include "etl/flat_unordered_map.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t SIZE   = 100000;
+  const size_t ROUNDS = 20;
+
+  typedef etl::unordered_map<uint32_t, uint32_t, SIZE>      Node;
+  typedef etl::flat_unordered_map<uint32_t, uint32_t, SIZE> Flat;
+
+  Node node_map;
+  Flat flat_map;
+
+  volatile uint32_t sink;
+
+  //***************************************************************************
+  template <typename TMap>
+  void run(TMap& map, const char* name, const std::vector<uint32_t>& keys, const std::vector<uint32_t>& shuffled, const std::vector<uint32_t>& missing)
+  {
+    double insert = 0.0;
+    double hit    = 0.0;
+    double miss   = 0.0;
+    double erase  = 0.0;
+
+    for (size_t round = 0; round < ROUNDS; ++round)
+    {
+      clock_t::time_point t0 = clock_t::now();
+
+      for (size_t i = 0; i < keys.size(); ++i)
+      {
+        map.insert(std::make_pair(keys[i], uint32_t(i)));
+      }
+
+      clock_t::time_point t1 = clock_t::now();
+
+      uint32_t total = 0;
+
+      for (size_t i = 0; i < shuffled.size(); ++i)
+      {
+        total += map.find(shuffled[i])->second;
+      }
+
+      clock_t::time_point t2 = clock_t::now();
+
+      for (size_t i = 0; i < missing.size(); ++i)
+      {
+        total += uint32_t(map.count(missing[i]));
+      }
+
+      clock_t::time_point t3 = clock_t::now();
+
+      for (size_t i = 0; i < shuffled.size(); ++i)
+      {
+        map.erase(shuffled[i]);
+      }
+
+      clock_t::time_point t4 = clock_t::now();
+
+      sink = total;
+
+      insert += std::chrono::duration<double, std::nano>(t1 - t0).count();
+      hit    += std::chrono::duration<double, std::nano>(t2 - t1).count();
+      miss   += std::chrono::duration<double, std::nano>(t3 - t2).count();
+      erase  += std::chrono::duration<double, std::nano>(t4 - t3).count();
+    }
+
+    const double operations = double(ROUNDS * keys.size());
+
+    std::cout << name
+              << " insert=" << (insert / operations) << "ns"
+              << " hit="    << (hit    / operations) << "ns"
+              << " miss="   << (miss   / operations) << "ns"
+              << " erase="  << (erase  / operations) << "ns\n";
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  std::vector<uint32_t> keys;
+  std::vector<uint32_t> missing;
+
+  // Missing keys have the top bit set, so are never found.
+  for (size_t i = 0; i < (SIZE * 8) / 10; ++i)
+  {
+    keys.push_back(generator() & 0x7FFFFFFFUL);
+    missing.push_back(generator() | 0x80000000UL);
+  }
+
+  // Nodes are allocated in insertion order, so look up in a different order.
+  std::vector<uint32_t> shuffled(keys);
+  std::shuffle(shuffled.begin(), shuffled.end(), generator);
+
+  run(node_map, "etl::unordered_map     ", keys, shuffled, missing);
+  run(flat_map, "etl::flat_unordered_map", keys, shuffled, missing);
+
+  return 0;
+}
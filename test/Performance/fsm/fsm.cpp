@@ -0,0 +1,147 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Event dispatch time for an FSM state with 16 events.
+// The default build uses the variadic etl::fsm_state and its jump table.
+// Build with -DETL_FSM_FORCE_CPP03 to use the generated switch instead.
+// Build with -DETL_FSM_TRACE to include the cost of tracing every event.
+// The stock profile is used, because the unit test profile enables tracing.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../../../include/etl/profiles -DPROFILE_GCC_LINUX_X86 fsm.cpp
+// g++ -O2 -std=c++11 -I../../../include -I../../../include/etl/profiles -DPROFILE_GCC_LINUX_X86 -DETL_FSM_FORCE_CPP03 fsm.cpp
+// g++ -O2 -std=c++11 -I../../../include -I../../../include/etl/profiles -DPROFILE_GCC_LINUX_X86 -DETL_FSM_TRACE fsm.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/fsm.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t EVENTS  = 16;
+  const size_t LOOKUPS = 1000000;
+
+  //***************************************************************************
+  template <size_t ID_>
+  struct Event : public etl::message<ID_>
+  {
+  };
+
+  //***************************************************************************
+  class Fsm : public etl::fsm
+  {
+  public:
+
+    Fsm()
+      : fsm(0),
+        total(0)
+    {
+    }
+
+    size_t total;
+  };
+
+  //***************************************************************************
+  class State : public etl::fsm_state<Fsm, State, 0,
+                                      Event<0>,  Event<1>,  Event<2>,  Event<3>,
+                                      Event<4>,  Event<5>,  Event<6>,  Event<7>,
+                                      Event<8>,  Event<9>,  Event<10>, Event<11>,
+                                      Event<12>, Event<13>, Event<14>, Event<15> >
+  {
+  public:
+
+    template <size_t ID_>
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const Event<ID_>&)
+    {
+      get_fsm_context().total += ID_;
+      return STATE_ID;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      return STATE_ID;
+    }
+  };
+
+  //***************************************************************************
+  template <size_t ID_>
+  const etl::imessage* make_event()
+  {
+    static Event<ID_> event;
+    return &event;
+  }
+}
+
+int main()
+{
+  const etl::imessage* events[EVENTS] =
+  {
+    make_event<0>(),  make_event<1>(),  make_event<2>(),  make_event<3>(),
+    make_event<4>(),  make_event<5>(),  make_event<6>(),  make_event<7>(),
+    make_event<8>(),  make_event<9>(),  make_event<10>(), make_event<11>(),
+    make_event<12>(), make_event<13>(), make_event<14>(), make_event<15>()
+  };
+
+  std::mt19937 generator(1);
+  std::vector<const etl::imessage*> stream(LOOKUPS);
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    stream[i] = events[generator() % EVENTS];
+  }
+
+  State state;
+  etl::ifsm_state* states[] = { &state };
+
+  Fsm fsm;
+  fsm.set_states(states, 1);
+  fsm.start();
+
+#if defined(ETL_FSM_TRACE)
+  // Large enough that no records are dropped.
+  static etl::fsm_trace<LOOKUPS> trace;
+  fsm.set_trace(trace);
+#endif
+
+  bench_clock_t::time_point start = bench_clock_t::now();
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    fsm.receive(*stream[i]);
+  }
+
+  bench_clock_t::time_point stop = bench_clock_t::now();
+
+  std::cout << std::chrono::duration<double, std::nano>(stop - start).count() / LOOKUPS << "ns per event\n";
+
+  return (fsm.total != 0U) ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Hashing times per key length, FNV-1a against the word at a time hash that
+// ETL_HASH_USE_WYHASH selects.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. hash.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/hash.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t KEYS = 1024;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(size_t repeats, TFunction function)
+  {
+    uint64_t sum = 0;
+
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    for (size_t r = 0; r < repeats; ++r)
+    {
+      for (size_t i = 0; i < KEYS; ++i)
+      {
+        sum += function(i);
+      }
+    }
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    if (sum == 1)
+    {
+      std::cout << "";
+    }
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / (repeats * KEYS);
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  for (size_t length : { size_t(4), size_t(8), size_t(16), size_t(32), size_t(64), size_t(256), size_t(1024) })
+  {
+    std::vector<uint8_t> data(KEYS * length);
+
+    for (uint8_t& c : data)
+    {
+      c = uint8_t(generator());
+    }
+
+    const size_t repeats = 20000000 / (KEYS * (length + 16));
+
+    double fnv_ns = time_ns(repeats, [&](size_t i)
+    {
+      const uint8_t* key = data.data() + (i * length);
+      return uint64_t(etl::fnv_1a_64(key, key + length).value());
+    });
+
+    double wyhash_ns = time_ns(repeats, [&](size_t i)
+    {
+      const uint8_t* key = data.data() + (i * length);
+      return etl::private_wyhash::hash(key, key + length);
+    });
+
+    std::cout << length << " byte keys: fnv_1a_64 " << fnv_ns << "ns, wyhash " << wyhash_ns << "ns\n";
+  }
+
+  return 0;
+}
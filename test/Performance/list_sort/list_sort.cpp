@@ -0,0 +1,166 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Sorting random integers in etl::list, etl::forward_list and
+// etl::intrusive_list, against std::list and std::forward_list.
+// The lists are built from the same random sequence, so the nodes of the
+// pool based lists are scattered in memory as they would be after use.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. list_sort.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <forward_list>
+#include <iostream>
+#include <list>
+#include <random>
+#include <vector>
+
+#include "etl/list.h"
+#include "etl/forward_list.h"
+#include "etl/intrusive_list.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t MAX_SIZE = 1000000;
+
+  struct Item : public etl::bidirectional_link<0>
+  {
+    int value;
+
+    bool operator <(const Item& other) const
+    {
+      return value < other.value;
+    }
+  };
+
+  etl::list<int, MAX_SIZE>         etl_list;
+  etl::forward_list<int, MAX_SIZE> etl_forward_list;
+  etl::intrusive_list<Item>        etl_intrusive_list;
+  std::list<int>                   std_list;
+  std::forward_list<int>           std_forward_list;
+
+  std::vector<Item> items(MAX_SIZE);
+
+  //***************************************************************************
+  // Fills the lists in a shuffled node order, then in a random value order.
+  //***************************************************************************
+  void fill(const std::vector<int>& values, std::mt19937& generator)
+  {
+    etl_list.clear();
+    etl_forward_list.clear();
+    etl_intrusive_list.clear();
+    std_list.clear();
+    std_forward_list.clear();
+
+    etl_list.assign(values.begin(), values.end());
+    etl_list.sort();
+    etl_forward_list.assign(values.begin(), values.end());
+    etl_forward_list.sort();
+
+    std::vector<size_t> order(values.size());
+
+    for (size_t i = 0; i < order.size(); ++i)
+    {
+      order[i] = i;
+    }
+
+    std::shuffle(order.begin(), order.end(), generator);
+
+    etl::list<int, MAX_SIZE>::iterator         itr  = etl_list.begin();
+    etl::forward_list<int, MAX_SIZE>::iterator fitr = etl_forward_list.begin();
+
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+      *itr++  = values[i];
+      *fitr++ = values[i];
+      items[order[i]].value = values[i];
+      etl_intrusive_list.push_back(items[order[i]]);
+    }
+
+    std_list.assign(values.begin(), values.end());
+    std_forward_list.assign(values.begin(), values.end());
+  }
+
+  //***************************************************************************
+  template <typename TList>
+  double time_ms(TList& list)
+  {
+    clock_t::time_point start = clock_t::now();
+    list.sort();
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::milli>(stop - start).count();
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  for (size_t size = 1000; size <= MAX_SIZE; size *= 10)
+  {
+    std::vector<int> values(size);
+
+    double etl_list_ms           = 0.0;
+    double etl_forward_list_ms   = 0.0;
+    double etl_intrusive_list_ms = 0.0;
+    double std_list_ms           = 0.0;
+    double std_forward_list_ms   = 0.0;
+
+    const int rounds = int(1000000 / size) + 1;
+
+    for (int i = 0; i < rounds; ++i)
+    {
+      for (size_t j = 0; j < size; ++j)
+      {
+        values[j] = int(generator());
+      }
+
+      fill(values, generator);
+
+      etl_list_ms           += time_ms(etl_list);
+      etl_forward_list_ms   += time_ms(etl_forward_list);
+      etl_intrusive_list_ms += time_ms(etl_intrusive_list);
+      std_list_ms           += time_ms(std_list);
+      std_forward_list_ms   += time_ms(std_forward_list);
+    }
+
+    std::cout << "size=" << size
+              << " etl::list=" << etl_list_ms / rounds << "ms"
+              << " etl::forward_list=" << etl_forward_list_ms / rounds << "ms"
+              << " etl::intrusive_list=" << etl_intrusive_list_ms / rounds << "ms"
+              << " std::list=" << std_list_ms / rounds << "ms"
+              << " std::forward_list=" << std_forward_list_ms / rounds << "ms\n";
+  }
+
+  return 0;
+}
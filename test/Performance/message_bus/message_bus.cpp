@@ -0,0 +1,155 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Broadcast latency against the number of subscribed routers,
+// for a message bus with and without a subscription index.
+// Each router accepts four of the 200 message ids.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. message_bus.cpp
+
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+
+#include "etl/message_bus.h"
+
+namespace
+{
+  const int MESSAGE_IDS = 200;
+  const int ROUTERS     = 60;
+  const int ROUNDS      = 200000;
+
+  volatile uint32_t received = 0;
+
+  //***************************************************************************
+  // A router that accepts four message ids.
+  // The messages are not derived from etl::message, so implement the interface directly.
+  //***************************************************************************
+  class Router : public etl::imessage_router
+  {
+  public:
+
+    Router()
+      : imessage_router(1)
+      , first_id(0)
+    {
+    }
+
+    void set_first_id(etl::message_id_t id)
+    {
+      first_id = id;
+    }
+
+    using imessage_router::accepts;
+
+    void receive(const etl::imessage&)
+    {
+      received = received + 1;
+    }
+
+    void receive(etl::imessage_router&, const etl::imessage&)
+    {
+      received = received + 1;
+    }
+
+    void receive(etl::imessage_router& source, etl::message_router_id_t, const etl::imessage& message)
+    {
+      receive(source, message);
+    }
+
+    bool accepts(etl::message_id_t id) const
+    {
+      return (id >= first_id) && (id < etl::message_id_t(first_id + 4));
+    }
+
+    bool is_null_router() const
+    {
+      return false;
+    }
+
+  private:
+
+    etl::message_id_t first_id;
+  };
+
+  struct Message : public etl::imessage
+  {
+    Message(etl::message_id_t id)
+      : imessage(id)
+    {
+    }
+  };
+
+  Router routers[ROUTERS];
+
+  //***************************************************************************
+  template <typename TBus>
+  void run(const char* name, int n_routers)
+  {
+    static TBus bus;
+
+    bus.clear();
+
+    for (int i = 0; i < n_routers; ++i)
+    {
+      routers[i].set_first_id(etl::message_id_t((i * 37) % (MESSAGE_IDS - 4)));
+      bus.subscribe(routers[i]);
+    }
+
+    typedef std::chrono::high_resolution_clock clock;
+
+    clock::time_point start = clock::now();
+
+    for (int i = 0; i < ROUNDS; ++i)
+    {
+      Message message(etl::message_id_t(i % MESSAGE_IDS));
+      bus.receive(message);
+    }
+
+    clock::time_point stop = clock::now();
+
+    std::cout << name << " routers=" << n_routers
+              << " broadcast=" << std::chrono::duration<double, std::nano>(stop - start).count() / ROUNDS << "ns\n";
+  }
+}
+
+int main()
+{
+  const int counts[] = { 4, 15, 30, 60 };
+
+  for (int i = 0; i < 4; ++i)
+  {
+    run<etl::message_bus<ROUTERS> >("unindexed", counts[i]);
+    run<etl::message_bus<ROUTERS, MESSAGE_IDS> >("indexed  ", counts[i]);
+  }
+
+  std::cout << "received=" << received << "\n";
+
+  return 0;
+}
@@ -0,0 +1,201 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Dispatch latency for a protocol of 120 messages.
+// The default build uses the variadic etl::message_router with one router for
+// all of the messages. Build with -DETL_MESSAGE_ROUTER_FORCE_CPP03 to use the
+// generated routers instead, which handle at most 16 messages each, so the
+// messages are spread over a chain of 8 routers linked by successors.
+// Build with -DETL_MESSAGE_ID_TYPE=uint16_t to also time sparse IDs, which the
+// variadic router dispatches through a perfect hash.
+//
+// g++ -O2 -std=c++14 -I../../../include -I../.. message_router.cpp
+// g++ -O2 -std=c++14 -I../../../include -I../.. -DETL_MESSAGE_ROUTER_FORCE_CPP03 message_router.cpp
+// g++ -O2 -std=c++14 -I../../../include -I../.. -DETL_MESSAGE_ID_TYPE=uint16_t message_router.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/message_router.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const size_t MESSAGES = 120;
+  const size_t GROUP    = 15;
+  const size_t LOOKUPS  = 1000000;
+
+  //***************************************************************************
+  template <size_t... Indexes>
+  struct index_sequence
+  {
+  };
+
+  template <size_t N, size_t... Indexes>
+  struct make_index_sequence : make_index_sequence<N - 1, N - 1, Indexes...>
+  {
+  };
+
+  template <size_t... Indexes>
+  struct make_index_sequence<0, Indexes...>
+  {
+    typedef index_sequence<Indexes...> type;
+  };
+
+  //***************************************************************************
+  template <size_t ID_>
+  struct Message : public etl::message<ID_>
+  {
+    int value;
+  };
+
+  //***************************************************************************
+  // A router for the messages STRIDE * (FIRST + i), for i in the sequence.
+  template <size_t FIRST, size_t STRIDE, typename TSequence>
+  class Router;
+
+  template <size_t FIRST, size_t STRIDE, size_t... Indexes>
+  class Router<FIRST, STRIDE, index_sequence<Indexes...> >
+    : public etl::message_router<Router<FIRST, STRIDE, index_sequence<Indexes...> >, Message<STRIDE * (FIRST + Indexes)>...>
+  {
+  public:
+
+    Router()
+      : etl::message_router<Router, Message<STRIDE * (FIRST + Indexes)>...>(0),
+        total(0)
+    {
+    }
+
+    template <size_t ID_>
+    void on_receive(etl::imessage_router&, const Message<ID_>& msg)
+    {
+      total += msg.value + ID_;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    size_t total;
+  };
+
+  //***************************************************************************
+  template <size_t ID_>
+  const etl::imessage* make_message(int value)
+  {
+    Message<ID_>* message = new Message<ID_>();
+    message->value = value;
+    return message;
+  }
+
+  //***************************************************************************
+  template <size_t STRIDE, size_t... Indexes>
+  std::vector<const etl::imessage*> make_messages(index_sequence<Indexes...>)
+  {
+    // One instance of each message type, never freed.
+    static const etl::imessage* pointers[] = { make_message<STRIDE * Indexes>(int(Indexes))... };
+
+    std::mt19937 generator(1);
+    std::vector<const etl::imessage*> stream(LOOKUPS);
+
+    for (size_t i = 0; i < LOOKUPS; ++i)
+    {
+      stream[i] = pointers[generator() % sizeof...(Indexes)];
+    }
+
+    return stream;
+  }
+
+  //***************************************************************************
+  double time_ns(etl::imessage_router& router, const std::vector<const etl::imessage*>& stream)
+  {
+    clock_t::time_point start = clock_t::now();
+
+    for (size_t i = 0; i < stream.size(); ++i)
+    {
+      router.receive(*stream[i]);
+    }
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / stream.size();
+  }
+}
+
+int main()
+{
+  typedef make_index_sequence<MESSAGES>::type all_t;
+
+  std::vector<const etl::imessage*> dense_stream = make_messages<1>(all_t());
+
+#if defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  typedef make_index_sequence<GROUP>::type group_t;
+
+  static Router<0 * GROUP, 1, group_t> r0;
+  static Router<1 * GROUP, 1, group_t> r1;
+  static Router<2 * GROUP, 1, group_t> r2;
+  static Router<3 * GROUP, 1, group_t> r3;
+  static Router<4 * GROUP, 1, group_t> r4;
+  static Router<5 * GROUP, 1, group_t> r5;
+  static Router<6 * GROUP, 1, group_t> r6;
+  static Router<7 * GROUP, 1, group_t> r7;
+
+  r0.set_successor(r1);
+  r1.set_successor(r2);
+  r2.set_successor(r3);
+  r3.set_successor(r4);
+  r4.set_successor(r5);
+  r5.set_successor(r6);
+  r6.set_successor(r7);
+
+  std::cout << "generated routers, chain of 8, dense IDs: " << time_ns(r0, dense_stream) << "ns\n";
+#else
+  static Router<0, 1, all_t> dense_router;
+
+  std::cout << "variadic router, dense IDs:  " << time_ns(dense_router, dense_stream) << "ns\n";
+
+  #if ETL_CPP14_SUPPORTED
+  if (sizeof(etl::message_id_t) > 1)
+  {
+    // IDs spread over 0 to 60000.
+    const size_t STRIDE = (sizeof(etl::message_id_t) > 1) ? 503 : 1;
+
+    static Router<0, STRIDE, all_t> sparse_router;
+
+    std::vector<const etl::imessage*> sparse_stream = make_messages<STRIDE>(all_t());
+
+    std::cout << "variadic router, sparse IDs: " << time_ns(sparse_router, sparse_stream) << "ns\n";
+  }
+  #endif
+#endif
+
+  return 0;
+}
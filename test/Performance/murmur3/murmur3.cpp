@@ -0,0 +1,94 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Hashing throughput, against the reference implementation.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. murmur3.cpp ../../murmurhash3.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/murmur3.h"
+
+#include "murmurhash3.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  //***************************************************************************
+  template <typename TFunction>
+  void throughput(const char* name, size_t length, size_t repeats, TFunction function)
+  {
+    uint64_t sum = 0;
+
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    for (size_t i = 0; i < repeats; ++i)
+    {
+      sum += function();
+    }
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    double seconds = std::chrono::duration<double>(stop - start).count();
+
+    std::cout << name << " " << length << " bytes: " << (double(length) * repeats) / seconds / 1.0e6 << " MB/s" << ((sum == 1) ? " " : "") << "\n";
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  for (size_t length : { size_t(16), size_t(1000), size_t(1000000) })
+  {
+    std::vector<uint8_t> data(length + 1);
+
+    for (uint8_t& c : data)
+    {
+      c = uint8_t(generator());
+    }
+
+    const size_t repeats = 200000000 / (length + 64);
+
+    // Starting one byte in, so that the blocks are unaligned.
+    const uint8_t* begin = data.data() + 1;
+    const uint8_t* end   = begin + length;
+
+    throughput("etl::murmur3<uint32_t>          ", length, repeats, [&] { return uint64_t(etl::murmur3<uint32_t>(begin, end).value()); });
+    throughput("etl::murmur3<uint32_t> iterator ", length, repeats, [&] { return uint64_t(etl::murmur3<uint32_t>(data.begin() + 1, data.end()).value()); });
+    throughput("MurmurHash3_x86_32              ", length, repeats, [&] { uint32_t h; MurmurHash3_x86_32(begin, int(length), 0, &h); return uint64_t(h); });
+    throughput("etl::murmur3_x64_128            ", length, repeats, [&] { return etl::murmur3_x64_128(begin, end).value()[0]; });
+    throughput("MurmurHash3_x64_128             ", length, repeats, [&] { uint64_t h[2]; MurmurHash3_x64_128(begin, int(length), 0, h); return h[0]; });
+  }
+
+  return 0;
+}
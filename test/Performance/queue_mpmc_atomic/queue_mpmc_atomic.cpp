@@ -0,0 +1,135 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// queue_mpmc_atomic against queue_mpmc_mutex, with several producers and consumers.
+//
+// g++ -O2 -std=c++11 -pthread -I../../../include -I../.. queue_mpmc_atomic.cpp
+
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+#include <stdint.h>
+
+#include "etl/queue_mpmc_atomic.h"
+#include "etl/queue_mpmc_mutex.h"
+
+namespace
+{
+  const uint32_t COUNT = 2000000; // Per producer.
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run(const char* name, int producers, int consumers)
+  {
+    static TQueue queue;
+    static std::atomic<uint64_t> sum;
+    static std::atomic<uint64_t> remaining;
+
+    sum       = 0;
+    remaining = uint64_t(producers) * COUNT;
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    std::vector<std::thread> threads;
+
+    for (int p = 0; p < producers; ++p)
+    {
+      threads.push_back(std::thread([]()
+      {
+        for (uint32_t i = 0; i < COUNT;)
+        {
+          if (queue.push(i))
+          {
+            ++i;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+      }));
+    }
+
+    for (int c = 0; c < consumers; ++c)
+    {
+      threads.push_back(std::thread([]()
+      {
+        uint64_t local = 0;
+        uint32_t value;
+
+        while (remaining.load(std::memory_order_relaxed) > 0)
+        {
+          if (queue.pop(value))
+          {
+            local += value;
+            --remaining;
+          }
+          else
+          {
+            std::this_thread::yield();
+          }
+        }
+
+        sum += local;
+      }));
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+    double total   = double(producers) * COUNT;
+
+    std::cout << name << "\t" << producers << "P/" << consumers << "C\t" << (total / seconds / 1000000.0) << " M msgs/s\t(" << sum << ")\n";
+  }
+
+  typedef etl::queue_mpmc_mutex<uint32_t, 1024>                                            Mutex;
+  typedef etl::queue_mpmc_atomic<uint32_t, 1024>                                           Atomic;
+  typedef etl::queue_mpmc_atomic<uint32_t, 1024, etl::memory_model::MEMORY_MODEL_LARGE, 64> AtomicSeparated;
+}
+
+//*****************************************************************************
+int main()
+{
+  const int threads[] = { 1, 2, 4 };
+
+  for (size_t i = 0; i < (sizeof(threads) / sizeof(threads[0])); ++i)
+  {
+    int n = threads[i];
+
+    run<Mutex>("mutex           ", n, n);
+    run<Atomic>("atomic          ", n, n);
+    run<AtomicSeparated>("atomic separated", n, n);
+  }
+
+  return 0;
+}
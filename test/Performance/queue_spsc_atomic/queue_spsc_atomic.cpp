@@ -0,0 +1,146 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// queue_spsc_atomic throughput between two threads.
+// Compares the compact layout, the cache line separated layout and batched
+// push/pop.
+//
+// g++ -O2 -std=c++11 -pthread -I../../../include -I../.. queue_spsc_atomic.cpp
+
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <stdint.h>
+
+#include "etl/queue_spsc_atomic.h"
+
+namespace
+{
+  const uint32_t COUNT = 20000000;
+  const size_t   BATCH = 32;
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run_single(const char* name)
+  {
+    static TQueue queue;
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    std::thread producer([]()
+    {
+      for (uint32_t i = 0; i < COUNT;)
+      {
+        if (queue.push(i))
+        {
+          ++i;
+        }
+      }
+    });
+
+    uint64_t sum = 0;
+    uint32_t value;
+
+    for (uint32_t i = 0; i < COUNT;)
+    {
+      if (queue.pop(value))
+      {
+        sum += value;
+        ++i;
+      }
+    }
+
+    producer.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << name << "\t" << (COUNT / seconds / 1000000.0) << " M msgs/s\t(" << sum << ")\n";
+  }
+
+  //***************************************************************************
+  template <typename TQueue>
+  void run_batch(const char* name)
+  {
+    static TQueue queue;
+
+    std::chrono::high_resolution_clock::time_point start = std::chrono::high_resolution_clock::now();
+
+    std::thread producer([]()
+    {
+      uint32_t values[BATCH];
+
+      for (uint32_t i = 0; i < COUNT;)
+      {
+        uint32_t n = 0;
+
+        while ((n < BATCH) && ((i + n) < COUNT))
+        {
+          values[n] = i + n;
+          ++n;
+        }
+
+        i += uint32_t(queue.push(values, values + n));
+      }
+    });
+
+    uint64_t sum = 0;
+    uint32_t values[BATCH];
+
+    for (uint32_t i = 0; i < COUNT;)
+    {
+      size_t n = queue.pop(values, BATCH);
+
+      for (size_t j = 0; j < n; ++j)
+      {
+        sum += values[j];
+      }
+
+      i += uint32_t(n);
+    }
+
+    producer.join();
+
+    double seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << name << "\t" << (COUNT / seconds / 1000000.0) << " M msgs/s\t(" << sum << ")\n";
+  }
+
+  typedef etl::queue_spsc_atomic<uint32_t, 1024>                                         Compact;
+  typedef etl::queue_spsc_atomic<uint32_t, 1024, etl::memory_model::MEMORY_MODEL_LARGE, 64> Separated;
+}
+
+//*****************************************************************************
+int main()
+{
+  run_single<Compact>("compact         ");
+  run_single<Separated>("separated       ");
+  run_batch<Compact>("compact batch   ");
+  run_batch<Separated>("separated batch ");
+
+  return 0;
+}
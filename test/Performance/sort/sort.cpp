@@ -0,0 +1,98 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// etl::sort, etl::stable_sort and etl::nth_element against the std versions,
+// on random ints from 1K to 1M elements.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. sort.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/algorithm.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ms(const std::vector<int>& source, TFunction function, int rounds)
+  {
+    std::vector<int> data;
+    double total = 0.0;
+
+    for (int i = 0; i < rounds; ++i)
+    {
+      data = source;
+
+      clock_t::time_point start = clock_t::now();
+      function(data);
+      clock_t::time_point stop = clock_t::now();
+
+      total += std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    return total / rounds;
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  for (size_t size = 1000; size <= 1000000; size *= 10)
+  {
+    std::vector<int> source(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+      source[i] = int(generator());
+    }
+
+    const int rounds = int(10000000 / size) + 1;
+
+    double std_sort        = time_ms(source, [](std::vector<int>& d) { std::sort(d.begin(), d.end()); }, rounds);
+    double etl_sort        = time_ms(source, [](std::vector<int>& d) { etl::sort(d.begin(), d.end()); }, rounds);
+    double std_stable_sort = time_ms(source, [](std::vector<int>& d) { std::stable_sort(d.begin(), d.end()); }, rounds);
+    double etl_stable_sort = time_ms(source, [](std::vector<int>& d) { etl::stable_sort(d.begin(), d.end()); }, rounds);
+    double std_nth_element = time_ms(source, [](std::vector<int>& d) { std::nth_element(d.begin(), d.begin() + d.size() / 2, d.end()); }, rounds);
+    double etl_nth_element = time_ms(source, [](std::vector<int>& d) { etl::nth_element(d.begin(), d.begin() + d.size() / 2, d.end()); }, rounds);
+
+    std::cout << "size=" << size
+              << " sort std=" << std_sort << "ms etl=" << etl_sort << "ms"
+              << " stable_sort std=" << std_stable_sort << "ms etl=" << etl_stable_sort << "ms"
+              << " nth_element std=" << std_nth_element << "ms etl=" << etl_nth_element << "ms\n";
+  }
+
+  return 0;
+}
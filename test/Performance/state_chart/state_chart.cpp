@@ -0,0 +1,131 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Event processing time for a state chart with 80 states and 400 transitions,
+// scanning the tables against using an index.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. state_chart.cpp
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/state_chart.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock clock_t;
+
+  const int    STATES      = 80;
+  const int    EVENTS      = 40;
+  const int    TRANSITIONS = 400;
+  const size_t LOOKUPS     = 1000000;
+
+  //***************************************************************************
+  class Chart : public etl::state_chart<Chart>
+  {
+  public:
+
+    Chart(const transition* tbegin, const transition* tend, const state* sbegin, const state* send)
+      : state_chart<Chart>(*this, tbegin, tend, sbegin, send, 0),
+        count(0)
+    {
+    }
+
+    void Action()
+    {
+      ++count;
+    }
+
+    size_t count;
+  };
+
+  //***************************************************************************
+  double time_ns(Chart& chart, const std::vector<int>& events)
+  {
+    clock_t::time_point start = clock_t::now();
+
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+      chart.process_event(events[i]);
+    }
+
+    clock_t::time_point stop = clock_t::now();
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / events.size();
+  }
+}
+
+int main()
+{
+  std::mt19937 generator(1);
+
+  // Every state handles some events, and every event is handled by some state.
+  std::vector<Chart::transition> transitions;
+  transitions.reserve(TRANSITIONS);
+
+  for (int i = 0; i < TRANSITIONS; ++i)
+  {
+    transitions.push_back(Chart::transition(i % STATES, int(generator() % EVENTS), int(generator() % STATES), &Chart::Action));
+  }
+
+  std::vector<Chart::state> states;
+  states.reserve(STATES);
+
+  for (int i = 0; i < STATES; ++i)
+  {
+    states.push_back(Chart::state(i));
+  }
+
+  std::vector<int> events(LOOKUPS);
+
+  for (size_t i = 0; i < LOOKUPS; ++i)
+  {
+    events[i] = int(generator() % EVENTS);
+  }
+
+  const Chart::transition* tbegin = &transitions.front();
+  const Chart::transition* tend   = tbegin + transitions.size();
+  const Chart::state*      sbegin = &states.front();
+  const Chart::state*      send   = sbegin + states.size();
+
+  Chart scanned(tbegin, tend, sbegin, send);
+  Chart indexed(tbegin, tend, sbegin, send);
+
+  static etl::state_chart_index<TRANSITIONS, STATES> index;
+  indexed.set_index(index);
+
+  scanned.start();
+  indexed.start();
+
+  std::cout << "scanned: " << time_ns(scanned, events) << "ns per event\n";
+  std::cout << "indexed: " << time_ns(indexed, events) << "ns per event\n";
+
+  return (scanned.count == indexed.count) ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Search times in 4 KiB log buffers, against std::search.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. string_search.cpp
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+
+#include "etl/cstring.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t RUNS = 20000;
+
+  typedef etl::string<4096> buffer_t;
+
+  //***************************************************************************
+  void fill_log(buffer_t& buffer)
+  {
+    static const char* const words[] = { "INFO ", "DEBUG ", "request ", "completed ", "in ", "12ms ", "user=", "id=42 ", "path=/api/v1/items ", "status=200\n" };
+
+    std::mt19937 generator(1);
+
+    while (buffer.size() < (buffer.max_size() - 32))
+    {
+      buffer.append(words[generator() % 10]);
+    }
+  }
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function)
+  {
+    size_t found = 0;
+
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    for (size_t i = 0; i < RUNS; ++i)
+    {
+      found += function();
+    }
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    if (found == 1)
+    {
+      std::cout << "";
+    }
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / RUNS;
+  }
+}
+
+int main()
+{
+  static buffer_t buffer;
+  fill_log(buffer);
+
+  const char* const needles[] = { "status=500", "ERROR", "path=/api/v2", "request completed in 12ms status=404" };
+
+  for (size_t n = 0; n < 4; ++n)
+  {
+    const char*  needle = needles[n];
+    const size_t length = strlen(needle);
+
+    double etl_ns = time_ns([&]() { return buffer.find(needle); });
+    double std_ns = time_ns([&]() { return size_t(std::search(buffer.begin(), buffer.end(), needle, needle + length) - buffer.begin()); });
+
+    std::cout << "find \"" << needle << "\": " << etl_ns << "ns, std::search " << std_ns << "ns\n";
+  }
+
+  // Read through a volatile, so that the search is not hoisted out of the loop.
+  static volatile size_t start = 0;
+
+  double first_of_ns = time_ns([&]() { return buffer.find_first_of("#%!", start); });
+  std::cout << "find_first_of: " << first_of_ns << "ns\n";
+
+  return 0;
+}
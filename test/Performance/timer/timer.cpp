@@ -0,0 +1,178 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+// Cost of start, stop and tick against the number of running timers,
+// for the delta list and timing wheel schedulers.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. timer.cpp
+
+#include <chrono>
+#include <iostream>
+#include <stdint.h>
+
+#include "etl/callback_timer.h"
+#include "etl/message_timer.h"
+
+namespace
+{
+  const uint32_t ROUNDS = 200000;
+
+  volatile uint32_t expired = 0;
+
+  void callback()
+  {
+    expired = expired + 1;
+  }
+
+  struct Message : public etl::message<1>
+  {
+  };
+
+  class Router : public etl::message_router<Router, Message>
+  {
+  public:
+
+    Router()
+      : message_router(1)
+    {
+    }
+
+    void on_receive(etl::imessage_router&, const Message&)
+    {
+      expired = expired + 1;
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+  };
+
+  Router  router;
+  Message message;
+
+  uint32_t random_state = 1;
+
+  uint32_t random()
+  {
+    random_state = (random_state * 1103515245U) + 12345U;
+    return random_state >> 8;
+  }
+
+  //***************************************************************************
+  template <typename TController>
+  void register_timer(TController& controller, uint32_t period)
+  {
+    controller.register_timer(callback, period, etl::timer::mode::REPEATING);
+  }
+
+  template <const uint_least8_t MAX, typename TScheduler>
+  void register_timer(etl::message_timer<MAX, TScheduler>& controller, uint32_t period)
+  {
+    controller.register_timer(message, router, period, etl::timer::mode::REPEATING);
+  }
+
+  //***************************************************************************
+  template <typename TController>
+  void run(const char* name, const char* scheduler, uint_least8_t n_timers)
+  {
+    static TController controller;
+
+    controller.clear();
+    random_state = 1;
+
+    for (uint_least8_t i = 0U; i < n_timers; ++i)
+    {
+      register_timer(controller, 100U + (random() % 10000U));
+      controller.start(etl::timer::id::type(i));
+    }
+
+    controller.enable(true);
+
+    typedef std::chrono::high_resolution_clock clock;
+
+    // Restart a random timer; the list has to search for its new place.
+    clock::time_point start = clock::now();
+
+    for (uint32_t i = 0; i < ROUNDS; ++i)
+    {
+      controller.start(etl::timer::id::type(random() % n_timers));
+    }
+
+    clock::time_point restarted = clock::now();
+
+    // Stop and start again.
+    for (uint32_t i = 0; i < ROUNDS; ++i)
+    {
+      const etl::timer::id::type id = etl::timer::id::type(random() % n_timers);
+      controller.stop(id);
+      controller.start(id);
+    }
+
+    clock::time_point stopped = clock::now();
+
+    // Single ticks, with the repeating timers expiring along the way.
+    for (uint32_t i = 0; i < ROUNDS; ++i)
+    {
+      controller.tick(1);
+    }
+
+    clock::time_point ticked = clock::now();
+
+    const double start_ns = std::chrono::duration<double, std::nano>(restarted - start).count()  / ROUNDS;
+    const double stop_ns  = std::chrono::duration<double, std::nano>(stopped - restarted).count() / ROUNDS;
+    const double tick_ns  = std::chrono::duration<double, std::nano>(ticked - stopped).count()   / ROUNDS;
+
+    std::cout << name << " " << scheduler << " timers=" << int(n_timers)
+              << " start=" << start_ns << "ns"
+              << " stop+start=" << stop_ns << "ns"
+              << " tick=" << tick_ns << "ns\n";
+  }
+
+  //***************************************************************************
+  template <template <const uint_least8_t, typename> class TController>
+  void run_all(const char* name)
+  {
+    run<TController<8,   etl::timer::scheduler::delta_list> >(name, "list ", 8);
+    run<TController<8,   etl::timer::scheduler::wheel> >(name, "wheel", 8);
+    run<TController<64,  etl::timer::scheduler::delta_list> >(name, "list ", 64);
+    run<TController<64,  etl::timer::scheduler::wheel> >(name, "wheel", 64);
+    run<TController<254, etl::timer::scheduler::delta_list> >(name, "list ", 254);
+    run<TController<254, etl::timer::scheduler::wheel> >(name, "wheel", 254);
+  }
+}
+
+int main()
+{
+  run_all<etl::callback_timer>("callback_timer");
+  run_all<etl::message_timer>("message_timer");
+
+  std::cout << "expired=" << expired << "\n";
+
+  return 0;
+}
@@ -0,0 +1,158 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Parsing times per value, against strtoull, strtoll and strtod.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. to_arithmetic.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "etl/to_arithmetic.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t VALUES = 100000;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function)
+  {
+    double sum = 0.0;
+
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    for (size_t i = 0; i < VALUES; ++i)
+    {
+      sum += double(function(i));
+    }
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    if (sum == 1.0)
+    {
+      std::cout << "";
+    }
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / VALUES;
+  }
+
+  //***************************************************************************
+  template <typename TEtl, typename TStrto>
+  void compare(const char* name, TEtl etl_function, TStrto strto_function)
+  {
+    double etl_ns   = time_ns(etl_function);
+    double strto_ns = time_ns(strto_function);
+
+    std::cout << name << ": etl " << etl_ns << "ns, strto " << strto_ns << "ns\n";
+  }
+
+  //***************************************************************************
+  template <typename T>
+  T parse(const std::string& text, uint32_t base = 10U)
+  {
+    T value = T(0);
+    etl::from_chars(text.data(), text.data() + text.size(), value, base);
+    return value;
+  }
+
+  //***************************************************************************
+  template <typename T>
+  T parse_floating_point(const std::string& text)
+  {
+    T value = T(0);
+    etl::from_chars(text.data(), text.data() + text.size(), value);
+    return value;
+  }
+}
+
+int main()
+{
+  std::mt19937_64 generator(1);
+
+  std::vector<std::string> u64(VALUES);
+  std::vector<std::string> i64(VALUES);
+  std::vector<std::string> hex(VALUES);
+  std::vector<std::string> telemetry(VALUES);
+  std::vector<std::string> random_double(VALUES);
+
+  char buffer[64];
+
+  for (size_t i = 0; i < VALUES; ++i)
+  {
+    const uint64_t u = generator();
+
+    snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)u);
+    u64[i] = buffer;
+
+    snprintf(buffer, sizeof(buffer), "%lld", (long long)(int64_t(generator()) >> (generator() % 64)));
+    i64[i] = buffer;
+
+    snprintf(buffer, sizeof(buffer), "%llx", (unsigned long long)u);
+    hex[i] = buffer;
+
+    snprintf(buffer, sizeof(buffer), "%.3f", double(int64_t(generator() % 2000000) - 1000000) / 1000.0);
+    telemetry[i] = buffer;
+
+    snprintf(buffer, sizeof(buffer), "%.17g", double(int64_t(generator())) * 1.0e-7);
+    random_double[i] = buffer;
+  }
+
+  compare("uint64_t",
+          [&](size_t i) { return parse<uint64_t>(u64[i]); },
+          [&](size_t i) { return strtoull(u64[i].c_str(), nullptr, 10); });
+
+  compare("int64_t",
+          [&](size_t i) { return parse<int64_t>(i64[i]); },
+          [&](size_t i) { return strtoll(i64[i].c_str(), nullptr, 10); });
+
+  compare("uint64_t hex",
+          [&](size_t i) { return parse<uint64_t>(hex[i], 16U); },
+          [&](size_t i) { return strtoull(hex[i].c_str(), nullptr, 16); });
+
+  compare("double precision 3",
+          [&](size_t i) { return parse_floating_point<double>(telemetry[i]); },
+          [&](size_t i) { return strtod(telemetry[i].c_str(), nullptr); });
+
+  compare("random double %.17g",
+          [&](size_t i) { return parse_floating_point<double>(random_double[i]); },
+          [&](size_t i) { return strtod(random_double[i].c_str(), nullptr); });
+
+  compare("random float %.17g",
+          [&](size_t i) { return parse_floating_point<float>(random_double[i]); },
+          [&](size_t i) { return strtof(random_double[i].c_str(), nullptr); });
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+// Formatting times per value, against snprintf.
+//
+// g++ -O2 -std=c++11 -I../../../include -I../.. to_string.cpp
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "etl/to_string.h"
+#include "etl/format_spec.h"
+
+namespace
+{
+  typedef std::chrono::high_resolution_clock bench_clock_t;
+
+  const size_t VALUES = 100000;
+
+  //***************************************************************************
+  template <typename TFunction>
+  double time_ns(TFunction function)
+  {
+    size_t length = 0;
+
+    bench_clock_t::time_point start = bench_clock_t::now();
+
+    for (size_t i = 0; i < VALUES; ++i)
+    {
+      length += function(i);
+    }
+
+    bench_clock_t::time_point stop = bench_clock_t::now();
+
+    if (length == 1)
+    {
+      std::cout << "";
+    }
+
+    return std::chrono::duration<double, std::nano>(stop - start).count() / VALUES;
+  }
+
+  //***************************************************************************
+  template <typename TEtl, typename TPrintf>
+  void compare(const char* name, TEtl etl_function, TPrintf printf_function)
+  {
+    double etl_ns    = time_ns(etl_function);
+    double printf_ns = time_ns(printf_function);
+
+    std::cout << name << ": etl " << etl_ns << "ns, snprintf " << printf_ns << "ns\n";
+  }
+}
+
+int main()
+{
+  std::mt19937_64 generator(1);
+
+  std::vector<uint32_t> u32(VALUES);
+  std::vector<int64_t>  i64(VALUES);
+  std::vector<double>   telemetry(VALUES);
+
+  for (size_t i = 0; i < VALUES; ++i)
+  {
+    u32[i]       = uint32_t(generator());
+    i64[i]       = int64_t(generator()) >> (generator() % 64);
+    telemetry[i] = double(int64_t(generator() % 2000000) - 1000000) / 1000.0;
+  }
+
+  etl::string<64> str;
+  char buffer[64];
+
+  const etl::format_spec hex      = etl::format_spec().hex();
+  const etl::format_spec fixed    = etl::format_spec().precision(3);
+  const etl::format_spec shortest = etl::format_spec().shortest(true);
+
+  compare("uint32_t",
+          [&](size_t i) { return etl::to_string(u32[i], str).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%u", u32[i])); });
+
+  compare("int64_t",
+          [&](size_t i) { return etl::to_string(i64[i], str).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%lld", (long long)i64[i])); });
+
+  compare("uint32_t hex",
+          [&](size_t i) { return etl::to_string(u32[i], str, hex).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%X", u32[i])); });
+
+  compare("double precision 3",
+          [&](size_t i) { return etl::to_string(telemetry[i], str, fixed).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%.3f", telemetry[i])); });
+
+  compare("double shortest (snprintf %.17g)",
+          [&](size_t i) { return etl::to_string(telemetry[i], str, shortest).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%.17g", telemetry[i])); });
+
+  compare("random double shortest (snprintf %.17g)",
+          [&](size_t i) { return etl::to_string(double(i64[i]) * 1.0e-7, str, shortest).size(); },
+          [&](size_t i) { return size_t(snprintf(buffer, sizeof(buffer), "%.17g", double(i64[i]) * 1.0e-7)); });
+
+  return 0;
+}
@@ -47,10 +47,14 @@ SOFTWARE.
 
 #define ETL_POLYMORPHIC_BITSET
 #define ETL_POLYMORPHIC_DEQUE
+#define ETL_POLYMORPHIC_EYTZINGER_FLAT_MAP
+#define ETL_POLYMORPHIC_EYTZINGER_FLAT_SET
 #define ETL_POLYMORPHIC_FLAT_MAP
 #define ETL_POLYMORPHIC_FLAT_MULTIMAP
 #define ETL_POLYMORPHIC_FLAT_SET
 #define ETL_POLYMORPHIC_FLAT_MULTISET
+#define ETL_POLYMORPHIC_FLAT_UNORDERED_MAP
+#define ETL_POLYMORPHIC_FLAT_UNORDERED_SET
 #define ETL_POLYMORPHIC_FORWARD_LIST
 #define ETL_POLYMORPHIC_LIST
 #define ETL_POLYMORPHIC_MAP
@@ -47,6 +47,7 @@ SOFTWARE.
 #include "etl/checksum.h"
 #include "etl/combinations.h"
 #include "etl/compare.h"
+#include "etl/concurrent_pool.h"
 #include "etl/constant.h"
 #include "etl/container.h"
 #include "etl/crc16.h"
@@ -67,6 +68,8 @@ SOFTWARE.
 #include "etl/enum_type.h"
 #include "etl/error_handler.h"
 #include "etl/exception.h"
+#include "etl/eytzinger_flat_map.h"
+#include "etl/eytzinger_flat_set.h"
 #include "etl/factorial.h"
 #include "etl/fibonacci.h"
 #include "etl/fixed_iterator.h"
@@ -74,6 +77,8 @@ SOFTWARE.
 #include "etl/flat_multimap.h"
 #include "etl/flat_multiset.h"
 #include "etl/flat_set.h"
+#include "etl/flat_unordered_map.h"
+#include "etl/flat_unordered_set.h"
 #include "etl/fnv_1.h"
 #include "etl/forward_list.h"
 #include "etl/frame_check_sequence.h"
@@ -123,9 +128,11 @@ SOFTWARE.
 #include "etl/power.h"
 #include "etl/priority_queue.h"
 #include "etl/queue.h"
+#include "etl/queue_mpmc_atomic.h"
 #include "etl/queue_mpmc_mutex.h"
 #include "etl/queue_spsc_atomic.h"
 #include "etl/queue_spsc_isr.h"
+#include "etl/queued_message_bus.h"
 #include "etl/radix.h"
 #include "etl/random.h"
 #include "etl/ratio.h"
@@ -144,6 +151,7 @@ SOFTWARE.
 #include "etl/string_view.h"
 #include "etl/task.h"
 #include "etl/timer.h"
+#include "etl/to_arithmetic.h"
 #include "etl/type_def.h"
 #include "etl/type_lookup.h"
 #include "etl/type_select.h"
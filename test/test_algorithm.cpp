@@ -33,6 +33,7 @@ SOFTWARE.
 
 #include <vector>
 #include <list>
+#include <forward_list>
 #include <algorithm>
 #include <functional>
 #include <numeric>
@@ -914,6 +915,207 @@ namespace
       }
     }
 
+    //=========================================================================
+    TEST(sort_patterns_and_sizes)
+    {
+      const size_t sizes[] = { 0, 1, 2, 3, 15, 16, 17, 33, 100, 1000, 10000 };
+
+      for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+      {
+        const size_t size = sizes[s];
+
+        std::vector<std::vector<int> > patterns(6, std::vector<int>(size));
+
+        for (size_t i = 0; i < size; ++i)
+        {
+          patterns[0][i] = int(urng() % 1000000);           // Random.
+          patterns[1][i] = int(i);                          // Sorted.
+          patterns[2][i] = int(size - i);                   // Reversed.
+          patterns[3][i] = int(urng() % 4);                 // Few distinct values.
+          patterns[4][i] = int((i < size / 2) ? i : size - i); // Organ pipe.
+          patterns[5][i] = 7;                               // All equal.
+        }
+
+        for (size_t p = 0; p < patterns.size(); ++p)
+        {
+          std::vector<int> data1 = patterns[p];
+          std::vector<int> data2 = patterns[p];
+
+          std::sort(data1.begin(), data1.end());
+          etl::sort(data2.begin(), data2.end());
+
+          CHECK(data1 == data2);
+        }
+      }
+    }
+
+    //=========================================================================
+    TEST(sort_median_of_three_killer)
+    {
+      // A sequence that makes median of three quicksort go quadratic,
+      // so that introsort falls back to heapsort.
+      const int k = 2000;
+      std::vector<int> data(2 * k);
+
+      for (int i = 1; i <= k; ++i)
+      {
+        if ((i % 2) == 1)
+        {
+          data[i - 1] = i;
+          data[i]     = k + i;
+        }
+
+        data[k + i - 1] = 2 * i;
+      }
+
+      std::vector<int> compare = data;
+      std::sort(compare.begin(), compare.end());
+
+      etl::sort(data.begin(), data.end());
+
+      CHECK(compare == data);
+    }
+
+    //=========================================================================
+    TEST(sort_bidirectional_and_forward_iterators)
+    {
+      std::vector<int> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = int(urng() % 100);
+      }
+
+      std::vector<int> compare = data;
+      std::sort(compare.begin(), compare.end(), std::greater<int>());
+
+      std::list<int> list(data.begin(), data.end());
+      etl::sort(list.begin(), list.end(), std::greater<int>());
+
+      CHECK(std::equal(compare.begin(), compare.end(), list.begin()));
+
+      std::forward_list<int> forward_list(data.begin(), data.end());
+      etl::sort(forward_list.begin(), forward_list.end(), std::greater<int>());
+
+      CHECK(std::equal(compare.begin(), compare.end(), forward_list.begin()));
+    }
+
+    //=========================================================================
+    TEST(stable_sort)
+    {
+      const size_t sizes[] = { 0, 1, 2, 17, 100, 3000 };
+
+      for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+      {
+        std::vector<StructData> data(sizes[s]);
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          data[i].a = int(urng() % 10);
+          data[i].b = int(i);
+        }
+
+        std::vector<StructData> compare = data;
+        std::stable_sort(compare.begin(), compare.end(), StructDataPredicate());
+
+        std::vector<StructData> data1 = data;
+        etl::stable_sort(data1.begin(), data1.end(), StructDataPredicate());
+        CHECK(compare == data1);
+
+        std::list<StructData> data2(data.begin(), data.end());
+        etl::stable_sort(data2.begin(), data2.end(), StructDataPredicate());
+        CHECK(std::equal(compare.begin(), compare.end(), data2.begin()));
+
+        std::forward_list<StructData> data3(data.begin(), data.end());
+        etl::stable_sort(data3.begin(), data3.end(), StructDataPredicate());
+        CHECK(std::equal(compare.begin(), compare.end(), data3.begin()));
+      }
+
+      std::vector<int> data4(500);
+      std::iota(data4.begin(), data4.end(), 0);
+      std::shuffle(data4.begin(), data4.end(), urng);
+
+      etl::stable_sort(data4.begin(), data4.end());
+      CHECK(std::is_sorted(data4.begin(), data4.end()));
+    }
+
+    //=========================================================================
+    TEST(partial_sort)
+    {
+      std::vector<int> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = int(urng() % 500);
+      }
+
+      const size_t middles[] = { 0, 1, 10, 500, 999, 1000 };
+
+      for (size_t m = 0; m < sizeof(middles) / sizeof(middles[0]); ++m)
+      {
+        std::vector<int> data1 = data;
+        std::vector<int> data2 = data;
+
+        std::partial_sort(data1.begin(), data1.begin() + middles[m], data1.end(), std::greater<int>());
+        etl::partial_sort(data2.begin(), data2.begin() + middles[m], data2.end(), std::greater<int>());
+
+        CHECK(std::equal(data1.begin(), data1.begin() + middles[m], data2.begin()));
+
+        std::sort(data2.begin(), data2.end(), std::greater<int>());
+        std::sort(data1.begin(), data1.end(), std::greater<int>());
+        CHECK(data1 == data2);
+      }
+
+      std::vector<int> data3 = data;
+      etl::partial_sort(data3.begin(), data3.begin() + 20, data3.end());
+
+      std::vector<int> compare = data;
+      std::sort(compare.begin(), compare.end());
+      CHECK(std::equal(compare.begin(), compare.begin() + 20, data3.begin()));
+    }
+
+    //=========================================================================
+    TEST(nth_element)
+    {
+      for (int pass = 0; pass < 20; ++pass)
+      {
+        std::vector<int> data(size_t(1 + (urng() % 2000)));
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          data[i] = int(urng() % 300);
+        }
+
+        std::vector<int> compare = data;
+        std::sort(compare.begin(), compare.end());
+
+        const size_t n = urng() % data.size();
+
+        etl::nth_element(data.begin(), data.begin() + n, data.end());
+
+        CHECK_EQUAL(compare[n], data[n]);
+
+        bool is_partitioned = true;
+
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+          is_partitioned = is_partitioned && ((i < n) ? !(data[n] < data[i]) : !(data[i] < data[n]));
+        }
+
+        CHECK(is_partitioned);
+
+        std::sort(data.begin(), data.end());
+        CHECK(compare == data);
+      }
+
+      std::vector<int> data2 = { 5, 3, 1, 4, 2 };
+      etl::nth_element(data2.begin(), data2.begin() + 1, data2.end(), std::greater<int>());
+      CHECK_EQUAL(4, data2[1]);
+
+      std::vector<int> empty;
+      etl::nth_element(empty.begin(), empty.end(), empty.end());
+    }
+
     //=========================================================================
     TEST(multimax)
     {
@@ -32,6 +32,9 @@ SOFTWARE.
 
 #include <array>
 #include <numeric>
+#include <random>
+#include <vector>
+#include <limits>
 
 namespace
 {
@@ -1017,6 +1020,317 @@ namespace
       CHECK_EQUAL(int(ll), int(rll));
     }
 
+    //*************************************************************************
+    TEST(put_get_random_widths_against_reference)
+    {
+      std::mt19937_64 generator(1);
+
+      std::vector<unsigned char> storage(2000);
+      std::vector<unsigned char> expected(2000);
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      std::vector<uint64_t>      values;
+      std::vector<uint_least8_t> widths;
+
+      size_t bit = 0U;
+
+      while (bit < ((storage.size() * 8U) - 64U))
+      {
+        const uint_least8_t width = uint_least8_t(1U + (generator() % 64U));
+        const uint64_t      value = generator() & ((width == 64U) ? ~uint64_t(0U) : ((uint64_t(1U) << width) - 1U));
+
+        CHECK(bit_stream.put(value, width));
+
+        // Reference, one bit at a time, most significant first.
+        for (int b = width - 1; b >= 0; --b)
+        {
+          if (((value >> b) & 1U) != 0U)
+          {
+            expected[bit / 8U] |= static_cast<unsigned char>(0x80U >> (bit % 8U));
+          }
+
+          ++bit;
+        }
+
+        values.push_back(value);
+        widths.push_back(width);
+      }
+
+      CHECK_EQUAL(bit, bit_stream.bits());
+      CHECK_EQUAL((bit + 7U) / 8U, bit_stream.size());
+      CHECK_ARRAY_EQUAL(expected.data(), storage.data(), bit_stream.size());
+
+      bit_stream.restart();
+
+      for (size_t i = 0U; i < values.size(); ++i)
+      {
+        uint64_t value;
+        CHECK(bit_stream.get(value, widths[i]));
+        CHECK_EQUAL(values[i], value);
+      }
+    }
+
+    //*************************************************************************
+    TEST(put_get_range)
+    {
+      std::array<unsigned char, 16> storage;
+      storage.fill(0);
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      const int16_t values[] = { -4, -3, -2, -1, 0, 1, 2, 3 };
+
+      CHECK(bit_stream.put(values, values + 8, 3));
+      CHECK_EQUAL(24U, bit_stream.bits());
+
+      // 100 101 110 111 000 001 010 011
+      CHECK_EQUAL(0x97U, storage[0]);
+      CHECK_EQUAL(0x70U, storage[1]);
+      CHECK_EQUAL(0x53U, storage[2]);
+
+      const uint8_t bytes[] = { 0x12, 0x34, 0x56 };
+      CHECK(bit_stream.put(bytes, bytes + 3, 8));
+      CHECK_EQUAL(0x12U, storage[3]);
+      CHECK_EQUAL(0x34U, storage[4]);
+      CHECK_EQUAL(0x56U, storage[5]);
+
+      // Not enough room for all of them, so nothing is written.
+      const uint32_t words[] = { 1, 2, 3 };
+      CHECK(!bit_stream.put(words, words + 3, 32));
+      CHECK_EQUAL(48U, bit_stream.bits());
+
+      bit_stream.restart();
+
+      int16_t result[8];
+      CHECK(bit_stream.get(result, result + 8, 3));
+      CHECK_ARRAY_EQUAL(values, result, 8);
+
+      std::vector<uint8_t> result_bytes(3);
+      CHECK(bit_stream.get(result_bytes.begin(), result_bytes.end(), 8));
+      CHECK_ARRAY_EQUAL(bytes, result_bytes.data(), 3);
+
+      // Not enough bits for all of them, so nothing is read.
+      uint32_t result_words[3] = { 0, 0, 0 };
+      CHECK(!bit_stream.get(result_words, result_words + 3, 32));
+      CHECK_EQUAL(0U, result_words[0]);
+      CHECK_EQUAL(48U, bit_stream.bits());
+    }
+
+    //*************************************************************************
+    TEST(unpack_block_against_scalar)
+    {
+      std::mt19937 generator(1);
+
+      for (int round = 0; round < 100; ++round)
+      {
+        unsigned char chars[etl::private_bit_stream::BLOCK_CHARS];
+
+        for (size_t i = 0U; i < etl::private_bit_stream::BLOCK_CHARS; ++i)
+        {
+          chars[i] = static_cast<unsigned char>(generator());
+        }
+
+        const uint_least8_t widths[] = { 1U, 2U, 4U, 8U };
+
+        for (size_t w = 0U; w < 4U; ++w)
+        {
+          uint8_t fields[etl::private_bit_stream::BLOCK_CHARS * 8U];
+          uint8_t expected[etl::private_bit_stream::BLOCK_CHARS * 8U];
+
+          etl::private_bit_stream::unpack_block(chars, widths[w], fields);
+          etl::private_bit_stream::unpack_block_scalar(chars, widths[w], expected);
+
+          CHECK_ARRAY_EQUAL(expected, fields, (etl::private_bit_stream::BLOCK_CHARS * 8U) / widths[w]);
+        }
+
+        uint16_t fields16[etl::private_bit_stream::BLOCK_CHARS / 2U];
+        uint16_t expected16[etl::private_bit_stream::BLOCK_CHARS / 2U];
+
+        etl::private_bit_stream::unpack_block_16(chars, fields16);
+        etl::private_bit_stream::unpack_block_16_scalar(chars, expected16);
+
+        CHECK_ARRAY_EQUAL(expected16, fields16, etl::private_bit_stream::BLOCK_CHARS / 2U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(get_range_block_widths)
+    {
+      std::mt19937 generator(1);
+
+      const uint_least8_t widths[] = { 1U, 2U, 4U, 8U, 16U };
+
+      for (size_t w = 0U; w < 5U; ++w)
+      {
+        const uint_least8_t width = widths[w];
+        const uint32_t      mask  = (1U << width) - 1U;
+
+        // Whole blocks, a partial block, and starts that are not on a char boundary.
+        for (uint_least8_t offset = 0U; offset < 8U; ++offset)
+        {
+          std::vector<unsigned char> storage(1024);
+          etl::bit_stream bit_stream(storage.data(), storage.size());
+
+          std::vector<uint16_t> values(300);
+
+          for (size_t i = 0U; i < values.size(); ++i)
+          {
+            values[i] = uint16_t(generator() & mask);
+          }
+
+          if (offset != 0U)
+          {
+            CHECK(bit_stream.put(uint32_t(0x55U), offset));
+          }
+
+          CHECK(bit_stream.put(values.begin(), values.end(), width));
+
+          bit_stream.restart();
+
+          uint32_t skip;
+
+          if (offset != 0U)
+          {
+            CHECK(bit_stream.get(skip, offset));
+          }
+
+          std::vector<uint16_t> result(values.size());
+          CHECK(bit_stream.get(result.begin(), result.end(), width));
+          CHECK_ARRAY_EQUAL(values.data(), result.data(), values.size());
+          CHECK_EQUAL(offset + (values.size() * width), bit_stream.bits());
+
+          // Signed fields are sign extended.
+          bit_stream.restart();
+
+          if (offset != 0U)
+          {
+            CHECK(bit_stream.get(skip, offset));
+          }
+
+          std::vector<int32_t> signed_result(values.size());
+          CHECK(bit_stream.get(signed_result.begin(), signed_result.end(), width));
+
+          for (size_t i = 0U; i < values.size(); ++i)
+          {
+            const int32_t expected = (values[i] & (1U << (width - 1U))) ? int32_t(values[i]) - int32_t(mask) - 1 : int32_t(values[i]);
+            CHECK_EQUAL(expected, signed_result[i]);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(put_varint)
+    {
+      std::array<unsigned char, 16> storage;
+      storage.fill(0);
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      CHECK(bit_stream.put_varint(uint32_t(1)));
+      CHECK(bit_stream.put_varint(uint32_t(300)));
+      CHECK(bit_stream.put_varint(int32_t(-1)));
+      CHECK(bit_stream.put_varint(int32_t(1)));
+      CHECK(bit_stream.put_varint(int64_t(-65)));
+
+      CHECK_EQUAL(7U, bit_stream.size());
+
+      CHECK_EQUAL(0x01U, storage[0]);
+      CHECK_EQUAL(0xACU, storage[1]); // 300
+      CHECK_EQUAL(0x02U, storage[2]);
+      CHECK_EQUAL(0x01U, storage[3]); // -1
+      CHECK_EQUAL(0x02U, storage[4]); // 1
+      CHECK_EQUAL(0x81U, storage[5]); // -65
+      CHECK_EQUAL(0x01U, storage[6]);
+
+      // Not enough room for the whole value, so nothing is written.
+      CHECK(!bit_stream.put_varint(std::numeric_limits<uint64_t>::max()));
+      CHECK_EQUAL(7U, bit_stream.size());
+    }
+
+    //*************************************************************************
+    TEST(put_get_varint)
+    {
+      std::mt19937_64 generator(2);
+
+      std::vector<unsigned char> storage(10000);
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      std::vector<int64_t>  signed_values;
+      std::vector<uint32_t> unsigned_values;
+
+      // Start off a char boundary.
+      CHECK(bit_stream.put(uint8_t(5), 3));
+
+      for (int i = 0; i < 400; ++i)
+      {
+        signed_values.push_back(int64_t(generator()) >> (generator() % 64U));
+        unsigned_values.push_back(uint32_t(generator() >> (generator() % 64U)));
+
+        CHECK(bit_stream.put_varint(signed_values.back()));
+        CHECK(bit_stream.put_varint(unsigned_values.back()));
+      }
+
+      CHECK(bit_stream.put_varint(std::numeric_limits<int64_t>::min()));
+      CHECK(bit_stream.put_varint(std::numeric_limits<int64_t>::max()));
+      CHECK(bit_stream.put_varint(std::numeric_limits<uint64_t>::max()));
+      CHECK(bit_stream.put_varint(int8_t(-128)));
+
+      bit_stream.restart();
+
+      uint8_t first;
+      CHECK(bit_stream.get(first, 3));
+      CHECK_EQUAL(5U, first);
+
+      for (int i = 0; i < 400; ++i)
+      {
+        int64_t  s;
+        uint32_t u;
+
+        CHECK(bit_stream.get_varint(s));
+        CHECK_EQUAL(signed_values[i], s);
+        CHECK(bit_stream.get_varint(u));
+        CHECK_EQUAL(unsigned_values[i], u);
+      }
+
+      int64_t  min_value;
+      int64_t  max_value;
+      uint64_t umax_value;
+      int8_t   small_value;
+
+      CHECK(bit_stream.get_varint(min_value));
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(), min_value);
+      CHECK(bit_stream.get_varint(max_value));
+      CHECK_EQUAL(std::numeric_limits<int64_t>::max(), max_value);
+      CHECK(bit_stream.get_varint(umax_value));
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), umax_value);
+      CHECK(bit_stream.get_varint(small_value));
+      CHECK_EQUAL(-128, small_value);
+    }
+
+    //*************************************************************************
+    TEST(get_varint_invalid)
+    {
+      std::array<unsigned char, 4> storage = { { 0x80, 0x02, 0xFF, 0xFF } };
+
+      etl::bit_stream bit_stream(storage.data(), storage.size());
+
+      // 256 does not fit in uint8_t. The stream is unchanged.
+      uint8_t small_value = 0;
+      CHECK(!bit_stream.get_varint(small_value));
+      CHECK_EQUAL(0U, bit_stream.bits());
+
+      uint16_t value = 0;
+      CHECK(bit_stream.get_varint(value));
+      CHECK_EQUAL(256U, value);
+
+      // Truncated. The stream is unchanged.
+      CHECK(!bit_stream.get_varint(value));
+      CHECK_EQUAL(16U, bit_stream.bits());
+    }
+
     //*************************************************************************
     TEST(put_get_object_global)
     {
@@ -31,6 +31,7 @@ SOFTWARE.
 #include <limits>
 #include <type_traits>
 #include <bitset>
+#include <random>
 
 #include "etl/bitset.h"
 
@@ -1012,6 +1013,172 @@ namespace
       CHECK_EQUAL(4U, data.find_next(true,  1));
     }
 
+    //*************************************************************************
+    template <const size_t N>
+    void fill_random(etl::bitset<N>& data, std::bitset<N>& compare, std::mt19937& generator, uint32_t percent_set)
+    {
+      for (size_t i = 0; i < N; ++i)
+      {
+        bool state = (generator() % 100) < percent_set;
+
+        data.set(i, state);
+        compare.set(i, state);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_words)
+    {
+      std::mt19937 generator(1);
+
+      etl::bitset<200> data;
+      std::bitset<200> compare;
+
+      for (uint32_t percent_set = 0; percent_set <= 100; percent_set += 5)
+      {
+        fill_random(data, compare, generator, percent_set);
+
+        for (size_t position = 0; position <= 200; ++position)
+        {
+          for (int state = 0; state < 2; ++state)
+          {
+            size_t expected = etl::ibitset::npos;
+
+            for (size_t i = position; i < 200; ++i)
+            {
+              if (compare.test(i) == (state == 1))
+              {
+                expected = i;
+                break;
+              }
+            }
+
+            CHECK_EQUAL(expected, data.find_next(state == 1, position));
+          }
+        }
+
+        CHECK_EQUAL(compare.count(), data.count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_run)
+    {
+      etl::bitset<150> data;
+
+      data.set();
+      data.reset(3);
+      data.reset(4);
+      data.reset(70);
+      data.reset(71);
+      data.reset(72);
+      data.reset(140);
+
+      for (size_t i = 100; i < 130; ++i)
+      {
+        data.reset(i);
+      }
+
+      CHECK_EQUAL(3U,   data.find_next_run(false, 1));
+      CHECK_EQUAL(3U,   data.find_next_run(false, 2));
+      CHECK_EQUAL(70U,  data.find_next_run(false, 3));
+      CHECK_EQUAL(100U, data.find_next_run(false, 4));
+      CHECK_EQUAL(100U, data.find_next_run(false, 30));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next_run(false, 31));
+      CHECK_EQUAL(140U, data.find_next_run(false, 1, 130));
+      CHECK_EQUAL(105U, data.find_next_run(false, 5, 105));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next_run(false, 1, 141));
+
+      CHECK_EQUAL(0U,   data.find_next_run(true, 3));
+      CHECK_EQUAL(5U,   data.find_next_run(true, 4));
+      CHECK_EQUAL(5U,   data.find_next_run(true, 65));
+      CHECK_EQUAL(73U,  data.find_next_run(true, 27, 70));
+      CHECK_EQUAL(130U, data.find_next_run(true, 10, 100));
+      CHECK_EQUAL(141U, data.find_next_run(true, 9, 132));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next_run(true, 66));
+      CHECK_EQUAL(etl::ibitset::npos, data.find_next_run(true, 10, 131));
+    }
+
+    //*************************************************************************
+    TEST(test_find_next_run_random)
+    {
+      std::mt19937 generator(2);
+
+      etl::bitset<300> data;
+      std::bitset<300> compare;
+
+      for (int pass = 0; pass < 20; ++pass)
+      {
+        fill_random(data, compare, generator, 50 + pass * 2);
+
+        for (size_t length = 1; length < 12; ++length)
+        {
+          size_t expected = etl::ibitset::npos;
+          size_t run      = 0;
+
+          for (size_t i = 0; i < 300; ++i)
+          {
+            run = compare.test(i) ? 0 : run + 1;
+
+            if (run == length)
+            {
+              expected = i + 1 - length;
+              break;
+            }
+          }
+
+          CHECK_EQUAL(expected, data.find_next_run(false, length));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_shift_words)
+    {
+      std::mt19937 generator(3);
+
+      etl::bitset<200> data;
+      std::bitset<200> compare;
+
+      fill_random(data, compare, generator, 50);
+
+      for (size_t shift = 0; shift <= 210; ++shift)
+      {
+        etl::bitset<200> left  = data << shift;
+        etl::bitset<200> right = data >> shift;
+
+        std::bitset<200> compare_left  = compare << shift;
+        std::bitset<200> compare_right = compare >> shift;
+
+        for (size_t i = 0; i < 200; ++i)
+        {
+          CHECK_EQUAL(compare_left.test(i),  left.test(i));
+          CHECK_EQUAL(compare_right.test(i), right.test(i));
+        }
+
+        CHECK_EQUAL(compare_left.count(),  left.count());
+        CHECK_EQUAL(compare_right.count(), right.count());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_unused_bits_stay_clear)
+    {
+      etl::bitset<10> data("1000000001");
+
+      data <<= 1;
+      CHECK_EQUAL(1U, data.count());
+      CHECK_EQUAL(1U, data.find_first(true));
+
+      etl::bitset<10> inverted = ~etl::bitset<10>();
+      CHECK_EQUAL(10U, inverted.count());
+      CHECK(inverted.all());
+      CHECK(inverted == etl::bitset<10>().set());
+
+      CHECK(!inverted.test(10));
+      CHECK_EQUAL(etl::ibitset::npos, inverted.find_first(false));
+    }
+
 
     //*************************************************************************
     TEST(test_swap)
@@ -70,6 +70,16 @@ struct hash3_t
   }
 };
 
+struct int_hash_t
+{
+  typedef int argument_type;
+
+  size_t operator ()(argument_type value) const
+  {
+    return size_t(value);
+  }
+};
+
 std::vector<const char*> exist_text     = { "The", "rain", "in", "Spain", "falls", "mainly", "on", "the", "plain" };
 std::vector<const char*> not_exist_text = { "My", "hovercraft", "is", "full", "of", "eels" };
 
@@ -260,6 +270,177 @@ namespace
 
       CHECK(!any_exist);
     }
+
+    //*************************************************************************
+    TEST(test_blocked_width)
+    {
+      typedef etl::blocked_bloom_filter<1000, 4, hash1_t> Bloom;
+      Bloom bloom;
+
+      CHECK_EQUAL(1024U, size_t(Bloom::WIDTH));
+      CHECK_EQUAL(1024U, bloom.width());
+      CHECK_EQUAL(2U,    size_t(Bloom::NUMBER_OF_BLOCKS));
+      CHECK_EQUAL(4U,    bloom.number_of_hashes());
+
+      typedef etl::blocked_bloom_filter<1, 1, hash1_t> Small;
+      CHECK_EQUAL(512U, size_t(Small::WIDTH));
+
+      typedef etl::blocked_bloom_filter<2561, 1, hash1_t> Large;
+      CHECK_EQUAL(4096U, size_t(Large::WIDTH));
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bloom_filter)
+    {
+      etl::blocked_bloom_filter<1024, 4, hash1_t> bloom;
+
+      CHECK_EQUAL(0U, bloom.count());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(bloom.exists(exist_text[i]));
+      }
+
+      // There should be no false positives for this set.
+      for (size_t i = 0; i < not_exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(not_exist_text[i]));
+      }
+
+      size_t count = bloom.count();
+      CHECK(count > exist_text.size());
+      CHECK(count <= (4U * exist_text.size()));
+      CHECK(bloom.usage() < 100);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_bits_per_key)
+    {
+      typedef etl::blocked_bloom_filter<8 * 512, 8, int_hash_t> Bloom;
+
+      for (int key = 0; key < 100; ++key)
+      {
+        Bloom bloom;
+        bloom.add(key);
+
+        // Each key sets at most 8 bits.
+        CHECK(bloom.count() >= 1U);
+        CHECK(bloom.count() <= 8U);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_no_false_negatives_and_rate)
+    {
+      typedef etl::blocked_bloom_filter<10000 * 10, 7, int_hash_t> Bloom;
+      Bloom bloom;
+
+      for (int key = 0; key < 10000; ++key)
+      {
+        bloom.add(key * 2);
+      }
+
+      for (int key = 0; key < 10000; ++key)
+      {
+        CHECK(bloom.exists(key * 2));
+      }
+
+      size_t false_positives = 0;
+
+      for (int key = 0; key < 100000; ++key)
+      {
+        if (bloom.exists(key * 2 + 1))
+        {
+          ++false_positives;
+        }
+      }
+
+      const double measured  = double(false_positives) / 100000.0;
+      const double estimated = bloom.false_positive_rate();
+
+      CHECK(estimated > 0.0);
+      CHECK(estimated < 0.01);
+      CHECK(measured < (3.0 * estimated + 0.001));
+      CHECK_CLOSE(double(bloom.count()) / double(Bloom::WIDTH), bloom.fill_ratio(), 1e-12);
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_batch_exists)
+    {
+      etl::blocked_bloom_filter<8192, 5, int_hash_t> bloom;
+
+      for (int key = 0; key < 200; key += 3)
+      {
+        bloom.add(key);
+      }
+
+      // Lengths either side of the prefetch depth.
+      for (int length = 0; length < 40; ++length)
+      {
+        std::vector<int>  keys;
+        std::vector<bool> expected;
+
+        for (int key = 0; key < length; ++key)
+        {
+          keys.push_back(key * 5);
+          expected.push_back(bloom.exists(key * 5));
+        }
+
+        bool results[40];
+        bool* end = bloom.exists(keys.begin(), keys.end(), results);
+
+        CHECK_EQUAL(size_t(length), size_t(end - results));
+
+        for (int i = 0; i < length; ++i)
+        {
+          CHECK_EQUAL(bool(expected[i]), results[i]);
+          if ((keys[i] % 3) == 0)
+          {
+            CHECK(results[i]);
+          }
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_blocked_copy_and_clear)
+    {
+      typedef etl::blocked_bloom_filter<2048, 3, hash1_t> Bloom;
+      Bloom bloom;
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        bloom.add(exist_text[i]);
+      }
+
+      Bloom copy(bloom);
+      CHECK_EQUAL(bloom.count(), copy.count());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(copy.exists(exist_text[i]));
+      }
+
+      bloom.clear();
+      CHECK_EQUAL(0U, bloom.count());
+      CHECK_EQUAL(0U, bloom.usage());
+      CHECK_EQUAL(0.0, bloom.fill_ratio());
+      CHECK_EQUAL(0.0, bloom.false_positive_rate());
+
+      for (size_t i = 0; i < exist_text.size(); ++i)
+      {
+        CHECK(!bloom.exists(exist_text[i]));
+      }
+
+      bloom = copy;
+      CHECK_EQUAL(copy.count(), bloom.count());
+      CHECK(bloom.exists(exist_text[0]));
+    }
   };
 }
 
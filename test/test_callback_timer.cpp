@@ -36,6 +36,7 @@ SOFTWARE.
 #include <vector>
 #include <thread>
 #include <chrono>
+#include <algorithm>
 
 #if defined(ETL_COMPILER_MICROSOFT)
 #include <Windows.h>
@@ -107,6 +108,30 @@ namespace
     free_tick_list2.push_back(ticks);
   }
 
+  //***************************************************************************
+  // Records which timer expired, for comparing the two schedulers.
+  //***************************************************************************
+  std::vector<int> expired[2];
+
+  template <const int CONTROLLER, const int TIMER>
+  void record_expiry()
+  {
+    expired[CONTROLLER].push_back(TIMER);
+  }
+
+  template <const int CONTROLLER, typename TController>
+  void register_recorded_timers(TController& controller, const uint32_t* periods, const bool* repeating)
+  {
+    controller.register_timer(record_expiry<CONTROLLER, 0>, periods[0], repeating[0]);
+    controller.register_timer(record_expiry<CONTROLLER, 1>, periods[1], repeating[1]);
+    controller.register_timer(record_expiry<CONTROLLER, 2>, periods[2], repeating[2]);
+    controller.register_timer(record_expiry<CONTROLLER, 3>, periods[3], repeating[3]);
+    controller.register_timer(record_expiry<CONTROLLER, 4>, periods[4], repeating[4]);
+    controller.register_timer(record_expiry<CONTROLLER, 5>, periods[5], repeating[5]);
+    controller.register_timer(record_expiry<CONTROLLER, 6>, periods[6], repeating[6]);
+    controller.register_timer(record_expiry<CONTROLLER, 7>, periods[7], repeating[7]);
+  }
+
   SUITE(test_callback_timer)
   {
     //=========================================================================
@@ -646,6 +671,167 @@ namespace
       CHECK_ARRAY_EQUAL(compare1.data(), free_tick_list1.data(), compare1.size());
     }
 
+    //=========================================================================
+    TEST(callback_timer_wheel_one_shot_and_repeating)
+    {
+      etl::callback_timer<3, etl::timer::scheduler::wheel> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(member_callback,        37, etl::timer::mode::SINGLE_SHOT);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_function_callback, 23, etl::timer::mode::REPEATING);
+      etl::timer::id::type id3 = timer_controller.register_timer(free_callback2,         11, etl::timer::mode::REPEATING);
+
+      test.tick_list.clear();
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.start(id3);
+      timer_controller.start(id2);
+
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      const uint32_t step = 1;
+
+      while (ticks <= 100U)
+      {
+        if (ticks == 50)
+        {
+          timer_controller.stop(id2);
+        }
+
+        ticks += step;
+        timer_controller.tick(step);
+      }
+
+      std::vector<uint64_t> compare1 = { 37 };
+      std::vector<uint64_t> compare2 = { 23, 46 };
+      std::vector<uint64_t> compare3 = { 11, 22, 33, 44, 55, 66, 77, 88, 99 };
+
+      CHECK_EQUAL(compare1.size(), test.tick_list.size());
+      CHECK_EQUAL(compare2.size(), free_tick_list1.size());
+      CHECK_EQUAL(compare3.size(), free_tick_list2.size());
+
+      CHECK_ARRAY_EQUAL(compare1.data(), test.tick_list.data(), compare1.size());
+      CHECK_ARRAY_EQUAL(compare2.data(), free_tick_list1.data(), compare2.size());
+      CHECK_ARRAY_EQUAL(compare3.data(), free_tick_list2.data(), compare3.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_long_periods_across_clock_wrap)
+    {
+      etl::callback_timer<2, etl::timer::scheduler::wheel> timer_controller;
+
+      etl::timer::id::type id1 = timer_controller.register_timer(free_callback1, 0xFFFFFFF0UL, etl::timer::mode::REPEATING);
+      etl::timer::id::type id2 = timer_controller.register_timer(free_callback2, 100,          etl::timer::mode::SINGLE_SHOT);
+
+      free_tick_list1.clear();
+      free_tick_list2.clear();
+
+      timer_controller.start(id1);
+      timer_controller.enable(true);
+
+      ticks = 0;
+
+      timer_controller.tick(0xFFFFFFEFUL);
+      CHECK_EQUAL(0U, free_tick_list1.size());
+
+      timer_controller.tick(1);
+      CHECK_EQUAL(1U, free_tick_list1.size());
+
+      // The internal clock wraps during this period.
+      timer_controller.start(id2);
+      timer_controller.tick(99);
+      CHECK_EQUAL(0U, free_tick_list2.size());
+      timer_controller.tick(1);
+      CHECK_EQUAL(1U, free_tick_list2.size());
+
+      timer_controller.tick(0xFFFFFFF0UL - 101);
+      CHECK_EQUAL(1U, free_tick_list1.size());
+
+      timer_controller.tick(1);
+      CHECK_EQUAL(2U, free_tick_list1.size());
+    }
+
+    //=========================================================================
+    TEST(callback_timer_wheel_matches_delta_list)
+    {
+      etl::callback_timer<8>                                list_controller;
+      etl::callback_timer<8, etl::timer::scheduler::wheel> wheel_controller;
+
+      const uint32_t periods[8]   = { 1, 7, 63, 64, 65, 300, 4096, 5000 };
+      const bool     repeating[8] = { true, true, false, true, true, false, true, true };
+
+      register_recorded_timers<0>(list_controller,  periods, repeating);
+      register_recorded_timers<1>(wheel_controller, periods, repeating);
+
+      list_controller.enable(true);
+      wheel_controller.enable(true);
+
+      uint32_t random = 12345U;
+      bool     all_equal = true;
+
+      for (int step = 0; step < 20000; ++step)
+      {
+        random = (random * 1103515245U) + 12345U;
+
+        const uint32_t value = random >> 8;
+        const etl::timer::id::type id = etl::timer::id::type(value % 8U);
+
+        expired[0].clear();
+        expired[1].clear();
+
+        switch ((value >> 3) % 8U)
+        {
+          case 0:
+          {
+            list_controller.start(id);
+            wheel_controller.start(id);
+            break;
+          }
+
+          case 1:
+          {
+            list_controller.start(id, etl::timer::start::IMMEDIATE);
+            wheel_controller.start(id, etl::timer::start::IMMEDIATE);
+            break;
+          }
+
+          case 2:
+          {
+            list_controller.stop(id);
+            wheel_controller.stop(id);
+            break;
+          }
+
+          case 3:
+          {
+            const uint32_t count = (value >> 6) % 20000U;
+            list_controller.tick(count);
+            wheel_controller.tick(count);
+            break;
+          }
+
+          default:
+          {
+            const uint32_t count = (value >> 6) % 8U;
+            list_controller.tick(count);
+            wheel_controller.tick(count);
+            break;
+          }
+        }
+
+        // Timers that expire on the same tick may be called in a different order.
+        std::sort(expired[0].begin(), expired[0].end());
+        std::sort(expired[1].begin(), expired[1].end());
+
+        all_equal = all_equal && (expired[0] == expired[1]);
+      }
+
+      CHECK(all_equal);
+    }
+
     //=========================================================================
 #if REALTIME_TEST
 
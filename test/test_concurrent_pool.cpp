@@ -0,0 +1,334 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <set>
+#include <atomic>
+
+#include "etl/concurrent_pool.h"
+#include "etl/list.h"
+
+namespace
+{
+  struct Item
+  {
+    Item()
+      : a(0),
+        b(0)
+    {
+    }
+
+    Item(int a_, int b_)
+      : a(a_),
+        b(b_)
+    {
+    }
+
+    int a;
+    int b;
+  };
+
+  const size_t SIZE = 64;
+
+  typedef etl::concurrent_pool<Item, SIZE>       Pool;
+  typedef etl::concurrent_pool<Item, SIZE, 8, 4> CachedPool;
+
+  //***********************************
+  template <typename TPool>
+  void check_allocate_release()
+  {
+    TPool pool;
+
+    CHECK(pool.empty());
+    CHECK(!pool.full());
+    CHECK_EQUAL(SIZE, pool.max_size());
+    CHECK_EQUAL(SIZE, pool.available());
+
+    std::set<Item*> items;
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+      Item* p = pool.template allocate<Item>();
+      CHECK(p != nullptr);
+      CHECK(pool.is_in_pool(p));
+      items.insert(p);
+      CHECK_EQUAL(i + 1, pool.size());
+    }
+
+    // Every item is distinct.
+    CHECK_EQUAL(SIZE, items.size());
+    CHECK(pool.full());
+    CHECK_EQUAL(0U, pool.available());
+    CHECK_THROW(pool.template allocate<Item>(), etl::pool_no_allocation);
+
+    size_t remaining = SIZE;
+
+    for (std::set<Item*>::iterator itr = items.begin(); itr != items.end(); ++itr)
+    {
+      pool.release(*itr);
+      --remaining;
+      CHECK_EQUAL(remaining, pool.size());
+    }
+
+    CHECK(pool.empty());
+
+    // Everything can be allocated again.
+    std::set<Item*> again;
+
+    for (size_t i = 0; i < SIZE; ++i)
+    {
+      again.insert(pool.template allocate<Item>());
+    }
+
+    CHECK(items == again);
+  }
+
+  SUITE(test_concurrent_pool)
+  {
+    //*************************************************************************
+    TEST(test_allocate_release)
+    {
+      check_allocate_release<Pool>();
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_release_cached)
+    {
+      check_allocate_release<CachedPool>();
+    }
+
+    //*************************************************************************
+    TEST(test_release_all)
+    {
+      CachedPool pool;
+
+      for (size_t i = 0; i < SIZE / 2; ++i)
+      {
+        pool.allocate<Item>();
+      }
+
+      pool.release(pool.allocate<Item>());
+
+      CHECK_EQUAL(SIZE / 2, pool.size());
+
+      pool.release_all();
+
+      CHECK(pool.empty());
+      CHECK_EQUAL(SIZE, pool.available());
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        CHECK(pool.allocate<Item>() != nullptr);
+      }
+
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    TEST(test_release_not_in_pool)
+    {
+      Pool pool;
+      Item not_in_pool;
+
+      CHECK_THROW(pool.release(&not_in_pool), etl::pool_object_not_in_pool);
+    }
+
+    //*************************************************************************
+    TEST(test_ipool_interface)
+    {
+      CachedPool pool;
+      etl::ipool& ip = pool;
+
+      Item* p = ip.create<Item>(1, 2);
+
+      CHECK_EQUAL(1, p->a);
+      CHECK_EQUAL(2, p->b);
+      CHECK_EQUAL(1U, ip.size());
+      CHECK(!ip.empty());
+
+      ip.destroy<Item>(p);
+
+      CHECK_EQUAL(0U, ip.size());
+      CHECK(ip.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_allocate_items_cached_by_another_thread)
+    {
+      CachedPool pool;
+
+      // Leave free items in another thread's cache.
+      std::thread other([&pool]
+      {
+        Item* items[6];
+
+        for (size_t i = 0; i < 6; ++i)
+        {
+          items[i] = pool.allocate<Item>();
+        }
+
+        for (size_t i = 0; i < 6; ++i)
+        {
+          pool.release(items[i]);
+        }
+      });
+
+      other.join();
+
+      CHECK(pool.empty());
+
+      std::set<Item*> items;
+
+      for (size_t i = 0; i < SIZE; ++i)
+      {
+        items.insert(pool.allocate<Item>());
+      }
+
+      CHECK_EQUAL(SIZE, items.size());
+      CHECK(pool.full());
+    }
+
+    //*************************************************************************
+    template <typename TPool>
+    void stress(size_t n_threads)
+    {
+      static TPool pool;
+      pool.release_all();
+
+      std::atomic<bool> failed(false);
+
+      struct worker
+      {
+        static void run(TPool& pool, int id, std::atomic<bool>& failed)
+        {
+          Item* held[8];
+
+          for (int round = 0; round < 5000; ++round)
+          {
+            size_t count = size_t(round % 8) + 1;
+            size_t got   = 0;
+
+            for (size_t i = 0; i < count; ++i)
+            {
+              held[got] = pool.template allocate<Item>();
+
+              held[got]->a = id;
+              held[got]->b = round;
+              ++got;
+            }
+
+            // Nobody else may have been given the same items.
+            for (size_t i = 0; i < got; ++i)
+            {
+              if ((held[i]->a != id) || (held[i]->b != round))
+              {
+                failed = true;
+              }
+
+              pool.release(held[i]);
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (size_t i = 0; i < n_threads; ++i)
+      {
+        threads.push_back(std::thread(worker::run, std::ref(pool), int(i), std::ref(failed)));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(!failed);
+      CHECK(pool.empty());
+      CHECK_EQUAL(SIZE, pool.available());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_stress)
+    {
+      // Enough items for every thread's largest burst.
+      stress<etl::concurrent_pool<Item, 8 * 8> >(8);
+      stress<etl::concurrent_pool<Item, 8 * 8, 4, 4> >(8);
+      stress<etl::concurrent_pool<Item, 8 * 8, 8, 16> >(8);
+    }
+
+    //*************************************************************************
+    TEST(test_shared_pool_lists_in_threads)
+    {
+      typedef etl::list<int, 0> List;
+      typedef etl::concurrent_pool<List::pool_type, 4 * 128, 16> ListPool;
+
+      static ListPool pool;
+
+      struct worker
+      {
+        static void run(ListPool& pool, int id)
+        {
+          List list(pool);
+
+          for (int round = 0; round < 200; ++round)
+          {
+            for (int i = 0; i < 100; ++i)
+            {
+              list.push_back(id * 1000 + i);
+            }
+
+            while (list.size() > size_t(round % 10))
+            {
+              list.pop_front();
+            }
+          }
+
+          list.clear();
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < 4; ++i)
+      {
+        threads.push_back(std::thread(worker::run, std::ref(pool), i));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      CHECK(pool.empty());
+    }
+  };
+}
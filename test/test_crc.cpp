@@ -39,10 +39,95 @@ SOFTWARE.
 #include "etl/crc16_kermit.h"
 #include "etl/crc16_modbus.h"
 #include "etl/crc32.h"
+#include "etl/crc32_c.h"
 #include "etl/crc64_ecma.h"
+#include "etl/crc_policy.h"
 
 namespace
 {
+  //***************************************************************************
+  // Checks that adding contiguous blocks, at every alignment and length and
+  // split at an arbitrary point, gives the same result as adding one value at
+  // a time.
+  //***************************************************************************
+  template <typename TCrc>
+  bool block_matches_values()
+  {
+    uint8_t data[300];
+
+    for (size_t i = 0; i < sizeof(data); ++i)
+    {
+      data[i] = uint8_t((i * 167) ^ (i >> 3));
+    }
+
+    for (size_t offset = 0; offset < 8; ++offset)
+    {
+      for (size_t length = 0; length <= (sizeof(data) - offset); ++length)
+      {
+        const uint8_t* begin = data + offset;
+        const uint8_t* end   = begin + length;
+
+        TCrc crc_values;
+
+        for (const uint8_t* p = begin; p != end; ++p)
+        {
+          crc_values.add(*p);
+        }
+
+        TCrc crc_block(begin, end);
+
+        TCrc crc_split;
+        crc_split.add(begin, begin + (length / 3));
+        crc_split.add(begin + (length / 3), end);
+
+        if ((crc_block.value() != crc_values.value()) || (crc_split.value() != crc_values.value()))
+        {
+          return false;
+        }
+      }
+    }
+
+    return true;
+  }
+
+  //***************************************************************************
+  // Calculates the CRC of the standard check string.
+  //***************************************************************************
+  template <typename TPolicy>
+  typename TPolicy::value_type check_value()
+  {
+    std::string data("123456789");
+
+    etl::crc_type<TPolicy> crc_values;
+
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+      crc_values.add(data[i]);
+    }
+
+    etl::crc_type<TPolicy> crc_block(data.data(), data.data() + data.size());
+
+    CHECK_EQUAL(crc_values.value(), crc_block.value());
+
+    return crc_block.value();
+  }
+
+  typedef etl::crc_policy<32U, 0x741B8CD7UL, 0xFFFFFFFFUL, true,  true,  0xFFFFFFFFUL>    crc32_k_policy;
+  typedef etl::crc_policy<32U, 0x741B8CD7UL, 0xFFFFFFFFUL, true,  true,  0xFFFFFFFFUL, 4> crc32_k_nibble_policy;
+  typedef etl::crc_policy<32U, 0x04C11DB7UL, 0xFFFFFFFFUL, false, false, 0xFFFFFFFFUL>    crc32_bzip2_policy;
+  typedef etl::crc_policy<16U, 0x1021U,      0xFFFFU,      false, false, 0x0000U>         crc16_ibm_3740_policy;
+  typedef etl::crc_policy<16U, 0x1021U,      0xFFFFU,      false, false, 0x0000U, 4>      crc16_ibm_3740_nibble_policy;
+  typedef etl::crc_policy<16U, 0x1021U,      0xB2AAU,      true,  true,  0x0000U>         crc16_riello_policy;
+  typedef etl::crc_policy<24U, 0x864CFBUL,   0xB704CEUL,   false, false, 0x000000UL>      crc24_openpgp_policy;
+  typedef etl::crc_policy<12U, 0x80FU,       0x000U,       false, true,  0x000U>          crc12_umts_policy;
+  typedef etl::crc_policy<12U, 0x80FU,       0x000U,       false, true,  0x000U, 4>       crc12_umts_nibble_policy;
+  typedef etl::crc_policy<5U,  0x05U,        0x1FU,        true,  true,  0x1FU>           crc5_usb_policy;
+  typedef etl::crc_policy<3U,  0x3U,         0x0U,         false, false, 0x7U>            crc3_gsm_policy;
+
+  typedef etl::crc_policy<8U,  0x07U,        0x00U,        false, false, 0x00U, 4>        crc8_ccitt_nibble_policy;
+  typedef etl::crc_policy<16U, 0x8005U,      0x0000U,      true,  true,  0x0000U, 4>      crc16_nibble_policy;
+  typedef etl::crc_policy<64U, 0x42F0E1EBA9EA3693ULL, 0ULL, false, false, 0ULL, 4>       crc64_ecma_nibble_policy;
+
   SUITE(test_crc)
   {
     //*************************************************************************
@@ -101,6 +186,12 @@ namespace
       CHECK_EQUAL(int(crc1), int(crc3));
     }
 
+    //*************************************************************************
+    TEST(test_crc8_ccitt_add_block)
+    {
+      CHECK(block_matches_values<etl::crc8_ccitt>());
+    }
+
     //*************************************************************************
     TEST(test_crc16)
     {
@@ -157,6 +248,12 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_add_block)
+    {
+      CHECK(block_matches_values<etl::crc16>());
+    }
+
     //*************************************************************************
     TEST(test_crc16_ccitt)
     {
@@ -213,6 +310,12 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_ccitt_add_block)
+    {
+      CHECK(block_matches_values<etl::crc16_ccitt>());
+    }
+
     //*************************************************************************
     TEST(test_crc16_kermit)
     {
@@ -269,6 +372,12 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_kermit_add_block)
+    {
+      CHECK(block_matches_values<etl::crc16_kermit>());
+    }
+
     //*************************************************************************
     TEST(test_crc16_modbus)
     {
@@ -325,6 +434,12 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc16_modbus_add_block)
+    {
+      CHECK(block_matches_values<etl::crc16_modbus>());
+    }
+
     //*************************************************************************
     TEST(test_crc32)
     {
@@ -382,6 +497,38 @@ namespace
       CHECK_EQUAL(crc1, crc3);
     }
 
+    //*************************************************************************
+    TEST(test_crc32_add_block)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(0xCBF43926, crc);
+      CHECK(block_matches_values<etl::crc32>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c(data.begin(), data.end());
+
+      CHECK_EQUAL(0xE3069283, crc);
+    }
+
+    //*************************************************************************
+    TEST(test_crc32_c_add_block)
+    {
+      std::string data("123456789");
+
+      uint32_t crc = etl::crc32_c(data.data(), data.data() + data.size());
+
+      CHECK_EQUAL(0xE3069283, crc);
+      CHECK(block_matches_values<etl::crc32_c>());
+    }
+
     //*************************************************************************
     TEST(test_crc64_ecma)
     {
@@ -437,6 +584,45 @@ namespace
       uint64_t crc3 = etl::crc64_ecma(data3.rbegin(), data3.rend());
       CHECK_EQUAL(crc1, crc3);
     }
+
+    //*************************************************************************
+    TEST(test_crc64_ecma_add_block)
+    {
+      CHECK(block_matches_values<etl::crc64_ecma>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_policy_check_values)
+    {
+      CHECK_EQUAL(0x2D3DD0AEUL,  check_value<crc32_k_policy>());
+      CHECK_EQUAL(0xFC891918UL,  check_value<crc32_bzip2_policy>());
+      CHECK_EQUAL(0x29B1U,       check_value<crc16_ibm_3740_policy>());
+      CHECK_EQUAL(0x63D0U,       check_value<crc16_riello_policy>());
+      CHECK_EQUAL(0x21CF02UL,    check_value<crc24_openpgp_policy>());
+      CHECK_EQUAL(0xDAFU,        check_value<crc12_umts_policy>());
+      CHECK_EQUAL(0x19U,         int(check_value<crc5_usb_policy>()));
+      CHECK_EQUAL(0x4U,          int(check_value<crc3_gsm_policy>()));
+    }
+
+    //*************************************************************************
+    TEST(test_crc_policy_nibble_tables)
+    {
+      CHECK_EQUAL(0x2D3DD0AEUL,           check_value<crc32_k_nibble_policy>());
+      CHECK_EQUAL(0x29B1U,                check_value<crc16_ibm_3740_nibble_policy>());
+      CHECK_EQUAL(0xDAFU,                 check_value<crc12_umts_nibble_policy>());
+      CHECK_EQUAL(0xF4U,                  int(check_value<crc8_ccitt_nibble_policy>()));
+      CHECK_EQUAL(0xBB3DU,                check_value<crc16_nibble_policy>());
+      CHECK_EQUAL(0x6C40DF5F0B497347ULL,  check_value<crc64_ecma_nibble_policy>());
+    }
+
+    //*************************************************************************
+    TEST(test_crc_policy_add_block)
+    {
+      CHECK(block_matches_values<etl::crc_type<crc32_k_policy> >());
+      CHECK(block_matches_values<etl::crc_type<crc32_k_nibble_policy> >());
+      CHECK(block_matches_values<etl::crc_type<crc24_openpgp_policy> >());
+      CHECK(block_matches_values<etl::crc_type<crc12_umts_policy> >());
+      CHECK(block_matches_values<etl::crc_type<crc5_usb_policy> >());
+    }
   };
 }
-
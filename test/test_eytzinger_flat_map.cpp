@@ -0,0 +1,232 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "etl/eytzinger_flat_map.h"
+
+namespace
+{
+  SUITE(test_eytzinger_flat_map)
+  {
+    static const size_t SIZE = 64;
+
+    typedef etl::flat_map<int, int, SIZE>           Map;
+    typedef etl::eytzinger_flat_map<int, int, SIZE> Index;
+    typedef etl::ieytzinger_flat_map<int, int>      IIndex;
+
+    //*************************************************************************
+    // Checks every lookup against the map, for keys in and around the map.
+    bool lookups_match(const Map& map, const IIndex& index, int first_key, int last_key)
+    {
+      for (int key = first_key; key <= last_key; ++key)
+      {
+        Map::const_iterator itr = map.find(key);
+        const Map::value_type* expected = (itr == map.end()) ? nullptr : &*itr;
+
+        if (index.find(key) != expected)
+        {
+          return false;
+        }
+
+        itr = map.lower_bound(key);
+        expected = (itr == map.end()) ? nullptr : &*itr;
+
+        if (index.lower_bound(key) != expected)
+        {
+          return false;
+        }
+
+        itr = map.upper_bound(key);
+        expected = (itr == map.end()) ? nullptr : &*itr;
+
+        if (index.upper_bound(key) != expected)
+        {
+          return false;
+        }
+
+        if (index.count(key) != map.count(key))
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Index index;
+
+      CHECK(index.empty());
+      CHECK_EQUAL(0U, index.size());
+      CHECK_EQUAL(SIZE, index.max_size());
+      CHECK_EQUAL(SIZE, index.capacity());
+      CHECK(index.find(0) == nullptr);
+      CHECK(index.lower_bound(0) == nullptr);
+      CHECK(index.upper_bound(0) == nullptr);
+      CHECK_EQUAL(0U, index.count(0));
+    }
+
+    //*************************************************************************
+    TEST(test_lookups_all_sizes)
+    {
+      Map map;
+
+      // Every size, so that every shape of the last level of the tree is tested.
+      for (int size = 0; size <= int(SIZE); ++size)
+      {
+        map.clear();
+
+        for (int i = 0; i < size; ++i)
+        {
+          map.insert(Map::value_type(i * 2, i));
+        }
+
+        Index index(map);
+
+        CHECK_EQUAL(map.size(), index.size());
+        CHECK(lookups_match(map, index, -2, (size * 2) + 1));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_find_mapped_value)
+    {
+      Map map;
+
+      for (int i = 0; i < 10; ++i)
+      {
+        map.insert(Map::value_type(i, i * 10));
+      }
+
+      Index index(map);
+
+      CHECK_EQUAL(50, index.find(5)->second);
+      CHECK(index.find(5) == &*map.find(5));
+      CHECK(index.find(10) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_assign_after_modification)
+    {
+      Map map;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        map.insert(Map::value_type(i, i));
+      }
+
+      Index index(map);
+
+      map.erase(5);
+      map.insert(Map::value_type(100, 100));
+
+      index.assign(map);
+
+      CHECK_EQUAL(map.size(), index.size());
+      CHECK(lookups_match(map, index, -1, 101));
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      Map map;
+      map.insert(Map::value_type(1, 1));
+
+      Index index(map);
+      index.clear();
+
+      CHECK(index.empty());
+      CHECK(index.find(1) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_from_reference_flat_map)
+    {
+      typedef etl::reference_flat_map<int, int, SIZE> RefMap;
+
+      RefMap::value_type elements[] = { RefMap::value_type(3, 30), RefMap::value_type(1, 10), RefMap::value_type(2, 20) };
+
+      RefMap map(std::begin(elements), std::end(elements));
+      Index index(map);
+
+      CHECK_EQUAL(3U, index.size());
+      CHECK(index.find(1) == &elements[1]);
+      CHECK(index.find(2) == &elements[2]);
+      CHECK(index.find(3) == &elements[0]);
+      CHECK(index.find(4) == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_string_keys_and_compare)
+    {
+      typedef etl::flat_map<std::string, int, 8, std::greater<std::string> >           StringMap;
+      typedef etl::eytzinger_flat_map<std::string, int, 8, std::greater<std::string> > StringIndex;
+
+      StringMap map;
+      map.insert(StringMap::value_type("b", 2));
+      map.insert(StringMap::value_type("d", 4));
+      map.insert(StringMap::value_type("a", 1));
+      map.insert(StringMap::value_type("c", 3));
+
+      StringIndex index(map);
+
+      CHECK_EQUAL(3, index.find("c")->second);
+      CHECK(index.find("e") == nullptr);
+
+      // Keys are in descending order.
+      CHECK_EQUAL(2, index.lower_bound("bb")->second);
+      CHECK_EQUAL(1, index.upper_bound("b")->second);
+      CHECK(index.upper_bound("a") == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_too_large)
+    {
+      typedef etl::eytzinger_flat_map<int, int, 4> SmallIndex;
+
+      Map map;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        map.insert(Map::value_type(i, i));
+      }
+
+      SmallIndex index;
+
+      CHECK_THROW(index.assign(map), etl::eytzinger_flat_map_full);
+    }
+  };
+}
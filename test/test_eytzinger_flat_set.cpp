@@ -0,0 +1,122 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <string>
+
+#include "etl/eytzinger_flat_set.h"
+
+namespace
+{
+  SUITE(test_eytzinger_flat_set)
+  {
+    static const size_t SIZE = 64;
+
+    typedef etl::flat_set<int, SIZE>           Set;
+    typedef etl::eytzinger_flat_set<int, SIZE> Index;
+
+    //*************************************************************************
+    TEST(test_default_constructor)
+    {
+      Index index;
+
+      CHECK(index.empty());
+      CHECK_EQUAL(SIZE, index.max_size());
+      CHECK(index.find(0) == nullptr);
+      CHECK_EQUAL(0U, index.count(0));
+    }
+
+    //*************************************************************************
+    TEST(test_lookups_all_sizes)
+    {
+      Set set;
+
+      for (int size = 0; size <= int(SIZE); ++size)
+      {
+        set.clear();
+
+        for (int i = 0; i < size; ++i)
+        {
+          set.insert(i * 2);
+        }
+
+        Index index(set);
+
+        CHECK_EQUAL(set.size(), index.size());
+
+        for (int key = -2; key <= ((size * 2) + 1); ++key)
+        {
+          Set::const_iterator itr = set.lower_bound(key);
+          CHECK(index.lower_bound(key) == ((itr == set.end()) ? nullptr : &*itr));
+
+          itr = set.upper_bound(key);
+          CHECK(index.upper_bound(key) == ((itr == set.end()) ? nullptr : &*itr));
+
+          itr = set.find(key);
+          CHECK(index.find(key) == ((itr == set.end()) ? nullptr : &*itr));
+          CHECK_EQUAL(set.count(key), index.count(key));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_from_reference_flat_set)
+    {
+      typedef etl::reference_flat_set<std::string, SIZE> RefSet;
+      typedef etl::eytzinger_flat_set<std::string, SIZE> StringIndex;
+
+      std::string elements[] = { "c", "a", "b" };
+
+      RefSet set(std::begin(elements), std::end(elements));
+      StringIndex index(set);
+
+      CHECK_EQUAL(3U, index.size());
+      CHECK(index.find("a") == &elements[1]);
+      CHECK(index.find("b") == &elements[2]);
+      CHECK(index.find("c") == &elements[0]);
+      CHECK(index.find("d") == nullptr);
+    }
+
+    //*************************************************************************
+    TEST(test_too_large)
+    {
+      Set set;
+
+      for (int i = 0; i < 5; ++i)
+      {
+        set.insert(i);
+      }
+
+      etl::eytzinger_flat_set<int, 4> index;
+
+      CHECK_THROW(index.assign(set), etl::eytzinger_flat_set_full);
+    }
+  };
+}
@@ -741,6 +741,74 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      const ElementInt initial[] = { ElementInt(2, 0), ElementInt(6, 0), ElementInt(4, 0) };
+      const ElementInt extra[]   = { ElementInt(5, 1), ElementInt(1, 1), ElementInt(6, 1), ElementInt(3, 1),
+                                     ElementInt(1, 2), ElementInt(9, 1), ElementInt(0, 1) };
+
+      DataInt data(std::begin(initial), std::end(initial));
+      std::map<int, int> compare_data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_duplicates_when_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE - 2); ++i)
+      {
+        data.insert(ElementInt(i, i));
+      }
+
+      // Two new keys fill the map. The rest are already present.
+      const ElementInt extra[] = { ElementInt(20, 20), ElementInt(3, 99), ElementInt(21, 21), ElementInt(0, 99), ElementInt(7, 99) };
+
+      CHECK_NO_THROW(data.insert(std::begin(extra), std::end(extra)));
+
+      CHECK(data.full());
+      CHECK_EQUAL(3, data.at(3));
+      CHECK_EQUAL(0, data.at(0));
+      CHECK_EQUAL(7, data.at(7));
+      CHECK_EQUAL(20, data.at(20));
+      CHECK_EQUAL(21, data.at(21));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_random)
+    {
+      etl::flat_map<int, int, 400> data;
+      std::map<int, int> compare_data;
+      std::vector<ElementInt> batch;
+
+      unsigned int seed = 1U;
+
+      // Batches of random keys, merged with the keys already present.
+      for (int size = 1; size <= 300; size *= 3)
+      {
+        batch.clear();
+
+        for (int i = 0; i < size; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          batch.push_back(ElementInt(int((seed >> 8) % 2000U), i));
+        }
+
+        data.insert(batch.begin(), batch.end());
+        compare_data.insert(batch.begin(), batch.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
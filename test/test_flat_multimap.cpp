@@ -550,6 +550,53 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      const ElementInt initial[] = { ElementInt(2, 0), ElementInt(1, 0), ElementInt(4, 0) };
+      const ElementInt extra[]   = { ElementInt(1, 1), ElementInt(0, 1), ElementInt(4, 1), ElementInt(1, 2),
+                                     ElementInt(3, 1), ElementInt(2, 1), ElementInt(1, 3) };
+
+      DataInt data(std::begin(initial), std::end(initial));
+      std::multimap<int, int> compare_data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      // Equal keys are after the existing ones, in the order of the range.
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_random)
+    {
+      etl::flat_multimap<int, int, 400> data;
+      std::multimap<int, int> compare_data;
+      std::vector<ElementInt> batch;
+
+      unsigned int seed = 1U;
+      int index = 0;
+
+      // Batches of random keys, merged with the keys already present.
+      for (int size = 1; size <= 300; size *= 3)
+      {
+        batch.clear();
+
+        for (int i = 0; i < size; ++i)
+        {
+          seed = (seed * 1103515245U) + 12345U;
+          batch.push_back(ElementInt(int((seed >> 8) % 50U), index++));
+        }
+
+        data.insert(batch.begin(), batch.end());
+        compare_data.insert(batch.begin(), batch.end());
+
+        CHECK_EQUAL(compare_data.size(), data.size());
+        CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -513,6 +513,22 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      const int initial[] = { 2, 6, 4 };
+      const int extra[]   = { 5, 1, 6, 3, 1, 4, 0 };
+
+      DataInt data(std::begin(initial), std::end(initial));
+      std::multiset<int> compare_data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
@@ -521,6 +521,43 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      const int initial[] = { 2, 6, 4 };
+      const int extra[]   = { 5, 1, 6, 3, 1, 9, 0 };
+
+      DataInt data(std::begin(initial), std::end(initial));
+      std::set<int> compare_data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
+    //*************************************************************************
+    TEST(test_insert_range_duplicates_when_full)
+    {
+      DataInt data;
+
+      for (int i = 0; i < int(SIZE - 2); ++i)
+      {
+        data.insert(i);
+      }
+
+      // Two new values fill the set. The rest are already present.
+      const int extra[] = { 20, 3, 21, 0, 7 };
+
+      CHECK_NO_THROW(data.insert(std::begin(extra), std::end(extra)));
+
+      CHECK(data.full());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+      CHECK_EQUAL(1U, data.count(20));
+      CHECK_EQUAL(1U, data.count(21));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_emplace_value1)
     {
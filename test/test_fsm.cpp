@@ -331,6 +331,106 @@ namespace
 
   MotorControl motorControl;
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03) && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  // Events for states with more than 16 event types.
+  //***************************************************************************
+  template <size_t ID_>
+  struct NumberedEvent : public etl::message<ID_>
+  {
+  };
+
+  //***********************************
+  // An FSM that counts each event it receives.
+  //***********************************
+  class WideFsm : public etl::fsm
+  {
+  public:
+
+    WideFsm()
+      : fsm(1),
+        unknown_count(0)
+    {
+      for (size_t i = 0; i < 256; ++i)
+      {
+        count[i] = 0;
+      }
+    }
+
+    int count[256];
+    int unknown_count;
+  };
+
+  //***********************************
+  // A state that counts each event it receives.
+  // Event LAST_ID changes to NEXT_STATE_ID.
+  //***********************************
+  template <typename TDerived, etl::fsm_state_id_t STATE_ID_, etl::fsm_state_id_t NEXT_STATE_ID, size_t LAST_ID, typename... TEvents>
+  class CountingState : public etl::fsm_state<WideFsm, TDerived, STATE_ID_, TEvents...>
+  {
+  public:
+
+    template <size_t ID_>
+    etl::fsm_state_id_t on_event(etl::imessage_router&, const NumberedEvent<ID_>&)
+    {
+      ++this->get_fsm_context().count[ID_];
+      return (ID_ == LAST_ID) ? NEXT_STATE_ID : STATE_ID_;
+    }
+
+    etl::fsm_state_id_t on_event_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++this->get_fsm_context().unknown_count;
+      return STATE_ID_;
+    }
+
+    static bool accepts_id(size_t id)
+    {
+      const size_t ids[] = { TEvents::ID... };
+
+      for (size_t i = 0; i < sizeof...(TEvents); ++i)
+      {
+        if (ids[i] == id)
+        {
+          return true;
+        }
+      }
+
+      return false;
+    }
+
+    // Sends one of each of the state's events, except the last.
+    static void send_each(etl::imessage_router& router)
+    {
+      int dummy[] = { ((TEvents::ID != LAST_ID) ? router.receive(TEvents()) : void(), 0)... };
+      (void)dummy;
+    }
+  };
+
+  //***********************************
+  // 20 events with dense IDs, 10 to 29.
+  //***********************************
+  class DenseState : public CountingState<DenseState, 0, 1, 29,
+                                          NumberedEvent<10>, NumberedEvent<11>, NumberedEvent<12>, NumberedEvent<13>,
+                                          NumberedEvent<14>, NumberedEvent<15>, NumberedEvent<16>, NumberedEvent<17>,
+                                          NumberedEvent<18>, NumberedEvent<19>, NumberedEvent<20>, NumberedEvent<21>,
+                                          NumberedEvent<22>, NumberedEvent<23>, NumberedEvent<24>, NumberedEvent<25>,
+                                          NumberedEvent<26>, NumberedEvent<27>, NumberedEvent<28>, NumberedEvent<29> >
+  {
+  };
+
+  //***********************************
+  // 18 events with sparse IDs.
+  //***********************************
+  class SparseState : public CountingState<SparseState, 1, 0, 255,
+                                           NumberedEvent<1>,   NumberedEvent<7>,   NumberedEvent<37>,  NumberedEvent<64>,
+                                           NumberedEvent<90>,  NumberedEvent<91>,  NumberedEvent<100>, NumberedEvent<128>,
+                                           NumberedEvent<144>, NumberedEvent<160>, NumberedEvent<180>, NumberedEvent<199>,
+                                           NumberedEvent<201>, NumberedEvent<222>, NumberedEvent<230>, NumberedEvent<240>,
+                                           NumberedEvent<250>, NumberedEvent<255> >
+  {
+  };
+#endif
+
   SUITE(test_map)
   {
     //*************************************************************************
@@ -574,5 +674,107 @@ namespace
       CHECK(motorControl.accepts(Stopped()));
       CHECK(motorControl.accepts(Unsupported()));
     }
+
+#if defined(ETL_FSM_TRACE)
+    //*************************************************************************
+    TEST(test_fsm_trace)
+    {
+      etl::null_message_router nmr;
+      etl::fsm_trace<4> trace;
+
+      motorControl.Initialise(stateList, etl::size(stateList));
+      motorControl.reset();
+      motorControl.ClearStatistics();
+      motorControl.start(false);
+      motorControl.set_trace(trace);
+
+      motorControl.receive(nmr, Start());
+      motorControl.receive(nmr, SetSpeed(100));
+      motorControl.receive(nmr, Stop(true));
+      motorControl.receive(nmr, Start());
+      motorControl.receive(nmr, Start()); // Dropped.
+
+      motorControl.clear_trace();
+      motorControl.receive(nmr, Start()); // Not traced.
+
+      CHECK_EQUAL(1U, trace.dropped_count());
+
+      const int expected[4][3] =
+      {
+        { StateId::IDLE,    EventId::START,     StateId::RUNNING },
+        { StateId::RUNNING, EventId::SET_SPEED, StateId::RUNNING },
+        { StateId::RUNNING, EventId::STOP,      StateId::LOCKED  }, // Via Idle.
+        { StateId::LOCKED,  EventId::START,     StateId::LOCKED  }
+      };
+
+      etl::fsm_trace_record trace_record;
+
+      for (size_t i = 0; i < 4; ++i)
+      {
+        CHECK(trace.pop(trace_record));
+        CHECK_EQUAL(expected[i][0], int(trace_record.state_id));
+        CHECK_EQUAL(expected[i][1], int(trace_record.event_id));
+        CHECK_EQUAL(expected[i][2], int(trace_record.next_state_id));
+      }
+
+      CHECK(!trace.pop(trace_record));
+    }
+#endif
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_FSM_FORCE_CPP03) && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+    //*************************************************************************
+    TEST(test_fsm_many_events)
+    {
+      DenseState  dense;
+      SparseState sparse;
+
+      etl::ifsm_state* states[] = { &dense, &sparse };
+
+      WideFsm wide;
+      wide.set_states(states, 2);
+      wide.start();
+
+      // Every dense event.
+      DenseState::send_each(wide);
+
+      for (size_t id = 10; id <= 28; ++id)
+      {
+        CHECK_EQUAL(1, wide.count[id]);
+      }
+
+      // The IDs either side.
+      wide.receive(etl::imessage(etl::message_id_t(9)));
+      wide.receive(etl::imessage(etl::message_id_t(30)));
+      CHECK_EQUAL(0, int(wide.get_state_id()));
+      CHECK_EQUAL(2, wide.unknown_count);
+
+      wide.receive(NumberedEvent<29>());
+      CHECK_EQUAL(1, int(wide.get_state_id()));
+
+      // Every sparse event.
+      SparseState::send_each(wide);
+
+      for (size_t id = 0; id <= 254; ++id)
+      {
+        CHECK_EQUAL((id >= 10) && (id <= 29) ? 1 : 0, wide.count[id] - (SparseState::accepts_id(id) ? 1 : 0));
+      }
+
+      // Every other ID is unknown.
+      for (size_t id = 0; id <= 255; ++id)
+      {
+        if (!SparseState::accepts_id(id))
+        {
+          wide.receive(etl::imessage(etl::message_id_t(id)));
+        }
+      }
+
+      CHECK_EQUAL(1, int(wide.get_state_id()));
+      CHECK_EQUAL(2 + (256 - 18), wide.unknown_count);
+
+      wide.receive(NumberedEvent<255>());
+      CHECK_EQUAL(0, int(wide.get_state_id()));
+      CHECK_EQUAL(1, wide.count[255]);
+    }
+#endif
   };
 }
@@ -31,9 +31,37 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <random>
+#include <set>
+#include <cstdio>
 #include <stdint.h>
 
 #include "etl/hash.h"
+#include "etl/cstring.h"
+#include "etl/string_view.h"
+
+namespace
+{
+  //***************************************************************************
+  uint64_t wyhash(const std::vector<uint8_t>& data)
+  {
+    return etl::private_wyhash::hash(data.data(), data.data() + data.size());
+  }
+
+  //***************************************************************************
+  int count_bits(uint64_t value)
+  {
+    int count = 0;
+
+    while (value != 0U)
+    {
+      value &= value - 1U;
+      ++count;
+    }
+
+    return count;
+  }
+}
 
 namespace
 {
@@ -213,6 +241,173 @@ namespace
 
       CHECK_EQUAL(size_t(&i), hash);
     }
+
+    //*************************************************************************
+    TEST(test_hash_string)
+    {
+      etl::string<64> text("The quick brown fox jumps over the lazy dog");
+
+      size_t hash      = etl::hash<etl::istring>()(text);
+      size_t view_hash = etl::hash<etl::string_view>()(etl::string_view(text.data(), text.size()));
+
+      CHECK_EQUAL(hash, view_hash);
+
+#if defined(ETL_HASH_USE_WYHASH)
+      if (ETL_PLATFORM_32BIT)
+      {
+        CHECK_EQUAL(0x189FF058U, hash);
+      }
+
+      if (ETL_PLATFORM_64BIT)
+      {
+        CHECK_EQUAL(0x08E445DF107BB587U, hash);
+      }
+#else
+      if (ETL_PLATFORM_32BIT)
+      {
+        CHECK_EQUAL(0x048FFF90U, hash);
+      }
+
+      if (ETL_PLATFORM_64BIT)
+      {
+        CHECK_EQUAL(0xF3F9B7F5E7E47110U, hash);
+      }
+#endif
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_all_lengths)
+    {
+      std::mt19937 generator(1);
+
+      std::set<uint64_t> hashes;
+
+      // Each key in a vector of exactly its size, so that reads past the end are caught by sanitizers.
+      for (size_t length = 0U; length <= 200U; ++length)
+      {
+        std::vector<uint8_t> data(length);
+
+        for (size_t i = 0U; i < length; ++i)
+        {
+          data[i] = uint8_t(generator());
+        }
+
+        hashes.insert(wyhash(data));
+
+        // Different seeds give different values.
+        CHECK(etl::private_wyhash::hash(data.data(), data.data() + length, 1U) != etl::private_wyhash::hash(data.data(), data.data() + length, 2U));
+      }
+
+      CHECK_EQUAL(201U, hashes.size());
+
+      // Zero bytes of different lengths are different keys.
+      CHECK(wyhash(std::vector<uint8_t>(1U, 0U)) != wyhash(std::vector<uint8_t>(2U, 0U)));
+      CHECK(wyhash(std::vector<uint8_t>(16U, 0U)) != wyhash(std::vector<uint8_t>(17U, 0U)));
+      CHECK(wyhash(std::vector<uint8_t>()) != wyhash(std::vector<uint8_t>(1U, 0U)));
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_avalanche)
+    {
+      std::mt19937 generator(2);
+
+      const size_t lengths[] = { 1, 3, 4, 7, 8, 15, 16, 17, 31, 48, 64, 100 };
+
+      for (size_t l = 0U; l < (sizeof(lengths) / sizeof(lengths[0])); ++l)
+      {
+        const size_t length = lengths[l];
+
+        // How often each output bit changes when one input bit changes.
+        std::vector<int> flips(64, 0);
+        int trials = 0;
+        int changed_bits = 0;
+
+        // At least 4000 trials, for a standard deviation of less than 0.008.
+        const int samples = int(500U / length) + 10;
+
+        for (int sample = 0; sample < samples; ++sample)
+        {
+          std::vector<uint8_t> data(length);
+
+          for (size_t i = 0U; i < length; ++i)
+          {
+            data[i] = uint8_t(generator());
+          }
+
+          const uint64_t original = wyhash(data);
+
+          for (size_t bit = 0U; bit < (length * 8U); ++bit)
+          {
+            data[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+            const uint64_t changed = original ^ wyhash(data);
+            data[bit / 8U] ^= uint8_t(1U << (bit % 8U));
+
+            changed_bits += count_bits(changed);
+
+            for (int b = 0; b < 64; ++b)
+            {
+              flips[b] += int((changed >> b) & 1U);
+            }
+
+            ++trials;
+          }
+        }
+
+        // Half of the output bits should change on average.
+        const double average = double(changed_bits) / trials;
+
+        CHECK(average > 31.0);
+        CHECK(average < 33.0);
+
+        // Each output bit should change half of the time.
+        for (int b = 0; b < 64; ++b)
+        {
+          const double probability = double(flips[b]) / trials;
+
+          CHECK(probability > 0.45);
+          CHECK(probability < 0.55);
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_wyhash_bucket_distribution)
+    {
+      const size_t KEYS    = 100000U;
+      const size_t BUCKETS = 1024U;
+
+      // Similar keys, as found in real tables.
+      std::vector<int> low_buckets(BUCKETS, 0);
+      std::vector<int> high_buckets(BUCKETS, 0);
+
+      char text[32];
+
+      for (size_t i = 0U; i < KEYS; ++i)
+      {
+        const int length = snprintf(text, sizeof(text), "sensor/%u/value", unsigned(i));
+
+        const uint64_t h = etl::private_wyhash::hash(reinterpret_cast<const uint8_t*>(text), reinterpret_cast<const uint8_t*>(text) + length);
+
+        ++low_buckets[h % BUCKETS];
+        ++high_buckets[h >> 54];
+      }
+
+      // Chi squared, with 1023 degrees of freedom. The mean is 1023 and the standard deviation about 45.
+      const double expected = double(KEYS) / BUCKETS;
+
+      double low_chi_squared  = 0.0;
+      double high_chi_squared = 0.0;
+
+      for (size_t i = 0U; i < BUCKETS; ++i)
+      {
+        low_chi_squared  += ((low_buckets[i]  - expected) * (low_buckets[i]  - expected)) / expected;
+        high_chi_squared += ((high_buckets[i] - expected) * (high_buckets[i] - expected)) / expected;
+      }
+
+      CHECK(low_chi_squared  < 1300.0);
+      CHECK(high_chi_squared < 1300.0);
+      CHECK(low_chi_squared  > 750.0);
+      CHECK(high_chi_squared > 750.0);
+    }
   };
 }
-
@@ -781,6 +781,43 @@ namespace
       CHECK(are_equal);
     }
 
+
+    //*************************************************************************
+    TEST(test_sort_many_is_stable)
+    {
+      const size_t MANY = 1000;
+
+      InitialDataNDC nodes;
+
+      for (size_t i = 0; i < MANY; ++i)
+      {
+        nodes.push_back(ItemNDCNode(std::to_string((i * 7) % 13), int(i)));
+      }
+
+      InitialDataNDC compare_data(nodes);
+      std::stable_sort(compare_data.begin(), compare_data.end());
+
+      DataNDC0 data0(nodes.begin(), nodes.end());
+      DataNDC1 data1(nodes.begin(), nodes.end());
+
+      data0.sort(); // Just sort one of them.
+
+      CHECK_EQUAL(MANY, size_t(std::distance(data0.begin(), data0.end())));
+
+      InitialDataNDC::const_iterator citr = compare_data.begin();
+      DataNDC0::const_iterator ditr = data0.begin();
+
+      while (ditr != data0.end())
+      {
+        CHECK_EQUAL(citr->data.index, ditr->data.index);
+
+        ++citr;
+        ++ditr;
+      }
+
+      bool are_equal = std::equal(data1.begin(), data1.end(), nodes.begin());
+      CHECK(are_equal);
+    }
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_splice_list)
     {
@@ -1265,6 +1265,49 @@ namespace
       CHECK(are_equal);
     }
 
+
+    //*************************************************************************
+    TEST(test_sort_many_is_stable)
+    {
+      const size_t MANY = 1000;
+
+      std::vector<ItemNDC> compare_data;
+
+      for (size_t i = 0; i < MANY; ++i)
+      {
+        compare_data.push_back(ItemNDC(std::to_string((i * 7) % 13), int(i)));
+      }
+
+      etl::list<ItemNDC, MANY> data(compare_data.begin(), compare_data.end());
+
+      std::stable_sort(compare_data.begin(), compare_data.end());
+      data.sort();
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+
+      // Check both directions, to test the previous links.
+      std::vector<ItemNDC>::const_iterator citr = compare_data.begin();
+      etl::list<ItemNDC, MANY>::const_iterator ditr = data.begin();
+
+      while (ditr != data.end())
+      {
+        CHECK_EQUAL(citr->index, ditr->index);
+
+        ++citr;
+        ++ditr;
+      }
+
+      std::vector<ItemNDC>::const_reverse_iterator rcitr = compare_data.rbegin();
+      etl::list<ItemNDC, MANY>::const_reverse_iterator rditr = data.rbegin();
+
+      while (rditr != data.rend())
+      {
+        CHECK_EQUAL(rcitr->index, rditr->index);
+
+        ++rcitr;
+        ++rditr;
+      }
+    }
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_splice_same)
     {
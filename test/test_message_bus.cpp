@@ -35,6 +35,9 @@ SOFTWARE.
 #include "etl/largest.h"
 #include "etl/packet.h"
 
+#include <deque>
+#include <vector>
+
 //***************************************************************************
 // The set of messages.
 //***************************************************************************
@@ -722,5 +725,199 @@ namespace
       CHECK_EQUAL(3, router4a.order);
       CHECK_EQUAL(4, router3.order);
     }
+
+    //=========================================================================
+    TEST(message_bus_broadcast_indexed)
+    {
+      etl::message_bus<2, 3> bus1;
+
+      RouterA router1(ROUTER1);
+      RouterB router2(ROUTER2);
+      RouterA sender(ROUTER3);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(router2);
+
+      bus1.receive(sender, message1);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(0, router1.message2_count);
+      CHECK_EQUAL(0, router1.message3_count);
+      CHECK_EQUAL(0, router1.message4_count);
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(0, router2.message2_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(2, sender.message5_count);
+
+      bus1.receive(sender, message2);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(0, router1.message3_count);
+      CHECK_EQUAL(0, router1.message4_count);
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message2_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(4, sender.message5_count);
+
+      bus1.receive(sender, message3);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(0, router1.message4_count);
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message2_count);
+      CHECK_EQUAL(0, router2.message4_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(5, sender.message5_count);
+
+      // Use global function.
+      etl::send_message(sender, bus1, message4);
+
+      CHECK_EQUAL(1, router1.message1_count);
+      CHECK_EQUAL(1, router1.message2_count);
+      CHECK_EQUAL(1, router1.message3_count);
+      CHECK_EQUAL(1, router1.message4_count);
+      CHECK_EQUAL(0, router1.message5_count);
+      CHECK_EQUAL(0, router1.message_unknown_count);
+
+      CHECK_EQUAL(1, router2.message1_count);
+      CHECK_EQUAL(1, router2.message2_count);
+      CHECK_EQUAL(1, router2.message4_count);
+      CHECK_EQUAL(0, router2.message5_count);
+      CHECK_EQUAL(0, router2.message_unknown_count);
+
+      CHECK_EQUAL(7, sender.message5_count);
+    }
+
+    //=========================================================================
+    TEST(message_bus_broadcast_order_indexed)
+    {
+      etl::message_bus<4, 5> bus1;
+      etl::message_bus<2> bus2;
+      etl::message_bus<2, 5> bus3;
+
+      RouterA router1(ROUTER1);
+      RouterA router2(ROUTER2);
+      RouterA router3(ROUTER3);
+      RouterA router4a(ROUTER4);
+      RouterA router4b(ROUTER4);
+
+      RouterA sender(ROUTER5);
+
+      bus1.subscribe(router1);
+      bus1.subscribe(bus3);
+      bus1.subscribe(bus2);
+      bus1.subscribe(router2);
+
+      bus2.subscribe(router3);
+      bus3.subscribe(router4b);
+      bus3.subscribe(router4a);
+
+      call_order = 0;
+
+      bus1.receive(sender, message1);
+
+      CHECK_EQUAL(0, router1.order);
+      CHECK_EQUAL(1, router2.order);
+      CHECK_EQUAL(2, router4b.order);
+      CHECK_EQUAL(3, router4a.order);
+      CHECK_EQUAL(4, router3.order);
+    }
+
+    //=========================================================================
+    TEST(message_bus_broadcast_indexed_many_routers)
+    {
+      // More than 32 routers, so that the index has more than one word per message id.
+      // Message ids 3 and 4 are not indexed.
+      etl::message_bus<40>    plain_bus;
+      etl::message_bus<40, 3> indexed_bus;
+
+      std::deque<RouterA> plain_a;
+      std::deque<RouterB> plain_b;
+      std::deque<RouterA> indexed_a;
+      std::deque<RouterB> indexed_b;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        const etl::message_router_id_t id = etl::message_router_id_t((i * 7) % 11);
+
+        plain_a.emplace_back(id);
+        plain_b.emplace_back(id + 1);
+        indexed_a.emplace_back(id);
+        indexed_b.emplace_back(id + 1);
+      }
+
+      for (int i = 0; i < 20; ++i)
+      {
+        plain_bus.subscribe(plain_a[i]);
+        plain_bus.subscribe(plain_b[i]);
+        indexed_bus.subscribe(indexed_a[i]);
+        indexed_bus.subscribe(indexed_b[i]);
+      }
+
+      plain_bus.unsubscribe(plain_a[3]);
+      plain_bus.unsubscribe(plain_b[17]);
+      plain_bus.unsubscribe(5);
+      indexed_bus.unsubscribe(indexed_a[3]);
+      indexed_bus.unsubscribe(indexed_b[17]);
+      indexed_bus.unsubscribe(5);
+
+      CHECK_EQUAL(plain_bus.size(), indexed_bus.size());
+
+      RouterA plain_sender(ROUTER1);
+      RouterA indexed_sender(ROUTER1);
+
+      plain_bus.subscribe(plain_b[17]);
+      indexed_bus.subscribe(indexed_b[17]);
+
+      call_order = 0;
+      plain_bus.receive(plain_sender, message1);
+      plain_bus.receive(plain_sender, message3);
+      plain_bus.receive(plain_sender, message4);
+
+      std::vector<int> plain_order;
+
+      for (int i = 0; i < 20; ++i)
+      {
+        plain_order.push_back(plain_a[i].message1_count > 0 ? plain_a[i].order : -1);
+      }
+
+      call_order = 0;
+      indexed_bus.receive(indexed_sender, message1);
+      indexed_bus.receive(indexed_sender, message3);
+      indexed_bus.receive(indexed_sender, message4);
+
+      for (int i = 0; i < 20; ++i)
+      {
+        CHECK_EQUAL(plain_order[i], indexed_a[i].message1_count > 0 ? indexed_a[i].order : -1);
+        CHECK_EQUAL(plain_a[i].message1_count, indexed_a[i].message1_count);
+        CHECK_EQUAL(plain_a[i].message3_count, indexed_a[i].message3_count);
+        CHECK_EQUAL(plain_a[i].message4_count, indexed_a[i].message4_count);
+        CHECK_EQUAL(plain_b[i].message1_count, indexed_b[i].message1_count);
+        CHECK_EQUAL(plain_b[i].message4_count, indexed_b[i].message4_count);
+        CHECK_EQUAL(plain_b[i].message_unknown_count, indexed_b[i].message_unknown_count);
+      }
+
+      CHECK_EQUAL(plain_sender.message5_count, indexed_sender.message5_count);
+    }
   };
 }
@@ -197,6 +197,83 @@ namespace
   };
 
 
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+  //***************************************************************************
+  // Messages for routers with more than 16 types.
+  //***************************************************************************
+  template <size_t ID_>
+  struct NumberedMessage : public etl::message<ID_>
+  {
+  };
+
+  //***************************************************************************
+  // Router that counts each message it receives.
+  //***************************************************************************
+  template <typename TDerived, typename... TMessages>
+  class CountingRouter : public etl::message_router<TDerived, TMessages...>
+  {
+  public:
+
+    CountingRouter()
+      : etl::message_router<TDerived, TMessages...>(ROUTER1),
+        message_unknown_count(0)
+    {
+      for (size_t i = 0; i < 256; ++i)
+      {
+        count[i] = 0;
+      }
+    }
+
+    template <size_t ID_>
+    void on_receive(etl::imessage_router&, const NumberedMessage<ID_>& msg)
+    {
+      CHECK_EQUAL(ID_, msg.message_id);
+      ++count[ID_];
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+      ++message_unknown_count;
+    }
+
+    // Sends one of each of the router's messages.
+    static void send_each(etl::imessage_router& router)
+    {
+      int dummy[] = { (router.receive(TMessages()), 0)... };
+      (void)dummy;
+    }
+
+    int count[256];
+    int message_unknown_count;
+  };
+
+  //***************************************************************************
+  // 40 messages with dense IDs, 10 to 49.
+  //***************************************************************************
+  class DenseRouter : public CountingRouter<DenseRouter,
+                                            NumberedMessage<10>, NumberedMessage<11>, NumberedMessage<12>, NumberedMessage<13>,
+                                            NumberedMessage<14>, NumberedMessage<15>, NumberedMessage<16>, NumberedMessage<17>,
+                                            NumberedMessage<18>, NumberedMessage<19>, NumberedMessage<20>, NumberedMessage<21>,
+                                            NumberedMessage<22>, NumberedMessage<23>, NumberedMessage<24>, NumberedMessage<25>,
+                                            NumberedMessage<26>, NumberedMessage<27>, NumberedMessage<28>, NumberedMessage<29>,
+                                            NumberedMessage<30>, NumberedMessage<31>, NumberedMessage<32>, NumberedMessage<33>,
+                                            NumberedMessage<34>, NumberedMessage<35>, NumberedMessage<36>, NumberedMessage<37>,
+                                            NumberedMessage<38>, NumberedMessage<39>, NumberedMessage<40>, NumberedMessage<41>,
+                                            NumberedMessage<42>, NumberedMessage<43>, NumberedMessage<44>, NumberedMessage<45>,
+                                            NumberedMessage<46>, NumberedMessage<47>, NumberedMessage<48>, NumberedMessage<49>>
+  {
+  };
+
+  //***************************************************************************
+  // Messages with sparse IDs.
+  //***************************************************************************
+  class SparseRouter : public CountingRouter<SparseRouter,
+                                             NumberedMessage<1>, NumberedMessage<37>, NumberedMessage<90>, NumberedMessage<91>,
+                                             NumberedMessage<144>, NumberedMessage<201>, NumberedMessage<255>>
+  {
+  };
+#endif
+
   etl::imessage_router* p_router;
 
   SUITE(test_message_router)
@@ -474,5 +551,114 @@ namespace
       CHECK_EQUAL(0, r1.message4_count);
       CHECK_EQUAL(0, r1.message_unknown_count);
     }
+
+#if ETL_CPP11_SUPPORTED && !defined(ETL_MESSAGE_ROUTER_FORCE_CPP03)
+    //=========================================================================
+    template <typename TRouter>
+    void check_routes_all_ids(TRouter& router, const size_t* ids, size_t count)
+    {
+      bool expected[256] = {};
+
+      for (size_t i = 0; i < count; ++i)
+      {
+        expected[ids[i]] = true;
+      }
+
+      TRouter::send_each(router);
+
+      int unknown = 0;
+
+      for (size_t id = 0; id < 256; ++id)
+      {
+        CHECK_EQUAL(expected[id], router.accepts(etl::message_id_t(id)));
+
+        if (expected[id])
+        {
+          CHECK_EQUAL(1, router.count[id]);
+        }
+        else
+        {
+          etl::imessage msg(static_cast<etl::message_id_t>(id));
+          router.receive(msg);
+          ++unknown;
+          CHECK_EQUAL(0, router.count[id]);
+        }
+      }
+
+      CHECK_EQUAL(unknown, router.message_unknown_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_many_dense_messages)
+    {
+      DenseRouter router;
+
+      size_t ids[40];
+
+      for (size_t i = 0; i < 40; ++i)
+      {
+        ids[i] = i + 10;
+      }
+
+      check_routes_all_ids(router, ids, 40);
+
+      NumberedMessage<49> message49;
+      router.receive(message49);
+      CHECK_EQUAL(2, router.count[49]);
+    }
+
+    //=========================================================================
+    TEST(message_router_sparse_messages)
+    {
+      SparseRouter router;
+
+      const size_t ids[] = { 1, 37, 90, 91, 144, 201, 255 };
+
+      check_routes_all_ids(router, ids, sizeof(ids) / sizeof(ids[0]));
+
+      NumberedMessage<144> message144;
+      etl::send_message(router, message144);
+      CHECK_EQUAL(2, router.count[144]);
+    }
+
+    //=========================================================================
+    TEST(message_router_sparse_successor)
+    {
+      SparseRouter sparse;
+      DenseRouter  dense;
+
+      sparse.set_successor(dense);
+
+      NumberedMessage<37> message37;
+      NumberedMessage<20> message20;
+
+      etl::send_message(sparse, message37);
+      etl::send_message(sparse, message20);
+
+      CHECK_EQUAL(1, sparse.count[37]);
+      CHECK_EQUAL(0, sparse.count[20]);
+      CHECK_EQUAL(0, sparse.message_unknown_count);
+      CHECK_EQUAL(1, dense.count[20]);
+      CHECK_EQUAL(0, dense.message_unknown_count);
+    }
+
+    //=========================================================================
+    TEST(message_router_many_messages_packet)
+    {
+      NumberedMessage<45> message45;
+      const etl::imessage& im = message45;
+
+      DenseRouter::message_packet packet(im);
+      CHECK_EQUAL(45, packet.get().message_id);
+
+      NumberedMessage<90> message90;
+      SparseRouter::message_packet sparse_packet(message90);
+      CHECK_EQUAL(90, sparse_packet.get().message_id);
+
+      NumberedMessage<2> message2;
+      const etl::imessage& unknown = message2;
+      CHECK_THROW(SparseRouter::message_packet bad_packet(unknown), etl::unhandled_message_exception);
+    }
+#endif
   };
 }
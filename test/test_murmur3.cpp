@@ -33,6 +33,7 @@ SOFTWARE.
 #include <iterator>
 #include <string>
 #include <vector>
+#include <random>
 #include <stdint.h>
 
 #include "etl/murmur3.h"
@@ -110,6 +111,171 @@ namespace
       MurmurHash3_x86_32((uint8_t*)&data2[0], data2.size() * sizeof(uint32_t), 0, &compare2);
       CHECK_EQUAL(compare2, hash2);
     }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_high_chars)
+    {
+      std::string data("\x80\xFF\xFE\x7F\xC3\xA9t\xE9");
+
+      uint32_t hash = etl::murmur3<uint32_t>(data.begin(), data.end());
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.c_str(), data.size(), 0, &compare);
+
+      CHECK_EQUAL(compare, hash);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_against_reference)
+    {
+      std::mt19937 generator(1);
+
+      std::vector<uint8_t> data(301);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(generator());
+      }
+
+      for (size_t length = 0; length < 300; ++length)
+      {
+        // Unaligned for odd lengths.
+        const uint8_t* begin = data.data() + (length % 2);
+        const uint32_t seed  = uint32_t(generator());
+
+        uint32_t compare;
+        MurmurHash3_x86_32(begin, int(length), seed, &compare);
+
+        CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(begin, begin + length, seed)));
+        CHECK_EQUAL(compare, uint32_t(etl::murmur3<uint32_t>(data.begin() + (length % 2), data.begin() + (length % 2) + length, seed)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_32_split_ranges)
+    {
+      std::mt19937 generator(2);
+
+      std::vector<char> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = char(generator());
+      }
+
+      uint32_t compare;
+      MurmurHash3_x86_32(data.data(), int(data.size()), 0, &compare);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        etl::murmur3<uint32_t> murmur3_32_calculator;
+
+        const char* p   = data.data();
+        const char* end = data.data() + data.size();
+
+        // Pointers, iterators and chars, split anywhere.
+        while (p != end)
+        {
+          const size_t length = std::min(size_t(generator() % 40), size_t(end - p));
+
+          switch (generator() % 3)
+          {
+            case 0:  murmur3_32_calculator.add(p, p + length); break;
+            case 1:  murmur3_32_calculator.add(data.begin() + (p - data.data()), data.begin() + (p - data.data()) + length); break;
+            default: for (size_t c = 0; c < length; ++c) { murmur3_32_calculator.add(uint8_t(p[c])); } break;
+          }
+
+          p += length;
+        }
+
+        CHECK_EQUAL(compare, murmur3_32_calculator.value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_constructor)
+    {
+      std::string data("123456789");
+
+      etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(data.begin(), data.end());
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.c_str(), data.size(), 0, compare);
+
+      CHECK_EQUAL(compare[0], hash[0]);
+      CHECK_EQUAL(compare[1], hash[1]);
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_against_reference)
+    {
+      std::mt19937 generator(3);
+
+      std::vector<uint8_t> data(301);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(generator());
+      }
+
+      for (size_t length = 0; length < 300; ++length)
+      {
+        const uint8_t* begin = data.data() + (length % 2);
+        const uint32_t seed  = uint32_t(generator());
+
+        uint64_t compare[2];
+        MurmurHash3_x64_128(begin, int(length), seed, compare);
+
+        etl::murmur3_x64_128::value_type hash = etl::murmur3_x64_128(begin, begin + length, seed).value();
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+
+        hash = etl::murmur3_x64_128(data.begin() + (length % 2), data.begin() + (length % 2) + length, seed).value();
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_murmur3_x64_128_split_ranges)
+    {
+      std::mt19937 generator(4);
+
+      std::vector<uint8_t> data(1000);
+
+      for (size_t i = 0; i < data.size(); ++i)
+      {
+        data[i] = uint8_t(generator());
+      }
+
+      uint64_t compare[2];
+      MurmurHash3_x64_128(data.data(), int(data.size()), 1234, compare);
+
+      for (int i = 0; i < 100; ++i)
+      {
+        etl::murmur3_x64_128 murmur3_128_calculator(1234);
+
+        const uint8_t* p   = data.data();
+        const uint8_t* end = data.data() + data.size();
+
+        while (p != end)
+        {
+          const size_t length = std::min(size_t(generator() % 70), size_t(end - p));
+
+          switch (generator() % 3)
+          {
+            case 0:  murmur3_128_calculator.add(p, p + length); break;
+            case 1:  murmur3_128_calculator.add(data.begin() + (p - data.data()), data.begin() + (p - data.data()) + length); break;
+            default: for (size_t c = 0; c < length; ++c) { murmur3_128_calculator.add(p[c]); } break;
+          }
+
+          p += length;
+        }
+
+        etl::murmur3_x64_128::value_type hash = murmur3_128_calculator;
+        CHECK_EQUAL(compare[0], hash[0]);
+        CHECK_EQUAL(compare[1], hash[1]);
+      }
+    }
   };
 }
-
@@ -0,0 +1,219 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <atomic>
+
+#include "etl/mutex.h"
+#include "etl/event_count.h"
+
+#if defined(__linux__) && (defined(__GNUC__) || defined(__clang__))
+  #include "etl/mutex/mutex_futex.h"
+  #include "etl/mutex/event_count_futex.h"
+  #define TEST_FUTEX 1
+#else
+  #define TEST_FUTEX 0
+#endif
+
+namespace
+{
+  //***************************************************************************
+  // Increments a shared counter from several threads under the mutex.
+  //***************************************************************************
+  template <typename TMutex>
+  bool counts_correctly()
+  {
+    static TMutex mutex;
+    static int    counter;
+
+    static const int THREADS = 4;
+    static const int LOOPS   = 20000;
+
+    counter = 0;
+
+    struct worker
+    {
+      static void run()
+      {
+        for (int i = 0; i < LOOPS; ++i)
+        {
+          mutex.lock();
+          int value = counter;
+          // Widen the window for a lost update.
+          if ((i % 1000) == 0)
+          {
+            std::this_thread::yield();
+          }
+          counter = value + 1;
+          mutex.unlock();
+        }
+      }
+    };
+
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < THREADS; ++i)
+    {
+      threads.push_back(std::thread(worker::run));
+    }
+
+    for (size_t i = 0; i < threads.size(); ++i)
+    {
+      threads[i].join();
+    }
+
+    return counter == (THREADS * LOOPS);
+  }
+
+  //***************************************************************************
+  struct flag_is_set
+  {
+    flag_is_set(std::atomic<bool>& flag_)
+      : flag(flag_)
+    {
+    }
+
+    bool operator()() const
+    {
+      return flag.load();
+    }
+
+    std::atomic<bool>& flag;
+  };
+
+  //***************************************************************************
+  // Checks that wait_for times out, and that it is woken by notify.
+  //***************************************************************************
+  template <typename TEventCount>
+  void check_event_count()
+  {
+    static TEventCount       event;
+    static std::atomic<bool> flag;
+
+    flag = false;
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    CHECK(!event.wait_for(flag_is_set(flag), 20U));
+    CHECK((std::chrono::steady_clock::now() - start) >= std::chrono::milliseconds(19));
+
+    struct notifier
+    {
+      static void run()
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        flag = true;
+        event.notify_all();
+      }
+    };
+
+    std::thread t1(notifier::run);
+
+    start = std::chrono::steady_clock::now();
+    CHECK(event.wait_for(flag_is_set(flag), 5000U));
+    CHECK((std::chrono::steady_clock::now() - start) < std::chrono::milliseconds(4000));
+
+    t1.join();
+
+    // Already set.
+    CHECK(event.wait_for(flag_is_set(flag), 0U));
+  }
+
+  SUITE(test_mutex)
+  {
+    //*************************************************************************
+    TEST(test_lock_unlock)
+    {
+      etl::mutex mutex;
+
+      mutex.lock();
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      CHECK(counts_correctly<etl::mutex>());
+    }
+
+#if ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    TEST(test_event_count)
+    {
+      check_event_count<etl::event_count>();
+    }
+#endif
+
+#if TEST_FUTEX
+    //*************************************************************************
+    TEST(test_futex_lock_unlock)
+    {
+      etl::mutex_futex mutex;
+
+      mutex.lock();
+      CHECK(!mutex.try_lock());
+      mutex.unlock();
+
+      CHECK(mutex.try_lock());
+      mutex.unlock();
+    }
+
+    //*************************************************************************
+    TEST(test_futex_threads)
+    {
+      CHECK(counts_correctly<etl::mutex_futex>());
+    }
+
+    //*************************************************************************
+    TEST(test_futex_event_count)
+    {
+      check_event_count<etl::event_count_futex>();
+    }
+
+    //*************************************************************************
+    TEST(test_futex_timeout_conversion)
+    {
+      struct timespec timeout = etl::private_mutex::make_timespec(1234U);
+      CHECK_EQUAL(1, int(timeout.tv_sec));
+      CHECK_EQUAL(234000000L, long(timeout.tv_nsec));
+
+      // Timeouts of 2^31 ms and more stay positive.
+      timeout = etl::private_mutex::make_timespec(0xFFFFFFFFU);
+      CHECK_EQUAL(4294967L, long(timeout.tv_sec));
+      CHECK_EQUAL(295000000L, long(timeout.tv_nsec));
+    }
+#endif
+  };
+}
@@ -0,0 +1,529 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <algorithm>
+
+#include "etl/queue_mpmc_atomic.h"
+
+namespace
+{
+  struct Data
+  {
+    Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
+      : a(a_),
+        b(b_),
+        c(c_),
+        d(d_)
+    {
+    }
+
+    Data()
+      : a(0),
+        b(0),
+        c(0),
+        d(0)
+    {
+    }
+
+    int a;
+    int b;
+    int c;
+    int d;
+  };
+
+  bool operator ==(const Data& lhs, const Data& rhs)
+  {
+    return (lhs.a == rhs.a) && (lhs.b == rhs.b) && (lhs.c == rhs.c) && (lhs.d == rhs.d);
+  }
+
+  SUITE(test_queue_mpmc_atomic)
+  {
+    //*************************************************************************
+    TEST(test_constructor)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(4U, queue.max_size());
+      CHECK_EQUAL(4U, queue.capacity());
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK_EQUAL(4U, queue.available());
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+      CHECK_EQUAL(1U, queue.available());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+      CHECK_EQUAL(0U, queue.available());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop(i));
+      CHECK(!queue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_multiple_emplace)
+    {
+      etl::queue_mpmc_atomic<Data, 4> queue;
+
+      queue.emplace(1);
+      queue.emplace(1, 2);
+      queue.emplace(1, 2, 3);
+      queue.emplace(1, 2, 3, 4);
+
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(!queue.emplace(1));
+
+      Data popped;
+
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+      queue.pop(popped);
+      CHECK(popped == Data(1, 2, 3, 4));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_iqueue)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      etl::iqueue_mpmc_atomic<int>& iqueue = queue;
+
+      CHECK_EQUAL(0U, iqueue.size());
+
+      iqueue.push(1);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      iqueue.push(2);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      iqueue.push(3);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      iqueue.push(4);
+      CHECK_EQUAL(4U, iqueue.size());
+
+      CHECK(!iqueue.push(5));
+      CHECK(!iqueue.push(5));
+
+      int i;
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK_EQUAL(3U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK_EQUAL(2U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(3, i);
+      CHECK_EQUAL(1U, iqueue.size());
+
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(4, i);
+      CHECK_EQUAL(0U, iqueue.size());
+
+      CHECK(!iqueue.pop(i));
+      CHECK(!iqueue.pop(i));
+    }
+
+    //*************************************************************************
+    TEST(test_size_push_pop_void)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      CHECK_EQUAL(1U, queue.size());
+
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+
+      queue.push(3);
+      CHECK_EQUAL(3U, queue.size());
+
+      queue.push(4);
+      CHECK_EQUAL(4U, queue.size());
+
+      CHECK(!queue.push(5));
+      CHECK(!queue.push(5));
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(1U, queue.size());
+
+      CHECK(queue.pop());
+      CHECK_EQUAL(0U, queue.size());
+
+      CHECK(!queue.pop());
+      CHECK(!queue.pop());
+    }
+
+    //*************************************************************************
+    TEST(test_wrap_around)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      // Run many laps of the buffer, leaving a different number of items each time.
+      for (int lap = 0; lap < 100; ++lap)
+      {
+        while (queue.push(next_push))
+        {
+          ++next_push;
+        }
+
+        CHECK(queue.full());
+
+        for (int i = 0; i <= (lap % 4); ++i)
+        {
+          int value;
+          CHECK(queue.pop(value));
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      int value;
+
+      while (queue.pop(value))
+      {
+        CHECK_EQUAL(next_pop, value);
+        ++next_pop;
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_small_memory_model_wrap_around)
+    {
+      // The 8 bit positions wrap many times.
+      etl::queue_mpmc_atomic<int, 64, etl::memory_model::MEMORY_MODEL_SMALL> queue;
+
+      CHECK_EQUAL(64U, queue.capacity());
+
+      int next_push = 0;
+      int next_pop  = 0;
+
+      for (int lap = 0; lap < 1000; ++lap)
+      {
+        for (int i = 0; i < 37; ++i)
+        {
+          CHECK(queue.push(next_push++));
+        }
+
+        CHECK_EQUAL(37U, queue.size());
+
+        int value;
+
+        while (queue.pop(value))
+        {
+          CHECK_EQUAL(next_pop, value);
+          ++next_pop;
+        }
+      }
+
+      CHECK_EQUAL(next_push, next_pop);
+    }
+
+    //*************************************************************************
+    TEST(test_consume)
+    {
+      etl::queue_mpmc_atomic<int, 8> queue;
+
+      for (int i = 1; i <= 6; ++i)
+      {
+        queue.push(i);
+      }
+
+      std::vector<int> consumed;
+      auto functor = [&consumed](int& value) { consumed.push_back(value); };
+
+      CHECK_EQUAL(4U, queue.consume(functor, 4));
+      CHECK_EQUAL(2U, queue.size());
+
+      CHECK_EQUAL(2U, queue.consume(functor, 4));
+      CHECK_EQUAL(0U, queue.consume(functor, 4));
+      CHECK(queue.empty());
+
+      std::vector<int> compare = { 1, 2, 3, 4, 5, 6 };
+      CHECK(compare == consumed);
+    }
+
+    //*************************************************************************
+    TEST(test_clear)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+
+      CHECK_EQUAL(0U, queue.size());
+
+      queue.push(1);
+      queue.push(2);
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+
+      // Do it again to check that clear() didn't screw up the internals.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      queue.clear();
+      CHECK_EQUAL(0U, queue.size());
+    }
+
+    //*************************************************************************
+    TEST(test_empty)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+
+      queue.clear();
+      CHECK(queue.empty());
+
+      queue.push(1);
+      CHECK(!queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      etl::queue_mpmc_atomic<int, 4> queue;
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+
+      queue.clear();
+      CHECK(!queue.full());
+
+      queue.push(1);
+      queue.push(2);
+      queue.push(3);
+      queue.push(4);
+      CHECK(queue.full());
+    }
+
+    //*************************************************************************
+    TEST(test_cache_line_separated)
+    {
+      etl::queue_mpmc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_LARGE, 64> queue;
+
+      CHECK(sizeof(queue) > (3 * 64));
+
+      queue.push(1);
+      queue.push(2);
+
+      int i;
+
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(queue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(queue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_stress)
+    {
+      static etl::queue_mpmc_atomic<int, 16, etl::memory_model::MEMORY_MODEL_LARGE, 64> queue;
+
+      static const int PRODUCERS = 4;
+      static const int CONSUMERS = 4;
+      static const int LENGTH    = 20000; // Per producer.
+
+      static std::vector<int> popped[CONSUMERS];
+      static std::atomic<int> remaining;
+
+      remaining = PRODUCERS * LENGTH;
+
+      struct worker
+      {
+        static void produce(int id)
+        {
+          int value = id * LENGTH;
+          int last  = value + LENGTH;
+
+          while (value < last)
+          {
+            if (queue.push(value))
+            {
+              ++value;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }
+
+        static void consume(int id)
+        {
+          popped[id].clear();
+          popped[id].reserve(PRODUCERS * LENGTH);
+
+          while (remaining.load() > 0)
+          {
+            int value;
+
+            if (queue.pop(value))
+            {
+              popped[id].push_back(value);
+              --remaining;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < CONSUMERS; ++i)
+      {
+        threads.push_back(std::thread(worker::consume, i));
+      }
+
+      for (int i = 0; i < PRODUCERS; ++i)
+      {
+        threads.push_back(std::thread(worker::produce, i));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      // Every value is popped exactly once.
+      std::vector<int> all;
+
+      for (int i = 0; i < CONSUMERS; ++i)
+      {
+        all.insert(all.end(), popped[i].begin(), popped[i].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(PRODUCERS * LENGTH), all.size());
+
+      bool all_present = true;
+
+      for (size_t i = 0; i < all.size(); ++i)
+      {
+        all_present = all_present && (all[i] == int(i));
+      }
+
+      CHECK(all_present);
+
+      // Each consumer sees each producer's values in the order they were pushed.
+      bool in_order = true;
+
+      for (int c = 0; c < CONSUMERS; ++c)
+      {
+        int last[PRODUCERS];
+        std::fill(last, last + PRODUCERS, -1);
+
+        for (size_t i = 0; i < popped[c].size(); ++i)
+        {
+          int value    = popped[c][i];
+          int producer = value / LENGTH;
+
+          in_order = in_order && (value > last[producer]);
+          last[producer] = value;
+        }
+      }
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+  };
+}
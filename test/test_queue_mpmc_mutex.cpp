@@ -309,6 +309,112 @@ namespace
       CHECK(queue.full());
     }
 
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    TEST(test_pop_wait_timeout)
+    {
+      etl::queue_mpmc_mutex<int, 4> queue;
+
+      int i = 0;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      CHECK(!queue.pop_wait(i, 20U));
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+      CHECK(elapsed >= std::chrono::milliseconds(19));
+
+      queue.push(1);
+      CHECK(queue.pop_wait(i, 20U));
+      CHECK_EQUAL(1, i);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_threads)
+    {
+      static etl::queue_mpmc_mutex<int, 4> queue;
+
+      static const int LENGTH    = 1000; // Per producer.
+      static const int PRODUCERS = 2;
+      static const int CONSUMERS = 2;
+
+      static std::vector<int> popped[CONSUMERS];
+
+      struct worker
+      {
+        static void produce(int id)
+        {
+          for (int i = id * LENGTH; i < ((id + 1) * LENGTH);)
+          {
+            if (queue.push(i))
+            {
+              ++i;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+
+            if ((i % 100) == 0)
+            {
+              // Let the consumers go to sleep.
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          }
+        }
+
+        static void consume(int id)
+        {
+          int value;
+
+          popped[id].clear();
+
+          // Stop when nothing has arrived for a while.
+          while (queue.pop_wait(value, 200U))
+          {
+            popped[id].push_back(value);
+          }
+        }
+      };
+
+      std::vector<std::thread> threads;
+
+      for (int i = 0; i < CONSUMERS; ++i)
+      {
+        threads.push_back(std::thread(worker::consume, i));
+      }
+
+      for (int i = 0; i < PRODUCERS; ++i)
+      {
+        threads.push_back(std::thread(worker::produce, i));
+      }
+
+      for (size_t i = 0; i < threads.size(); ++i)
+      {
+        threads[i].join();
+      }
+
+      std::vector<int> all;
+
+      for (int i = 0; i < CONSUMERS; ++i)
+      {
+        all.insert(all.end(), popped[i].begin(), popped[i].end());
+      }
+
+      std::sort(all.begin(), all.end());
+
+      CHECK_EQUAL(size_t(PRODUCERS * LENGTH), all.size());
+
+      bool all_present = true;
+
+      for (size_t i = 0; i < all.size(); ++i)
+      {
+        all_present = all_present && (all[i] == int(i));
+      }
+
+      CHECK(all_present);
+    }
+#endif
+
     //=========================================================================
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
@@ -299,6 +299,194 @@ namespace
       CHECK(queue.full());
     }
 
+    //*************************************************************************
+    TEST(test_size_after_wrap)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int i;
+
+      for (int j = 0; j < 4; ++j)
+      {
+        queue.push(j);
+        queue.pop(i);
+      }
+
+      // The write index has wrapped, but the read index has not.
+      queue.push(1);
+      queue.push(2);
+      CHECK_EQUAL(2U, queue.size());
+      CHECK_EQUAL(2U, queue.available());
+
+      queue.pop(i);
+      CHECK_EQUAL(1U, queue.size());
+      CHECK_EQUAL(3U, queue.available());
+    }
+
+    //*************************************************************************
+    TEST(test_push_pop_range)
+    {
+      etl::queue_spsc_atomic<int, 4> queue;
+
+      int input[] = { 1, 2, 3, 4, 5, 6 };
+      int output[6] = { 0 };
+
+      CHECK_EQUAL(4U, queue.push(input, input + 6));
+      CHECK_EQUAL(4U, queue.size());
+      CHECK(queue.full());
+      CHECK_EQUAL(0U, queue.push(input + 4, input + 6));
+
+      CHECK_EQUAL(3U, queue.pop(output, 3U));
+      CHECK_EQUAL(1, output[0]);
+      CHECK_EQUAL(2, output[1]);
+      CHECK_EQUAL(3, output[2]);
+      CHECK_EQUAL(1U, queue.size());
+
+      // Wraps around the end of the buffer.
+      CHECK_EQUAL(2U, queue.push(input + 4, input + 6));
+      CHECK_EQUAL(3U, queue.size());
+
+      CHECK_EQUAL(3U, queue.pop(output, 6U));
+      CHECK_EQUAL(4, output[0]);
+      CHECK_EQUAL(5, output[1]);
+      CHECK_EQUAL(6, output[2]);
+      CHECK(queue.empty());
+
+      CHECK_EQUAL(0U, queue.pop(output, 6U));
+    }
+
+    //*************************************************************************
+    TEST(test_write_reserve_commit)
+    {
+      etl::queue_spsc_atomic<Data, 4> queue;
+
+      etl::iqueue_spsc_atomic<Data>::size_type n = 3;
+      Data* p = queue.write_reserve(n);
+
+      CHECK(p != nullptr);
+      CHECK_EQUAL(3U, n);
+
+      for (int i = 0; i < 3; ++i)
+      {
+        ::new (p + i) Data(i);
+      }
+
+      // Nothing is visible until committed.
+      CHECK(queue.empty());
+
+      queue.commit(n);
+      CHECK_EQUAL(3U, queue.size());
+
+      Data popped;
+      queue.pop(popped);
+      CHECK(popped == Data(0));
+      queue.pop(popped);
+      CHECK(popped == Data(1));
+
+      // Two slots are free before the end of the buffer. The third free slot is at the start.
+      n = 3;
+      p = queue.write_reserve(n);
+      CHECK_EQUAL(2U, n);
+      ::new (p) Data(3);
+      ::new (p + 1) Data(4);
+      queue.commit(n);
+
+      n = 3;
+      p = queue.write_reserve(n);
+      CHECK_EQUAL(1U, n);
+      ::new (p) Data(5);
+      queue.commit(n);
+
+      n = 1;
+      CHECK(queue.write_reserve(n) == nullptr);
+      CHECK_EQUAL(0U, n);
+
+      Data output[4];
+      CHECK_EQUAL(4U, queue.pop(output, 4U));
+      CHECK(output[0] == Data(2));
+      CHECK(output[1] == Data(3));
+      CHECK(output[2] == Data(4));
+      CHECK(output[3] == Data(5));
+    }
+
+    //*************************************************************************
+    TEST(test_cache_line_separated)
+    {
+      typedef etl::queue_spsc_atomic<int, 4, etl::memory_model::MEMORY_MODEL_SMALL, 64> Queue;
+
+      Queue queue;
+
+      CHECK(sizeof(Queue) > (3 * 64));
+
+      etl::iqueue_spsc_atomic<int, etl::memory_model::MEMORY_MODEL_SMALL, 64>& iqueue = queue;
+
+      CHECK(iqueue.push(1));
+      CHECK(iqueue.push(2));
+      CHECK_EQUAL(2U, iqueue.size());
+
+      int i;
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(1, i);
+      CHECK(iqueue.pop(i));
+      CHECK_EQUAL(2, i);
+      CHECK(iqueue.empty());
+    }
+
+    //*************************************************************************
+    TEST(test_threads_batch)
+    {
+      static etl::queue_spsc_atomic<int, 100, etl::memory_model::MEMORY_MODEL_LARGE, 64> queue;
+
+      const int LENGTH = 100000;
+
+      struct producer
+      {
+        static void run()
+        {
+          int values[16];
+          int next = 0;
+
+          while (next < LENGTH)
+          {
+            int count = 0;
+
+            while ((count < 16) && ((next + count) < LENGTH))
+            {
+              values[count] = next + count;
+              ++count;
+            }
+
+            next += int(queue.push(values, values + count));
+          }
+        }
+      };
+
+      std::thread t1(producer::run);
+
+      std::vector<int> received;
+      received.reserve(LENGTH);
+
+      int values[16];
+
+      while (received.size() < size_t(LENGTH))
+      {
+        size_t count = queue.pop(values, 16U);
+        received.insert(received.end(), values, values + count);
+      }
+
+      t1.join();
+
+      bool in_order = true;
+
+      for (int i = 0; i < LENGTH; ++i)
+      {
+        in_order = in_order && (received[i] == i);
+      }
+
+      CHECK(in_order);
+      CHECK(queue.empty());
+    }
+
     //=========================================================================
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
     #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
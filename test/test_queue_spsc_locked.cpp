@@ -32,6 +32,7 @@ SOFTWARE.
 #include "etl/function.h"
 
 #include <thread>
+#include <chrono>
 #include <mutex>
 #include <vector>
 
@@ -72,6 +73,28 @@ namespace
   etl::function_imv<Access, access, &Access::lock>   lock;
   etl::function_imv<Access, access, &Access::unlock> unlock;
 
+  class ThreadAccess
+  {
+  public:
+
+    void lock()
+    {
+      access.lock();
+    }
+
+    void unlock()
+    {
+      access.unlock();
+    }
+
+    std::mutex access;
+  };
+
+  ThreadAccess thread_access;
+
+  etl::function_imv<ThreadAccess, thread_access, &ThreadAccess::lock>   thread_lock;
+  etl::function_imv<ThreadAccess, thread_access, &ThreadAccess::unlock> thread_unlock;
+
   struct Data
   {
     Data(int a_, int b_ = 2, int c_ = 3, int d_ = 4)
@@ -534,6 +557,75 @@ namespace
       CHECK(!access.called_unlock);
     }
 
+#if defined(ETL_QUEUE_POP_WAIT) && ETL_HAS_EVENT_COUNT
+    //*************************************************************************
+    TEST(test_pop_wait_timeout)
+    {
+      etl::queue_spsc_locked<int, 4> queue(thread_lock, thread_unlock);
+
+      int i = 0;
+
+      std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+      CHECK(!queue.pop_wait(i, 20U));
+      std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start;
+
+      CHECK(elapsed >= std::chrono::milliseconds(19));
+
+      queue.push(1);
+      CHECK(queue.pop_wait(i, 20U));
+      CHECK_EQUAL(1, i);
+    }
+
+    //*************************************************************************
+    TEST(test_pop_wait_threads)
+    {
+      static etl::queue_spsc_locked<int, 4> queue(thread_lock, thread_unlock);
+
+      const int LENGTH = 1000;
+
+      struct producer
+      {
+        static void run()
+        {
+          for (int i = 0; i < LENGTH;)
+          {
+            if (queue.push(i))
+            {
+              ++i;
+            }
+            else
+            {
+              std::this_thread::yield();
+            }
+
+            if ((i % 100) == 0)
+            {
+              // Let the consumer go to sleep.
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          }
+        }
+      };
+
+      std::thread t1(producer::run);
+
+      bool in_order = true;
+      int  count    = 0;
+      int  value;
+
+      while ((count < LENGTH) && queue.pop_wait(value, 5000U))
+      {
+        in_order = in_order && (value == count);
+        ++count;
+      }
+
+      t1.join();
+
+      CHECK_EQUAL(LENGTH, count);
+      CHECK(in_order);
+    }
+#endif
+
     //=========================================================================
 #if REALTIME_TEST && defined(ETL_COMPILER_MICROSOFT)
   #if defined(ETL_TARGET_OS_WINDOWS) // Only Windows priority is currently supported
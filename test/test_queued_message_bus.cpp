@@ -0,0 +1,366 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+http://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+
+#include "UnitTest++.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "etl/queued_message_bus.h"
+#include "etl/message_router.h"
+
+namespace
+{
+  enum
+  {
+    MESSAGE1,
+    MESSAGE2,
+    MESSAGE3
+  };
+
+  enum
+  {
+    ROUTER1 = 1,
+    ROUTER2 = 2
+  };
+
+  int copies;
+  int destructions;
+
+  struct Message1 : public etl::message<MESSAGE1>
+  {
+    Message1(int value_)
+      : value(value_)
+    {
+    }
+
+    int value;
+  };
+
+  struct Message2 : public etl::message<MESSAGE2>
+  {
+    Message2(const std::string& text_)
+      : text(text_)
+    {
+    }
+
+    Message2(const Message2& other)
+      : etl::message<MESSAGE2>(other),
+        text(other.text)
+    {
+      ++copies;
+    }
+
+    ~Message2()
+    {
+      ++destructions;
+    }
+
+    std::string text;
+  };
+
+  struct Message3 : public etl::message<MESSAGE3>
+  {
+  };
+
+  //***************************************************************************
+  // Records the messages that it receives.
+  //***************************************************************************
+  class Router : public etl::message_router<Router, Message1, Message2, Message3>
+  {
+  public:
+
+    Router(etl::message_router_id_t id)
+      : message_router(id),
+        p_bus(nullptr)
+    {
+    }
+
+    void on_receive(etl::imessage_router& sender, const Message1& msg)
+    {
+      values.push_back(msg.value);
+      senders.push_back(sender.get_message_router_id());
+
+      // Reply through the bus.
+      if ((p_bus != nullptr) && (msg.value > 0))
+      {
+        p_bus->receive(Message1(msg.value - 1));
+      }
+    }
+
+    void on_receive(etl::imessage_router&, const Message2& msg)
+    {
+      texts.push_back(msg.text);
+    }
+
+    void on_receive(etl::imessage_router&, const Message3&)
+    {
+      values.push_back(-3);
+    }
+
+    void on_receive_unknown(etl::imessage_router&, const etl::imessage&)
+    {
+    }
+
+    std::vector<int>                      values;
+    std::vector<etl::message_router_id_t> senders;
+    std::vector<std::string>              texts;
+    etl::imessage_bus*                    p_bus;
+  };
+
+  typedef etl::queued_message_bus<2, Router::message_packet, 8>     Bus;
+  typedef etl::queued_message_bus<2, Router::message_packet, 8, 3> IndexedBus;
+
+  SUITE(test_queued_message_bus)
+  {
+    //*************************************************************************
+    TEST(test_messages_are_delivered_by_process_queue)
+    {
+      Bus bus;
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      CHECK_EQUAL(8U, bus.queue_capacity());
+
+      bus.receive(Message1(1));
+      etl::send_message(router2, bus, Message3());
+      bus.receive(Message1(2));
+
+      CHECK_EQUAL(3U, bus.queue_size());
+      CHECK(router1.values.empty());
+      CHECK(router2.values.empty());
+
+      CHECK_EQUAL(3U, bus.process_queue());
+      CHECK(bus.queue_empty());
+
+      std::vector<int> compare = { 1, -3, 2 };
+      CHECK(compare == router1.values);
+      CHECK(compare == router2.values);
+
+      // The source of the first message was the null router.
+      std::vector<etl::message_router_id_t> compare_senders = { etl::imessage_router::NULL_MESSAGE_ROUTER, etl::imessage_router::NULL_MESSAGE_ROUTER };
+      CHECK(compare_senders == router1.senders);
+
+      CHECK_EQUAL(0U, bus.process_queue());
+    }
+
+    //*************************************************************************
+    TEST(test_addressed_messages)
+    {
+      IndexedBus bus;
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      bus.receive(ROUTER2, Message1(5));
+      bus.receive(router1, ROUTER1, Message1(6));
+      bus.receive(router1, Message1(7));
+
+      bus.process_queue();
+
+      std::vector<int> compare1 = { 6, 7 };
+      std::vector<int> compare2 = { 5, 7 };
+      CHECK(compare1 == router1.values);
+      CHECK(compare2 == router2.values);
+
+      std::vector<etl::message_router_id_t> compare_senders = { ROUTER1, ROUTER1 };
+      CHECK(compare_senders == router1.senders);
+    }
+
+    //*************************************************************************
+    TEST(test_process_queue_max_count)
+    {
+      Bus bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+
+      for (int i = 0; i < 5; ++i)
+      {
+        bus.receive(Message1(0));
+      }
+
+      CHECK_EQUAL(2U, bus.process_queue(2));
+      CHECK_EQUAL(2U, router1.values.size());
+      CHECK_EQUAL(3U, bus.queue_size());
+
+      bus.clear_queue();
+      CHECK(bus.queue_empty());
+      CHECK_EQUAL(0U, bus.process_queue(2));
+    }
+
+    //*************************************************************************
+    TEST(test_messages_sent_while_processing_wait)
+    {
+      Bus bus;
+      Router router1(ROUTER1);
+
+      router1.p_bus = &bus;
+      bus.subscribe(router1);
+
+      bus.receive(Message1(3));
+
+      CHECK_EQUAL(1U, bus.process_queue());
+      CHECK_EQUAL(1U, bus.queue_size());
+      CHECK_EQUAL(1U, bus.process_queue());
+      CHECK_EQUAL(1U, bus.process_queue());
+      CHECK_EQUAL(1U, bus.process_queue());
+      CHECK_EQUAL(0U, bus.process_queue());
+
+      std::vector<int> compare = { 3, 2, 1, 0 };
+      CHECK(compare == router1.values);
+    }
+
+    //*************************************************************************
+    TEST(test_message_is_copied_once_and_destroyed)
+    {
+      Bus bus;
+      Router router1(ROUTER1);
+      Router router2(ROUTER2);
+
+      bus.subscribe(router1);
+      bus.subscribe(router2);
+
+      {
+        Message2 message(std::string("a string too long for the small string buffer"));
+
+        copies       = 0;
+        destructions = 0;
+
+        bus.receive(message);
+      }
+
+      CHECK_EQUAL(1, copies);
+      CHECK_EQUAL(1, destructions);
+
+      bus.process_queue();
+
+      CHECK_EQUAL(1, copies);
+      CHECK_EQUAL(2, destructions);
+
+      CHECK_EQUAL(1U, router1.texts.size());
+      CHECK_EQUAL(1U, router2.texts.size());
+      CHECK_EQUAL(std::string("a string too long for the small string buffer"), router2.texts[0]);
+    }
+
+    //*************************************************************************
+    TEST(test_full)
+    {
+      Bus bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+
+      for (int i = 0; i < 8; ++i)
+      {
+        bus.receive(Message1(0));
+      }
+
+      CHECK_THROW(bus.receive(Message1(0)), etl::queued_message_bus_full);
+
+      CHECK_EQUAL(8U, bus.process_queue());
+      CHECK_EQUAL(8U, router1.values.size());
+    }
+
+    //*************************************************************************
+    TEST(test_threads)
+    {
+      typedef etl::queued_message_bus<1, Router::message_packet, 64> ThreadBus;
+
+      const int PRODUCERS = 3;
+      const int COUNT     = 10000;
+
+      ThreadBus bus;
+      Router router1(ROUTER1);
+
+      bus.subscribe(router1);
+
+      std::atomic<int> finished(0);
+      std::vector<std::thread> producers;
+
+      for (int p = 0; p < PRODUCERS; ++p)
+      {
+        producers.push_back(std::thread([&bus, &finished, p]()
+        {
+          for (int i = 0; i < COUNT; ++i)
+          {
+            // Wait until there is room for every producer.
+            while (bus.queue_size() > (bus.queue_capacity() - PRODUCERS))
+            {
+              std::this_thread::yield();
+            }
+
+            bus.receive(Message1((p * COUNT) + i));
+          }
+
+          ++finished;
+        }));
+      }
+
+      while ((finished < PRODUCERS) || !bus.queue_empty())
+      {
+        if (bus.process_queue() == 0U)
+        {
+          std::this_thread::yield();
+        }
+      }
+
+      for (size_t i = 0; i < producers.size(); ++i)
+      {
+        producers[i].join();
+      }
+
+      bus.process_queue();
+
+      CHECK_EQUAL(size_t(PRODUCERS * COUNT), router1.values.size());
+
+      // Each producer's messages arrive in order.
+      std::vector<int> last(PRODUCERS, -1);
+      bool in_order = true;
+
+      for (size_t i = 0; i < router1.values.size(); ++i)
+      {
+        const int value = router1.values[i];
+        const int p     = value / COUNT;
+
+        in_order = in_order && (value > last[p]);
+        last[p] = value;
+      }
+
+      CHECK(in_order);
+    }
+  };
+}
@@ -531,6 +531,26 @@ namespace
       CHECK_THROW(data.insert(excess_data.begin(), excess_data.end()), etl::flat_map_full);
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      typedef std::pair<const int, int> Element;
+
+      Element initial[] = { Element(2, 0), Element(6, 0), Element(4, 0) };
+      Element extra[]   = { Element(5, 1), Element(1, 1), Element(6, 1), Element(3, 1), Element(1, 2) };
+
+      etl::reference_flat_map<int, int, SIZE> data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(6U, data.size());
+      CHECK(std::is_sorted(data.begin(), data.end()));
+
+      // The first of each key is referenced.
+      CHECK(&*data.find(6) == &initial[1]);
+      CHECK(&*data.find(1) == &extra[1]);
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -356,6 +356,24 @@ namespace
       CHECK(std::is_sorted(data.begin(), data.end()));
     }
 
+    //*************************************************************************
+    TEST(test_insert_range_merges_with_existing)
+    {
+      typedef std::pair<const int, int> Element;
+
+      Element initial[] = { Element(2, 0), Element(1, 0) };
+      Element extra[]   = { Element(1, 1), Element(0, 1), Element(2, 1), Element(1, 2) };
+
+      etl::reference_flat_multimap<int, int, SIZE> data(std::begin(initial), std::end(initial));
+      std::multimap<int, int> compare_data(std::begin(initial), std::end(initial));
+
+      data.insert(std::begin(extra), std::end(extra));
+      compare_data.insert(std::begin(extra), std::end(extra));
+
+      CHECK_EQUAL(compare_data.size(), data.size());
+      CHECK(std::equal(data.begin(), data.end(), compare_data.begin()));
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_erase_key)
     {
@@ -34,6 +34,8 @@ SOFTWARE.
 #include "etl/array.h"
 
 #include <iostream>
+#include <vector>
+#include <random>
 
 namespace
 {
@@ -232,6 +234,68 @@ namespace
 
   MotorControl motorControl;
 
+  //***********************************
+  // The motor control FSM, with an index.
+  //***********************************
+  class IndexedMotorControl : public MotorControl
+  {
+  public:
+
+    IndexedMotorControl()
+    {
+      this->set_index(index);
+    }
+
+    etl::state_chart_index<7, 3> index;
+  };
+
+  //***********************************
+  // A state chart with a large table, to compare indexed against scanned lookup.
+  //***********************************
+  class LargeChart : public etl::state_chart<LargeChart>
+  {
+  public:
+
+    static const int STATES      = 80;
+    static const int EVENTS      = 20;
+    static const int TRANSITIONS = 400;
+
+    LargeChart(const transition* tbegin, const transition* tend, const state* sbegin, const state* send)
+      : state_chart<LargeChart>(*this, tbegin, tend, sbegin, send, 0),
+        actions(0),
+        entries(0),
+        exits(0),
+        guard_count(0)
+    {
+    }
+
+    void Action()
+    {
+      ++actions;
+    }
+
+    void OnEntry()
+    {
+      entries += get_state_id() + 1;
+    }
+
+    void OnExit()
+    {
+      exits += get_state_id() + 1;
+    }
+
+    // Passes on every other call.
+    bool Guard()
+    {
+      return (++guard_count & 1) == 0;
+    }
+
+    int actions;
+    int entries;
+    int exits;
+    int guard_count;
+  };
+
   SUITE(test_state_chart_class)
   {
     //*************************************************************************
@@ -462,5 +526,143 @@ namespace
       motorControl.process_event(EventId::ABORT);
       CHECK_EQUAL(StateId::IDLE, int(motorControl.get_state_id()));
     }
+
+    //*************************************************************************
+    TEST(test_state_chart_indexed)
+    {
+      IndexedMotorControl indexedControl;
+
+      CHECK(indexedControl.is_indexed());
+
+      indexedControl.ClearStatistics();
+      indexedControl.start();
+      CHECK_EQUAL(true, indexedControl.entered_idle);
+
+      // Guarded duplicate keys are tried in table order.
+      indexedControl.guard = false;
+      indexedControl.process_event(EventId::START);
+      CHECK_EQUAL(StateId::IDLE, int(indexedControl.get_state_id()));
+      CHECK_EQUAL(1, indexedControl.null);
+
+      indexedControl.guard = true;
+      indexedControl.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(indexedControl.get_state_id()));
+      CHECK_EQUAL(true, indexedControl.isLampOn);
+
+      // Unhandled.
+      indexedControl.process_event(EventId::STOPPED);
+      CHECK_EQUAL(StateId::RUNNING, int(indexedControl.get_state_id()));
+
+      indexedControl.process_event(EventId::STOP);
+      CHECK_EQUAL(StateId::WINDING_DOWN, int(indexedControl.get_state_id()));
+      CHECK_EQUAL(1, indexedControl.windingDown);
+
+      // From any state.
+      indexedControl.process_event(EventId::ABORT);
+      CHECK_EQUAL(StateId::IDLE, int(indexedControl.get_state_id()));
+      CHECK_EQUAL(0, indexedControl.windingDown);
+      CHECK_EQUAL(false, indexedControl.isLampOn);
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_index_too_small)
+    {
+      IndexedMotorControl indexedControl;
+
+      etl::state_chart_index<6, 3> small_index;
+
+      indexedControl.set_index(small_index);
+      CHECK(!indexedControl.is_indexed());
+
+      // Still works, by scanning.
+      indexedControl.ClearStatistics();
+      indexedControl.guard = true;
+      indexedControl.start();
+      indexedControl.process_event(EventId::START);
+      CHECK_EQUAL(StateId::RUNNING, int(indexedControl.get_state_id()));
+
+      indexedControl.set_index(indexedControl.index);
+      CHECK(indexedControl.is_indexed());
+
+      indexedControl.clear_index();
+      CHECK(!indexedControl.is_indexed());
+    }
+
+    //*************************************************************************
+    TEST(test_state_chart_indexed_matches_scanned)
+    {
+      typedef LargeChart::transition transition;
+      typedef LargeChart::state      state;
+
+      std::mt19937 generator(12345);
+
+      // Few events and many transitions, so that keys repeat and guards matter.
+      std::vector<transition> transitions;
+      transitions.reserve(LargeChart::TRANSITIONS);
+
+      for (int i = 0; i < LargeChart::TRANSITIONS; ++i)
+      {
+        int  from   = int(generator() % LargeChart::STATES);
+        int  event  = int(generator() % LargeChart::EVENTS);
+        int  to     = int(generator() % LargeChart::STATES);
+        bool guard  = (generator() % 2) == 0;
+        bool action = (generator() % 2) == 0;
+
+        void (LargeChart::*pa)() = action ? &LargeChart::Action : nullptr;
+        bool (LargeChart::*pg)() = guard  ? &LargeChart::Guard  : nullptr;
+
+        if ((generator() % 20) == 0)
+        {
+          transitions.push_back(transition(event, to, pa, pg));
+        }
+        else
+        {
+          transitions.push_back(transition(from, event, to, pa, pg));
+        }
+      }
+
+      // Some states have no entry, some have more than one.
+      std::vector<state> states;
+      states.reserve(LargeChart::STATES + 10);
+
+      for (int i = 0; i < LargeChart::STATES; i += 2)
+      {
+        states.push_back(state(i, &LargeChart::OnEntry, &LargeChart::OnExit));
+      }
+
+      for (int i = 0; i < 10; ++i)
+      {
+        states.push_back(state(i, nullptr, nullptr));
+      }
+
+      LargeChart scanned(&transitions.front(), &transitions.front() + transitions.size(), &states.front(), &states.front() + states.size());
+      LargeChart indexed(&transitions.front(), &transitions.front() + transitions.size(), &states.front(), &states.front() + states.size());
+
+      etl::state_chart_index<LargeChart::TRANSITIONS, LargeChart::STATES + 10> index;
+      indexed.set_index(index);
+
+      CHECK(!scanned.is_indexed());
+      CHECK(indexed.is_indexed());
+
+      scanned.start();
+      indexed.start();
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        int event = int(generator() % (LargeChart::EVENTS + 2));
+
+        scanned.process_event(event);
+        indexed.process_event(event);
+
+        CHECK_EQUAL(scanned.get_state_id(), indexed.get_state_id());
+      }
+
+      CHECK_EQUAL(scanned.actions,     indexed.actions);
+      CHECK_EQUAL(scanned.entries,     indexed.entries);
+      CHECK_EQUAL(scanned.exits,       indexed.exits);
+      CHECK_EQUAL(scanned.guard_count, indexed.guard_count);
+      CHECK(scanned.actions > 0);
+      CHECK(scanned.entries > 0);
+    }
   };
 }
@@ -2762,6 +2762,112 @@ namespace
       CHECK_EQUAL(etl::istring::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_matches_std_for_random_text)
+    {
+      // A small alphabet, so that there are many partial matches.
+      const value_t alphabet[] = { STR('a'), STR('b'), STR('c') };
+      const size_t  alphabet_size = sizeof(alphabet) / sizeof(alphabet[0]);
+
+      uint32_t seed = 1;
+
+      for (int test = 0; test < 400; ++test)
+      {
+        Compare_Text compare_haystack;
+        Compare_Text compare_needle;
+
+        const size_t haystack_length = 1 + (test * 7) % 500;
+        const size_t needle_length   = 1 + (test % 40);
+
+        for (size_t i = 0; i < haystack_length; ++i)
+        {
+          seed = seed * 1103515245 + 12345;
+          // Mostly the first letter, so that the needle is periodic and the checks are expensive.
+          compare_haystack.push_back(alphabet[((seed >> 16) % 8) < 6 ? 0 : ((seed >> 16) % alphabet_size)]);
+        }
+
+        for (size_t i = 0; i < needle_length; ++i)
+        {
+          seed = seed * 1103515245 + 12345;
+          compare_needle.push_back(alphabet[((seed >> 16) % 8) < 6 ? 0 : ((seed >> 16) % alphabet_size)]);
+        }
+
+        // Sometimes plant the needle.
+        if ((test % 3) == 0 && (needle_length <= haystack_length))
+        {
+          compare_haystack.replace((haystack_length - needle_length) / 2, needle_length, compare_needle);
+        }
+
+        etl::string<512> haystack(compare_haystack.begin(), compare_haystack.end());
+        etl::string<512> needle(compare_needle.begin(), compare_needle.end());
+
+        CHECK_EQUAL(compare_haystack.find(compare_needle),      haystack.find(needle));
+        CHECK_EQUAL(compare_haystack.find(compare_needle, 3),   haystack.find(needle, 3));
+        CHECK_EQUAL(compare_haystack.rfind(compare_needle),     haystack.rfind(needle));
+
+        // rfind finds the last match that ends before the position.
+        const size_t position = haystack_length / 2;
+
+        if (position >= needle_length)
+        {
+          CHECK_EQUAL(compare_haystack.rfind(compare_needle, position - needle_length), haystack.rfind(needle, position));
+        }
+
+        const Compare_Text compare_set = compare_needle.substr(0, 3);
+        const etl::string<512> set(compare_set.begin(), compare_set.end());
+
+        CHECK_EQUAL(compare_haystack.find_first_of(compare_set, 2),         haystack.find_first_of(set, 2));
+        CHECK_EQUAL(compare_haystack.find_first_not_of(compare_set, 2),     haystack.find_first_not_of(set, 2));
+        CHECK_EQUAL(compare_haystack.find_last_of(compare_set, position),   haystack.find_last_of(set, position));
+        CHECK_EQUAL(compare_haystack.find_last_not_of(compare_set, position), haystack.find_last_not_of(set, position));
+      }
+    }
+
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_first_of_matches_std_for_long_text)
+    {
+      // Long runs without a hit, so that whole blocks are skipped, with sets of 1 to 10 characters.
+      const value_t alphabet[] = { STR('a'), STR('b'), STR('c'), STR('d'), STR('e'), STR('f'), STR('g'), STR('h'), STR('i'), STR('j'), STR('\xF0') };
+      const size_t  alphabet_size = sizeof(alphabet) / sizeof(alphabet[0]);
+
+      uint32_t seed = 1;
+
+      for (int test = 0; test < 400; ++test)
+      {
+        const size_t text_length = 1 + (test * 13) % 300;
+        const size_t set_length  = 1 + (test % 10);
+
+        Compare_Text compare_text;
+        Compare_Text compare_set;
+
+        for (size_t i = 0; i < set_length; ++i)
+        {
+          compare_set.push_back(alphabet[(test + i) % alphabet_size]);
+        }
+
+        for (size_t i = 0; i < text_length; ++i)
+        {
+          seed = seed * 1103515245 + 12345;
+          // Mostly a character that is not in the set.
+          compare_text.push_back(((seed >> 16) % 64) == 0 ? alphabet[(seed >> 8) % alphabet_size] : STR('z'));
+        }
+
+        etl::string<512> text(compare_text.begin(), compare_text.end());
+        etl::string<512> set(compare_set.begin(), compare_set.end());
+
+        for (size_t position = 0; position <= text_length; position += 7)
+        {
+          CHECK_EQUAL(compare_text.find_first_of(compare_set, position), text.find_first_of(set, position));
+          CHECK_EQUAL(compare_text.find_first_not_of(STR("z"), position), text.find_first_not_of(STR("z"), position));
+        }
+
+        // A set that matches everything but the last character.
+        compare_text[text_length - 1] = STR('y');
+        text[text_length - 1]         = STR('y');
+        CHECK_EQUAL(compare_text.find_first_not_of(STR("abz")), text.find_first_not_of(STR("abz")));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_substr)
     {
@@ -3553,7 +3659,7 @@ namespace
       // Test with actual string type.
       Text text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
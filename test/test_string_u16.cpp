@@ -2761,6 +2761,68 @@ namespace
       CHECK_EQUAL(etl::iu16string::npos, position2);
     }
 
+    //*************************************************************************
+    TEST_FIXTURE(SetupFixture, test_find_matches_std_for_random_text)
+    {
+      // A small alphabet, so that there are many partial matches.
+      // 0x0161 has the same low byte as 'a'.
+      const value_t alphabet[] = { STR('a'), STR('b'), value_t(0x0161), value_t(0x263A) };
+      const size_t  alphabet_size = sizeof(alphabet) / sizeof(alphabet[0]);
+
+      uint32_t seed = 1;
+
+      for (int test = 0; test < 400; ++test)
+      {
+        Compare_Text compare_haystack;
+        Compare_Text compare_needle;
+
+        const size_t haystack_length = 1 + (test * 7) % 500;
+        const size_t needle_length   = 1 + (test % 40);
+
+        for (size_t i = 0; i < haystack_length; ++i)
+        {
+          seed = seed * 1103515245 + 12345;
+          // Mostly the first letter, so that the needle is periodic and the checks are expensive.
+          compare_haystack.push_back(alphabet[((seed >> 16) % 8) < 6 ? 0 : ((seed >> 16) % alphabet_size)]);
+        }
+
+        for (size_t i = 0; i < needle_length; ++i)
+        {
+          seed = seed * 1103515245 + 12345;
+          compare_needle.push_back(alphabet[((seed >> 16) % 8) < 6 ? 0 : ((seed >> 16) % alphabet_size)]);
+        }
+
+        // Sometimes plant the needle.
+        if ((test % 3) == 0 && (needle_length <= haystack_length))
+        {
+          compare_haystack.replace((haystack_length - needle_length) / 2, needle_length, compare_needle);
+        }
+
+        etl::u16string<512> haystack(compare_haystack.begin(), compare_haystack.end());
+        etl::u16string<512> needle(compare_needle.begin(), compare_needle.end());
+
+        CHECK_EQUAL(compare_haystack.find(compare_needle),      haystack.find(needle));
+        CHECK_EQUAL(compare_haystack.find(compare_needle, 3),   haystack.find(needle, 3));
+        CHECK_EQUAL(compare_haystack.rfind(compare_needle),     haystack.rfind(needle));
+
+        // rfind finds the last match that ends before the position.
+        const size_t position = haystack_length / 2;
+
+        if (position >= needle_length)
+        {
+          CHECK_EQUAL(compare_haystack.rfind(compare_needle, position - needle_length), haystack.rfind(needle, position));
+        }
+
+        const Compare_Text compare_set = compare_needle.substr(0, 3);
+        const etl::u16string<512> set(compare_set.begin(), compare_set.end());
+
+        CHECK_EQUAL(compare_haystack.find_first_of(compare_set, 2),         haystack.find_first_of(set, 2));
+        CHECK_EQUAL(compare_haystack.find_first_not_of(compare_set, 2),     haystack.find_first_not_of(set, 2));
+        CHECK_EQUAL(compare_haystack.find_last_of(compare_set, position),   haystack.find_last_of(set, position));
+        CHECK_EQUAL(compare_haystack.find_last_not_of(compare_set, position), haystack.find_last_not_of(set, position));
+      }
+    }
+
     //*************************************************************************
     TEST_FIXTURE(SetupFixture, test_substr)
     {
@@ -3552,7 +3614,7 @@ namespace
       // Test with actual string type.
       Text text(STR("ABCDEFHIJKL"));
       size_t hash = etl::hash<Text>()(text);
-      size_t compare_hash = etl::private_hash::generic_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
+      size_t compare_hash = etl::private_hash::range_hash<size_t>(reinterpret_cast<const uint8_t*>(&text[0]), reinterpret_cast<const uint8_t*>(&text[text.size()]));
       CHECK_EQUAL(compare_hash, hash);
 
       // Test with interface string type.
@@ -0,0 +1,464 @@
+/******************************************************************************
+The MIT License(MIT)
+
+Embedded Template Library.
+https://github.com/ETLCPP/etl
+https://www.etlcpp.com
+
+Copyright(c) 2019 jwellbelove
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files(the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and / or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions :
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+******************************************************************************/
+
+#include "UnitTest++.h"
+
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "etl/to_arithmetic.h"
+#include "etl/to_string.h"
+#include "etl/to_wstring.h"
+#include "etl/string_view.h"
+#include "etl/cstring.h"
+#include "etl/wstring.h"
+#include "etl/format_spec.h"
+#include "etl/wformat_spec.h"
+
+namespace
+{
+  typedef etl::to_arithmetic_status Status;
+
+  //***************************************************************************
+  template <typename T>
+  etl::to_arithmetic_result<T> convert(const char* text, uint32_t base = 10U)
+  {
+    return etl::to_arithmetic<T>(etl::string_view(text), base);
+  }
+
+  //***************************************************************************
+  template <typename T>
+  bool same_bits(T lhs, T rhs)
+  {
+    return memcmp(&lhs, &rhs, sizeof(T)) == 0;
+  }
+
+  SUITE(test_to_arithmetic)
+  {
+    //*************************************************************************
+    TEST(test_integral_decimal)
+    {
+      CHECK_EQUAL(0,           convert<int>("0").value());
+      CHECK_EQUAL(123,         convert<int>("123").value());
+      CHECK_EQUAL(-123,        convert<int>("-123").value());
+      CHECK_EQUAL(123U,        convert<unsigned>("00000000000000000123").value());
+      CHECK_EQUAL(12345678,    convert<int32_t>("12345678").value());
+      CHECK_EQUAL(-123456789,  convert<int32_t>("-123456789").value());
+
+      CHECK_EQUAL(uint64_t(12345678901234567890ULL), convert<uint64_t>("12345678901234567890").value());
+      CHECK_EQUAL(int64_t(-1234567890123456789LL),   convert<int64_t>("-1234567890123456789").value());
+
+      CHECK(convert<int>("42").has_value());
+      CHECK(convert<int>("42").error() == Status::Valid);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_limits)
+    {
+      CHECK_EQUAL(int8_t(127),   convert<int8_t>("127").value());
+      CHECK_EQUAL(int8_t(-128),  convert<int8_t>("-128").value());
+      CHECK_EQUAL(uint8_t(255),  convert<uint8_t>("255").value());
+      CHECK_EQUAL(int16_t(-32768), convert<int16_t>("-32768").value());
+      CHECK_EQUAL(uint16_t(65535), convert<uint16_t>("65535").value());
+
+      CHECK_EQUAL(std::numeric_limits<int32_t>::min(),  convert<int32_t>("-2147483648").value());
+      CHECK_EQUAL(std::numeric_limits<int32_t>::max(),  convert<int32_t>("2147483647").value());
+      CHECK_EQUAL(std::numeric_limits<uint32_t>::max(), convert<uint32_t>("4294967295").value());
+      CHECK_EQUAL(std::numeric_limits<int64_t>::min(),  convert<int64_t>("-9223372036854775808").value());
+      CHECK_EQUAL(std::numeric_limits<int64_t>::max(),  convert<int64_t>("9223372036854775807").value());
+      CHECK_EQUAL(std::numeric_limits<uint64_t>::max(), convert<uint64_t>("18446744073709551615").value());
+
+      CHECK(convert<int8_t>("128").error()                    == Status::Overflow);
+      CHECK(convert<int8_t>("-129").error()                   == Status::Overflow);
+      CHECK(convert<uint8_t>("256").error()                   == Status::Overflow);
+      CHECK(convert<int32_t>("2147483648").error()            == Status::Overflow);
+      CHECK(convert<int32_t>("-2147483649").error()           == Status::Overflow);
+      CHECK(convert<uint64_t>("18446744073709551616").error() == Status::Overflow);
+      CHECK(convert<int64_t>("9223372036854775808").error()   == Status::Overflow);
+      CHECK(convert<uint64_t>("123456789012345678901234567890").error() == Status::Overflow);
+      CHECK_EQUAL(0, convert<int8_t>("128").value());
+    }
+
+    //*************************************************************************
+    TEST(test_integral_small_types_eight_digits)
+    {
+      // Eight or more digits take the eight at a time path, even for types whose limit is below 99999999.
+      CHECK_EQUAL(uint8_t(255),    convert<uint8_t>("00000255").value());
+      CHECK_EQUAL(int8_t(-128),    convert<int8_t>("-00000128").value());
+      CHECK_EQUAL(int8_t(127),     convert<int8_t>("0000000000000127").value());
+      CHECK_EQUAL(int16_t(-32768), convert<int16_t>("-00032768").value());
+      CHECK_EQUAL(uint16_t(65535), convert<uint16_t>("00065535").value());
+      CHECK_EQUAL(uint16_t(65535), convert<uint16_t>("0000000000065535").value());
+
+      CHECK(convert<uint8_t>("00001000").error()          == Status::Overflow);
+      CHECK(convert<uint8_t>("00000256").error()          == Status::Overflow);
+      CHECK(convert<int8_t>("-00000200").error()          == Status::Overflow);
+      CHECK(convert<int8_t>("00000128").error()           == Status::Overflow);
+      CHECK(convert<int16_t>("00070000").error()          == Status::Overflow);
+      CHECK(convert<int16_t>("-00032769").error()         == Status::Overflow);
+      CHECK(convert<uint16_t>("12345678").error()         == Status::Overflow);
+      CHECK(convert<uint16_t>("0000000012345678").error() == Status::Overflow);
+
+      uint8_t value8 = 7;
+      const char text[] = "00001000";
+      etl::from_chars_result<char> result = etl::from_chars(text, text + 8, value8);
+      CHECK(result.status == Status::Overflow);
+      CHECK_EQUAL(7, value8);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_bases)
+    {
+      CHECK_EQUAL(5,          convert<int>("101", 2U).value());
+      CHECK_EQUAL(-5,         convert<int>("-101", 2U).value());
+      CHECK_EQUAL(511,        convert<int>("777", 8U).value());
+      CHECK_EQUAL(0xABCD,     convert<int>("abcd", 16U).value());
+      CHECK_EQUAL(0xABCD,     convert<int>("ABCD", 16U).value());
+      CHECK_EQUAL(6666498,    convert<int>("3YVWI", 36U).value());
+      CHECK_EQUAL(6666498,    convert<int>("3yvwi", 36U).value());
+      CHECK_EQUAL(uint64_t(0xFFFFFFFFFFFFFFFFULL), convert<uint64_t>("ffffffffffffffff", 16U).value());
+      CHECK_EQUAL(uint8_t(255), convert<uint8_t>("11111111", 2U).value());
+
+      CHECK(convert<uint64_t>("10000000000000000", 16U).error() == Status::Overflow);
+      CHECK(convert<uint8_t>("100000000", 2U).error()          == Status::Overflow);
+      CHECK(convert<int>("12", 2U).error()                     == Status::Invalid_Format);
+      CHECK(convert<int>("g", 16U).error()                     == Status::Invalid_Format);
+      CHECK(convert<int>("1", 1U).error()                      == Status::Invalid_Radix);
+      CHECK(convert<int>("1", 37U).error()                     == Status::Invalid_Radix);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_invalid)
+    {
+      CHECK(convert<int>("").error()       == Status::Invalid_Format);
+      CHECK(convert<int>("-").error()      == Status::Invalid_Format);
+      CHECK(convert<int>("+1").error()     == Status::Invalid_Format);
+      CHECK(convert<int>(" 1").error()     == Status::Invalid_Format);
+      CHECK(convert<int>("1 ").error()     == Status::Invalid_Format);
+      CHECK(convert<int>("12a4").error()   == Status::Invalid_Format);
+      CHECK(convert<int>("1.5").error()    == Status::Invalid_Format);
+      CHECK(convert<unsigned>("-1").error() == Status::Signed_To_Unsigned);
+      CHECK(!convert<int>("x").has_value());
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_integral)
+    {
+      const char text[] = "1234567890123abc";
+      int64_t value = 99;
+
+      etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+
+      CHECK(result.status == Status::Valid);
+      CHECK_EQUAL(1234567890123LL, value);
+      CHECK(result.ptr == text + 13);
+
+      // Stops at the first character that is not a digit.
+      value = 99;
+      result = etl::from_chars(text, text + strlen(text), value, 16U);
+      CHECK(result.status == Status::Valid);
+      CHECK_EQUAL(0x1234567890123ABCLL, value);
+      CHECK(result.ptr == text + 16);
+
+      // No digits. The value is unchanged.
+      value = 99;
+      result = etl::from_chars(text + 13, text + 16, value);
+      CHECK(result.status == Status::Invalid_Format);
+      CHECK(result.ptr == text + 13);
+      CHECK_EQUAL(99, value);
+
+      // Overflow. The pointer is after the digits and the value is unchanged.
+      const char big[] = "99999999999,";
+      int32_t value32 = 7;
+      etl::from_chars_result<char> result32 = etl::from_chars(big, big + strlen(big), value32);
+      CHECK(result32.status == Status::Overflow);
+      CHECK(result32.ptr == big + 11);
+      CHECK_EQUAL(7, value32);
+    }
+
+    //*************************************************************************
+    TEST(test_integral_random)
+    {
+      std::mt19937_64 generator(1234);
+      char text[80];
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        const uint64_t u = generator() >> (generator() % 64U);
+        const int64_t  s = int64_t(generator()) >> (generator() % 64U);
+
+        snprintf(text, sizeof(text), "%llu", static_cast<unsigned long long>(u));
+        CHECK_EQUAL(u, convert<uint64_t>(text).value());
+
+        snprintf(text, sizeof(text), "%lld", static_cast<long long>(s));
+        CHECK_EQUAL(s, convert<int64_t>(text).value());
+
+        snprintf(text, sizeof(text), "%llx", static_cast<unsigned long long>(u));
+        CHECK_EQUAL(u, convert<uint64_t>(text, 16U).value());
+
+        snprintf(text, sizeof(text), "%llo", static_cast<unsigned long long>(u));
+        CHECK_EQUAL(u, convert<uint64_t>(text, 8U).value());
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point)
+    {
+      CHECK_EQUAL(0.0,        convert<double>("0").value());
+      CHECK_EQUAL(1.0,        convert<double>("1").value());
+      CHECK_EQUAL(-1.5,       convert<double>("-1.5").value());
+      CHECK_EQUAL(0.5,        convert<double>(".5").value());
+      CHECK_EQUAL(5.0,        convert<double>("5.").value());
+      CHECK_EQUAL(1500.0,     convert<double>("1.5e3").value());
+      CHECK_EQUAL(1500.0,     convert<double>("1.5E+3").value());
+      CHECK_EQUAL(0.0015,     convert<double>("1.5e-3").value());
+      CHECK_EQUAL(0.1,        convert<double>("0.1").value());
+      CHECK_EQUAL(0.1f,       convert<float>("0.1").value());
+      CHECK_EQUAL(3.14159274f, convert<float>("3.14159265358979323846").value());
+      CHECK_EQUAL(3.141592653589793, convert<double>("3.14159265358979323846").value());
+      CHECK_EQUAL(123456789012345678901234567890.0, convert<double>("123456789012345678901234567890").value());
+      CHECK_EQUAL(1.0L,       convert<long double>("1").value());
+      CHECK_EQUAL(0.25L,      convert<long double>("0.25").value());
+
+      CHECK(std::signbit(convert<double>("-0").value()));
+      CHECK(std::signbit(convert<double>("-0.0e10").value()));
+      CHECK(!std::signbit(convert<double>("0.0").value()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_special)
+    {
+      CHECK(std::isinf(convert<double>("inf").value()));
+      CHECK(std::isinf(convert<double>("Infinity").value()));
+      CHECK(std::isinf(convert<float>("INF").value()));
+      CHECK(convert<double>("-inf").value() < 0.0);
+      CHECK(std::isnan(convert<double>("nan").value()));
+      CHECK(std::isnan(convert<float>("NaN").value()));
+
+      CHECK(convert<double>("infin").error() == Status::Invalid_Format);
+      CHECK(convert<double>("na").error()    == Status::Invalid_Format);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_limits)
+    {
+      CHECK_EQUAL(std::numeric_limits<double>::max(),        convert<double>("1.7976931348623157e308").value());
+      CHECK_EQUAL(std::numeric_limits<double>::min(),        convert<double>("2.2250738585072014e-308").value());
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(), convert<double>("4.9406564584124654e-324").value());
+      CHECK_EQUAL(std::numeric_limits<float>::max(),         convert<float>("3.4028234664e38").value());
+      CHECK_EQUAL(std::numeric_limits<float>::denorm_min(),  convert<float>("1.4e-45").value());
+
+      // Half of the smallest subnormal rounds to even, which is zero. Just above it rounds up.
+      CHECK_EQUAL(0.0, convert<double>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125e-324").value());
+      CHECK_EQUAL(std::numeric_limits<double>::denorm_min(), convert<double>("2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049705821028513185451396213837722826145437693412532098591327667236328125001e-324").value());
+
+      // Half way between 1 and the next double rounds to even, which is 1. Just above it rounds up.
+      CHECK_EQUAL(1.0, convert<double>("1.00000000000000011102230246251565404236316680908203125").value());
+      CHECK_EQUAL(std::nextafter(1.0, 2.0), convert<double>("1.00000000000000011102230246251565404236316680908203125000000000000000000000001").value());
+
+      CHECK_EQUAL(0.0, convert<double>("1e-400").value());
+      CHECK_EQUAL(0.0, convert<float>("1e-50").value());
+      CHECK(convert<double>("1e-400").has_value());
+
+      CHECK(convert<double>("1e400").error()  == Status::Overflow);
+      CHECK(convert<double>("-1e400").error() == Status::Overflow);
+      CHECK(convert<float>("1e39").error()    == Status::Overflow);
+      CHECK(convert<double>("1e99999999999").error() == Status::Overflow);
+      CHECK_EQUAL(0.0, convert<double>("1e-99999999999").value());
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_invalid)
+    {
+      CHECK(convert<double>("").error()      == Status::Invalid_Format);
+      CHECK(convert<double>(".").error()     == Status::Invalid_Format);
+      CHECK(convert<double>("-").error()     == Status::Invalid_Format);
+      CHECK(convert<double>("e5").error()    == Status::Invalid_Format);
+      CHECK(convert<double>("1e").error()    == Status::Invalid_Format);
+      CHECK(convert<double>("1e+").error()   == Status::Invalid_Format);
+      CHECK(convert<double>("1.2.3").error() == Status::Invalid_Format);
+      CHECK(convert<double>("+1").error()    == Status::Invalid_Format);
+      CHECK(convert<double>("1", 16U).error() == Status::Invalid_Radix);
+    }
+
+    //*************************************************************************
+    TEST(test_from_chars_floating_point)
+    {
+      const char text[] = "1.25e2x";
+      double value = 99.0;
+
+      etl::from_chars_result<char> result = etl::from_chars(text, text + strlen(text), value);
+      CHECK(result.status == Status::Valid);
+      CHECK_EQUAL(125.0, value);
+      CHECK(result.ptr == text + 6);
+
+      // An 'e' without an exponent is not part of the value.
+      const char no_exponent[] = "1.5e+x";
+      result = etl::from_chars(no_exponent, no_exponent + strlen(no_exponent), value);
+      CHECK(result.status == Status::Valid);
+      CHECK_EQUAL(1.5, value);
+      CHECK(result.ptr == no_exponent + 3);
+
+      // Overflow. The value is unchanged.
+      const char big[] = "1e999";
+      value = 99.0;
+      result = etl::from_chars(big, big + strlen(big), value);
+      CHECK(result.status == Status::Overflow);
+      CHECK(result.ptr == big + 5);
+      CHECK_EQUAL(99.0, value);
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_random_round_trip)
+    {
+      std::mt19937_64 generator(5678);
+      char text[80];
+
+      for (int i = 0; i < 100000; ++i)
+      {
+        uint64_t bits = generator();
+        double d;
+        memcpy(&d, &bits, sizeof(d));
+
+        if (std::isnan(d) || std::isinf(d))
+        {
+          continue;
+        }
+
+        snprintf(text, sizeof(text), "%.17g", d);
+        CHECK(same_bits(d, convert<double>(text).value()));
+
+        const int precision = 1 + int(generator() % 17U);
+        snprintf(text, sizeof(text), "%.*e", precision, d);
+        CHECK(same_bits(strtod(text, nullptr), convert<double>(text).value()));
+        CHECK(same_bits(strtof(text, nullptr), convert<float>(text).value()) || std::isinf(strtof(text, nullptr)));
+
+        // The shortest form from etl::to_string reads back to the same value.
+        etl::string<32> shortest;
+        etl::to_string(d, shortest, etl::format_spec().shortest(true));
+        CHECK(same_bits(d, convert<double>(shortest.c_str()).value()));
+
+        const uint32_t bits32 = uint32_t(bits);
+        float f;
+        memcpy(&f, &bits32, sizeof(f));
+
+        if (!std::isnan(f) && !std::isinf(f))
+        {
+          snprintf(text, sizeof(text), "%.9g", f);
+          CHECK(same_bits(f, convert<float>(text).value()));
+
+          etl::to_string(f, shortest, etl::format_spec().shortest(true));
+          CHECK(same_bits(f, convert<float>(shortest.c_str()).value()));
+        }
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_many_digits)
+    {
+      std::mt19937_64 generator(91011);
+
+      for (int i = 0; i < 10000; ++i)
+      {
+        std::string text;
+        const size_t length = 20U + size_t(generator() % 780U);
+
+        for (size_t d = 0U; d < length; ++d)
+        {
+          text += char('0' + (generator() % 10U));
+        }
+
+        text.insert(size_t(generator() % length), ".");
+        text += "e" + std::to_string(int(generator() % 700U) - 350);
+
+        CHECK(same_bits(strtod(text.c_str(), nullptr), convert<double>(text.c_str()).value()) || std::isinf(strtod(text.c_str(), nullptr)));
+        CHECK(same_bits(strtof(text.c_str(), nullptr), convert<float>(text.c_str()).value()) || std::isinf(strtof(text.c_str(), nullptr)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_format_spec)
+    {
+      etl::string<20> text;
+
+      etl::to_string(-1234, text, etl::format_spec().width(10).fill('#'));
+      CHECK_EQUAL(-1234, etl::to_arithmetic<int>(etl::string_view(text), etl::format_spec().width(10).fill('#')).value());
+
+      etl::to_string(0xBEEF, text, etl::format_spec().hex().width(10).fill(' ').left());
+      CHECK_EQUAL(0xBEEF, etl::to_arithmetic<int>(etl::string_view(text), etl::format_spec().hex().width(10).fill(' ').left()).value());
+
+      etl::to_string(5U, text, etl::format_spec().binary().width(8).fill('0'));
+      CHECK_EQUAL(5U, etl::to_arithmetic<unsigned>(etl::string_view(text), etl::format_spec().binary().width(8).fill('0')).value());
+
+      // A value that is all fill characters.
+      etl::to_string(0, text, etl::format_spec().width(4).fill('0'));
+      CHECK_EQUAL(0, etl::to_arithmetic<int>(etl::string_view(text), etl::format_spec().width(4).fill('0')).value());
+
+      etl::to_string(2.5, text, etl::format_spec().precision(3).width(12).fill(' '));
+      CHECK_EQUAL(2.5, etl::to_arithmetic<double>(etl::string_view(text), etl::format_spec().precision(3).width(12).fill(' ')).value());
+    }
+
+    //*************************************************************************
+    TEST(test_wide_characters)
+    {
+      const wchar_t text[] = L"-12345678901";
+      CHECK_EQUAL(-12345678901LL, etl::to_arithmetic<int64_t>(etl::wstring_view(text)).value());
+      CHECK_EQUAL(0x1F, etl::to_arithmetic<int>(etl::wstring_view(L"1f"), 16U).value());
+      CHECK_EQUAL(-0.125, etl::to_arithmetic<double>(etl::wstring_view(L"-1.25e-1")).value());
+      CHECK(etl::to_arithmetic<int>(etl::wstring_view(L"12x")).error() == Status::Invalid_Format);
+
+      etl::wstring<20> wtext;
+      etl::to_string(42, wtext, etl::wformat_spec().width(6).fill(L'*'));
+      CHECK_EQUAL(42, etl::to_arithmetic<int>(etl::wstring_view(wtext), etl::wformat_spec().width(6).fill(L'*')).value());
+
+      const char16_t text16[] = u"65535";
+      CHECK_EQUAL(uint16_t(65535), etl::to_arithmetic<uint16_t>(text16, text16 + 5).value());
+
+      const char32_t text32[] = U"1.5";
+      CHECK_EQUAL(1.5f, etl::to_arithmetic<float>(text32, text32 + 3).value());
+    }
+
+    //*************************************************************************
+    TEST(test_result)
+    {
+      etl::to_arithmetic_result<int> valid = convert<int>("7");
+      etl::to_arithmetic_result<int> invalid = convert<int>("x");
+
+      CHECK(bool(valid));
+      CHECK(!bool(invalid));
+      CHECK_EQUAL(7, valid.value());
+      CHECK_EQUAL(0, invalid.value());
+      CHECK_EQUAL(std::string("Invalid Format"), std::string(invalid.error().c_str()));
+    }
+  };
+}
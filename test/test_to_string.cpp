@@ -31,6 +31,11 @@ SOFTWARE.
 #include <ostream>
 #include <sstream>
 #include <iomanip>
+#include <random>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
 
 #include "etl/to_string.h"
 #include "etl/cstring.h"
@@ -420,6 +425,216 @@ namespace
       to_string(&cvi, str, Format().hex().width(10).left().fill(STR('0')), true);
       CHECK_EQUAL(compare, str);
     }
+
+    //*************************************************************************
+    TEST(test_integral_matches_snprintf_for_random_values)
+    {
+      std::mt19937_64 rng(1234);
+      etl::string<70> str;
+      char expected[70];
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        // Spread the values over all of the digit counts.
+        const uint64_t u64 = uint64_t(rng()) >> (rng() % 64);
+        const int64_t  i64 = (rng() & 1) ? int64_t(u64) : -int64_t(u64);
+        const uint32_t u32 = uint32_t(u64);
+        const int32_t  i32 = int32_t(i64);
+
+        snprintf(expected, sizeof(expected), "%llu", (unsigned long long)u64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u64, str));
+
+        snprintf(expected, sizeof(expected), "%lld", (long long)i64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(i64, str));
+
+        snprintf(expected, sizeof(expected), "%u", u32);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u32, str));
+
+        snprintf(expected, sizeof(expected), "%d", i32);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(i32, str));
+
+        snprintf(expected, sizeof(expected), "%llX", (unsigned long long)u64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u64, str, Format().hex()));
+
+        snprintf(expected, sizeof(expected), "%llx", (unsigned long long)u64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u64, str, Format().hex().upper_case(false)));
+
+        snprintf(expected, sizeof(expected), "%llo", (unsigned long long)u64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u64, str, Format().octal()));
+
+        snprintf(expected, sizeof(expected), "%-24lld", (long long)i64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(i64, str, Format().width(24).left()));
+
+        snprintf(expected, sizeof(expected), "%024llu", (unsigned long long)u64);
+        CHECK_EQUAL(etl::string<70>(expected), etl::to_string(u64, str, Format().width(24).fill(STR('0'))));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_other_bases)
+    {
+      etl::string<70> str;
+
+      CHECK_EQUAL(etl::string<70>(STR("3YVWI")),   etl::to_string(6666498, str, Format().base(36)));
+      CHECK_EQUAL(etl::string<70>(STR("3yvwi")),   etl::to_string(6666498, str, Format().base(36).upper_case(false)));
+      CHECK_EQUAL(etl::string<70>(STR("101")),     etl::to_string(10, str, Format().base(3)));
+      CHECK_EQUAL(etl::string<70>(STR("  0")),     etl::to_string(0, str, Format().base(7).width(3)));
+      CHECK_EQUAL(etl::string<70>(STR("1111111111111111111111111111111111111111111111111111111111111111")), etl::to_string(uint64_t(0xFFFFFFFFFFFFFFFFULL), str, Format().binary()));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_negative_and_large)
+    {
+      etl::string<400> str;
+
+      CHECK_EQUAL(etl::string<400>(STR("-0.5")),  etl::to_string(-0.5, str, Format().precision(1)));
+      CHECK_EQUAL(etl::string<400>(STR("-1.0")),  etl::to_string(-0.96, str, Format().precision(1)));
+      CHECK_EQUAL(etl::string<400>(STR("-inf")),  etl::to_string(-HUGE_VAL, str));
+      CHECK_EQUAL(etl::string<400>(STR("inf")),   etl::to_string(HUGE_VAL, str));
+      CHECK_EQUAL(etl::string<400>(STR("18446744073709549568.00")),  etl::to_string(18446744073709549568.0, str, Format().precision(2)));
+      CHECK_EQUAL(etl::string<400>(STR("100000000000000000000.00")), etl::to_string(1e20, str, Format().precision(2)));
+      CHECK_EQUAL(etl::string<400>(STR(" -100000000000000000000")),  etl::to_string(-1e20, str, Format().width(23)));
+
+      etl::string<400> expected(STR("1"));
+      expected.append(300, STR('0'));
+      CHECK_EQUAL(expected, etl::to_string(1e300, str));
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::string<30> str;
+      const Format shortest = Format().shortest(true);
+
+      CHECK_EQUAL(etl::string<30>(STR("0")),                       etl::to_string(0.0, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("-0")),                      etl::to_string(-0.0, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("0.1")),                     etl::to_string(0.1, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("0.1")),                     etl::to_string(0.1f, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("0.30000000000000004")),     etl::to_string(0.1 + 0.2, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1")),                       etl::to_string(1.0, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("-123.456")),                etl::to_string(-123.456, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("0.000001")),                etl::to_string(0.000001, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1e-7")),                    etl::to_string(1e-7, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1.5e-7")),                  etl::to_string(1.5e-7, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("100000000000000000000")),   etl::to_string(1e20, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1e+21")),                   etl::to_string(1e21, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("5e-324")),                  etl::to_string(5e-324, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1.7976931348623157e+308")), etl::to_string(1.7976931348623157e308, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("3.4028235e+38")),           etl::to_string(3.4028235e38f, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("1e-45")),                   etl::to_string(1e-45f, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("9007199254740992")),        etl::to_string(9007199254740992.0, str, shortest));
+      CHECK_EQUAL(etl::string<30>(STR("nan")),                     etl::to_string(std::nan(""), str, shortest));
+
+      // The precision is ignored. Width, fill and alignment are not.
+      CHECK_EQUAL(etl::string<30>(STR("    2.5")),                 etl::to_string(2.5, str, Format().shortest(true).precision(6).width(7)));
+      CHECK_EQUAL(etl::string<30>(STR("2.5****")),                 etl::to_string(2.5, str, Format().shortest(true).width(7).left().fill(STR('*'))));
+
+      str.assign(STR("Result "));
+      CHECK_EQUAL(etl::string<30>(STR("Result 0.25")),             etl::to_string(0.25, str, shortest, true));
+    }
+
+    //*************************************************************************
+    TEST(test_long_double_beyond_double)
+    {
+      // Only where long double has a wider range than double.
+      if (std::numeric_limits<long double>::max_exponent10 > std::numeric_limits<double>::max_exponent10)
+      {
+        etl::string<500> str;
+        const etl::format_spec shortest = Format().shortest(true);
+
+        CHECK_EQUAL(etl::string<500>(STR("1e+400")),        etl::to_string(1e400L, str, shortest));
+        CHECK_EQUAL(etl::string<500>(STR("-1.2345e+4000")), etl::to_string(-1.2345e4000L, str, shortest));
+        CHECK_EQUAL(etl::string<500>(STR("2.5e+309")),      etl::to_string(2.5e309L, str, shortest));
+
+        etl::string<500> expected(STR("-25"));
+        expected.append(308, STR('0'));
+        expected.append(STR(".00"));
+        CHECK_EQUAL(expected, etl::to_string(-2.5e309L, str, Format().precision(2)));
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_long_double_below_double)
+    {
+      // Only where long double has a wider range than double.
+      if (std::numeric_limits<long double>::min_exponent10 < std::numeric_limits<double>::min_exponent10)
+      {
+        etl::string<500> str;
+        const etl::format_spec shortest = Format().shortest(true);
+
+        CHECK_EQUAL(etl::string<500>(STR("1e-400")),     etl::to_string(1e-400L, str, shortest));
+        CHECK_EQUAL(etl::string<500>(STR("-3.5e-4000")), etl::to_string(-3.5e-4000L, str, shortest));
+        CHECK_EQUAL(etl::string<500>(STR("1.25e-310")),  etl::to_string(1.25e-310L, str, shortest));
+        CHECK_EQUAL(etl::string<500>(STR("2e-308")),     etl::to_string(2e-308L, str, shortest));
+
+        // The smallest subnormal long double.
+        etl::to_string(std::numeric_limits<long double>::denorm_min(), str, shortest);
+        CHECK(str.compare(0, 3, STR("3.6")) == 0);
+        CHECK(str.find(STR("e-4951")) != etl::string<500>::npos);
+      }
+    }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest_round_trip)
+    {
+      // The number of significant digits in a formatted value.
+      struct local
+      {
+        static size_t significant_digits(const std::string& text)
+        {
+          std::string digits;
+
+          for (size_t i = 0; (i < text.size()) && (text[i] != 'e'); ++i)
+          {
+            if ((text[i] >= '0') && (text[i] <= '9') && !(digits.empty() && (text[i] == '0')))
+            {
+              digits.push_back(text[i]);
+            }
+          }
+
+          while ((digits.size() > 1) && (digits[digits.size() - 1] == '0'))
+          {
+            digits.erase(digits.size() - 1);
+          }
+
+          return digits.size();
+        }
+      };
+
+      std::mt19937_64 rng(5678);
+      etl::string<30> str;
+      const Format shortest = Format().shortest(true);
+
+      for (int i = 0; i < 20000; ++i)
+      {
+        uint64_t bits64 = rng();
+        double   d;
+        memcpy(&d, &bits64, sizeof(d));
+
+        if (std::isfinite(d))
+        {
+          etl::to_string(d, str, shortest);
+          const std::string text(str.begin(), str.end());
+          CHECK_EQUAL(d, strtod(text.c_str(), nullptr));
+
+          // No decimal with fewer digits reads back as the same value.
+          char shorter[32];
+          snprintf(shorter, sizeof(shorter), "%.*e", int(local::significant_digits(text)) - 2, d);
+          CHECK((local::significant_digits(text) == 1) || (strtod(shorter, nullptr) != d));
+        }
+
+        uint32_t bits32 = uint32_t(rng());
+        float    f;
+        memcpy(&f, &bits32, sizeof(f));
+
+        if (std::isfinite(f))
+        {
+          etl::to_string(f, str, shortest);
+          const std::string text(str.begin(), str.end());
+          CHECK_EQUAL(f, strtof(text.c_str(), nullptr));
+          CHECK(local::significant_digits(text) <= 9U);
+        }
+      }
+    }
   };
 }
-
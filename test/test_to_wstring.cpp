@@ -419,6 +419,19 @@ namespace
       to_string(&cvi, str, Format().hex().width(10).left().fill(STR('0')), true);
       CHECK_EQUAL(compare, str);
     }
+
+    //*************************************************************************
+    TEST(test_floating_point_shortest)
+    {
+      etl::wstring<30> str;
+
+      CHECK_EQUAL(etl::wstring<30>(STR("0.1")),       etl::to_string(0.1, str, Format().shortest(true)));
+      CHECK_EQUAL(etl::wstring<30>(STR("-1.5e-7")),   etl::to_string(-1.5e-7f, str, Format().shortest(true)));
+      CHECK_EQUAL(etl::wstring<30>(STR("1e+21")),     etl::to_string(1e21, str, Format().shortest(true)));
+      CHECK_EQUAL(etl::wstring<30>(STR("**123.25")),  etl::to_string(123.25, str, Format().shortest(true).width(8).fill(STR('*'))));
+      CHECK_EQUAL(etl::wstring<30>(STR("-123.250")),  etl::to_string(-123.25, str, Format().precision(3)));
+      CHECK_EQUAL(etl::wstring<30>(STR("7fffffff")),  etl::to_string(int32_t(2147483647), str, Format().hex().upper_case(false)));
+      CHECK_EQUAL(etl::wstring<30>(STR("-12345678901234")), etl::to_string(int64_t(-12345678901234LL), str));
+    }
   };
 }
-